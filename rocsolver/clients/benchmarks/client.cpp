@@ -194,6 +194,11 @@ int main(int argc, char *argv[])
         ("iters,i",
          po::value<rocblas_int>(&argus.iters)->default_value(10),
          "Iterations to run inside timing loop")
+
+        ("lookahead",
+         po::value<rocblas_int>(&argus.lookahead)->default_value(0),
+         "Factorize the next panel of getrf on a side stream while the trailing matrix is updated? "
+         "0 = No, 1 = Yes (default: No)")
         
         ("device",
          po::value<rocblas_int>(&device_id)->default_value(0),
@@ -0,0 +1,99 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_early_exit.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+typedef std::tuple<vector<int>, char> early_exit_tuple;
+
+// vector of vector, each vector is a {N, lda};
+const vector<vector<int>> matrix_size_range = {
+    {100, 100}, {300, 320}, {1100, 1100}
+};
+
+// vector of char, each is an uplo, which can be "Lower (L) or Upper (U)"
+// (only used by potrf)
+const vector<char> uplo_range = {'L', 'U'};
+
+Arguments setup_early_exit_arguments(early_exit_tuple tup)
+{
+  vector<int> matrix_size = std::get<0>(tup);
+  char uplo = std::get<1>(tup);
+
+  Arguments arg;
+
+  arg.N = matrix_size[0];
+  arg.lda = matrix_size[1];
+
+  arg.uplo_option = uplo;
+
+  arg.timing = 0;
+  arg.batch_count = 5;
+
+  return arg;
+}
+
+class EarlyExit : public ::TestWithParam<early_exit_tuple> {
+protected:
+  EarlyExit() {}
+  virtual ~EarlyExit() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(EarlyExit, potrf_float) {
+  Arguments arg = setup_early_exit_arguments(GetParam());
+
+  rocblas_status status = testing_early_exit<float,float,true>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(EarlyExit, potrf_double) {
+  Arguments arg = setup_early_exit_arguments(GetParam());
+
+  rocblas_status status = testing_early_exit<double,double,true>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(EarlyExit, getrf_float) {
+  Arguments arg = setup_early_exit_arguments(GetParam());
+
+  rocblas_status status = testing_early_exit<float,float,false>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(EarlyExit, getrf_double) {
+  Arguments arg = setup_early_exit_arguments(GetParam());
+
+  rocblas_status status = testing_early_exit<double,double,false>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(EarlyExit, getrf_double_complex) {
+  Arguments arg = setup_early_exit_arguments(GetParam());
+
+  rocblas_status status = testing_early_exit<rocblas_double_complex,double,false>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, EarlyExit,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(uplo_range)));
@@ -0,0 +1,166 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gbtrf_gbtrs.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+typedef std::tuple<vector<int>, vector<int>, char> gbtrs_tuple;
+
+// vector of vector, each vector is a {N, ldb};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range = {
+    {8, 8}, {40, 40}, {64, 70}, {200, 210}
+};
+
+// vector of vector, each vector is a {kl, ku, nrhs};
+// add/delete as a group
+const vector<vector<int>> band_range = {
+    {0, 0, 1}, {1, 1, 8}, {3, 0, 1}, {2, 7, 8}, {16, 9, 50}
+};
+
+// each is a trans
+const vector<char> trans_range = {'N', 'T', 'C'};
+
+
+Arguments setup_gbtrs_arguments(gbtrs_tuple tup) {
+
+  vector<int> matrix_size = std::get<0>(tup);
+  vector<int> band = std::get<1>(tup);
+  char trans = std::get<2>(tup);
+
+  Arguments arg;
+
+  arg.N = matrix_size[0];
+  arg.ldb = matrix_size[1];
+  arg.k1 = band[0];
+  arg.k2 = band[1];
+  arg.K = band[2];
+  arg.transA_option = trans;
+  arg.batch_count = 3;
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class BandLU : public ::TestWithParam<gbtrs_tuple> {
+protected:
+  BandLU() {}
+  virtual ~BandLU() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(BandLU, gbtrs_float) {
+  Arguments arg = setup_gbtrs_arguments(GetParam());
+
+  rocblas_status status = testing_gbtrf_gbtrs<float,float,0>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(BandLU, gbtrs_double) {
+  Arguments arg = setup_gbtrs_arguments(GetParam());
+
+  rocblas_status status = testing_gbtrf_gbtrs<double,double,0>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(BandLU, gbtrs_float_complex) {
+  Arguments arg = setup_gbtrs_arguments(GetParam());
+
+  rocblas_status status = testing_gbtrf_gbtrs<rocblas_float_complex,float,0>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(BandLU, gbtrs_double_complex) {
+  Arguments arg = setup_gbtrs_arguments(GetParam());
+
+  rocblas_status status = testing_gbtrf_gbtrs<rocblas_double_complex,double,0>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(BandLU, batched_gbtrs_float) {
+  Arguments arg = setup_gbtrs_arguments(GetParam());
+
+  rocblas_status status = testing_gbtrf_gbtrs<float,float,1>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(BandLU, batched_gbtrs_double) {
+  Arguments arg = setup_gbtrs_arguments(GetParam());
+
+  rocblas_status status = testing_gbtrf_gbtrs<double,double,1>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(BandLU, batched_gbtrs_float_complex) {
+  Arguments arg = setup_gbtrs_arguments(GetParam());
+
+  rocblas_status status = testing_gbtrf_gbtrs<rocblas_float_complex,float,1>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(BandLU, batched_gbtrs_double_complex) {
+  Arguments arg = setup_gbtrs_arguments(GetParam());
+
+  rocblas_status status = testing_gbtrf_gbtrs<rocblas_double_complex,double,1>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(BandLU, strided_batched_gbtrs_float) {
+  Arguments arg = setup_gbtrs_arguments(GetParam());
+
+  rocblas_status status = testing_gbtrf_gbtrs<float,float,2>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(BandLU, strided_batched_gbtrs_double) {
+  Arguments arg = setup_gbtrs_arguments(GetParam());
+
+  rocblas_status status = testing_gbtrf_gbtrs<double,double,2>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(BandLU, strided_batched_gbtrs_float_complex) {
+  Arguments arg = setup_gbtrs_arguments(GetParam());
+
+  rocblas_status status = testing_gbtrf_gbtrs<rocblas_float_complex,float,2>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(BandLU, strided_batched_gbtrs_double_complex) {
+  Arguments arg = setup_gbtrs_arguments(GetParam());
+
+  rocblas_status status = testing_gbtrf_gbtrs<rocblas_double_complex,double,2>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, BandLU,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(band_range),
+                                ValuesIn(trans_range)));
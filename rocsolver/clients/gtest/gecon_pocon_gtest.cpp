@@ -0,0 +1,205 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gecon_pocon.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+typedef std::tuple<vector<int>, char> con_tuple;
+
+// vector of vector, each vector is a {N, lda};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range = {
+    {10, 10}, {64, 64}, {150, 150}, {300, 320}
+};
+
+// each is a uplo (only used by pocon)
+const vector<char> uplo_range = {
+    'L', 'U',
+};
+
+
+Arguments setup_arguments(con_tuple tup) {
+
+  vector<int> matrix_size = std::get<0>(tup);
+  char uplo = std::get<1>(tup);
+
+  Arguments arg;
+
+  arg.N = matrix_size[0];
+  arg.lda = matrix_size[1];
+  arg.uplo_option = uplo;
+  arg.batch_count = 3;
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class CondNumber : public ::TestWithParam<con_tuple> {
+protected:
+  CondNumber() {}
+  virtual ~CondNumber() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(CondNumber, gecon_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gecon_pocon<float,float,0,false>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CondNumber, gecon_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gecon_pocon<double,double,0,false>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CondNumber, gecon_float_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gecon_pocon<rocblas_float_complex,float,0,false>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CondNumber, gecon_double_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gecon_pocon<rocblas_double_complex,double,0,false>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CondNumber, batched_gecon_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gecon_pocon<float,float,1,false>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CondNumber, batched_gecon_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gecon_pocon<double,double,1,false>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CondNumber, batched_gecon_float_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gecon_pocon<rocblas_float_complex,float,1,false>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CondNumber, batched_gecon_double_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gecon_pocon<rocblas_double_complex,double,1,false>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CondNumber, strided_batched_gecon_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gecon_pocon<float,float,2,false>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CondNumber, strided_batched_gecon_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gecon_pocon<double,double,2,false>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CondNumber, strided_batched_gecon_float_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gecon_pocon<rocblas_float_complex,float,2,false>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CondNumber, strided_batched_gecon_double_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gecon_pocon<rocblas_double_complex,double,2,false>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CondNumber, pocon_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gecon_pocon<float,float,0,true>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CondNumber, pocon_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gecon_pocon<double,double,0,true>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CondNumber, batched_pocon_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gecon_pocon<float,float,1,true>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CondNumber, batched_pocon_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gecon_pocon<double,double,1,true>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CondNumber, strided_batched_pocon_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gecon_pocon<float,float,2,true>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CondNumber, strided_batched_pocon_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gecon_pocon<double,double,2,true>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, CondNumber,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(uplo_range)));
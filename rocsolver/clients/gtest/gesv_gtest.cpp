@@ -0,0 +1,158 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gesv.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+typedef std::tuple<vector<int>, int> gesv_tuple;
+
+// vector of vector, each vector is a {N, lda, ldb};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range = {
+    {10, 10, 10}, {40, 50, 40}, {64, 70, 64}, {200, 200, 210}
+};
+
+// each is a nrhs
+const vector<int> nrhs_range = {
+    1, 8, 50,
+};
+
+
+Arguments setup_arguments(gesv_tuple tup) {
+
+  vector<int> matrix_size = std::get<0>(tup);
+  int nrhs = std::get<1>(tup);
+
+  Arguments arg;
+
+  arg.N = matrix_size[0];
+  arg.lda = matrix_size[1];
+  arg.ldb = matrix_size[2];
+  arg.K = nrhs;
+  arg.batch_count = 3;
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class LUsolver : public ::TestWithParam<gesv_tuple> {
+protected:
+  LUsolver() {}
+  virtual ~LUsolver() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(LUsolver, float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gesv<float,float,0>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUsolver, double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gesv<double,double,0>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUsolver, float_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gesv<rocblas_float_complex,float,0>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUsolver, double_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gesv<rocblas_double_complex,double,0>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUsolver, batched_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gesv<float,float,1>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUsolver, batched_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gesv<double,double,1>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUsolver, batched_float_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gesv<rocblas_float_complex,float,1>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUsolver, batched_double_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gesv<rocblas_double_complex,double,1>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUsolver, strided_batched_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gesv<float,float,2>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUsolver, strided_batched_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gesv<double,double,2>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUsolver, strided_batched_float_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gesv<rocblas_float_complex,float,2>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUsolver, strided_batched_double_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gesv<rocblas_double_complex,double,2>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, LUsolver,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(nrhs_range)));
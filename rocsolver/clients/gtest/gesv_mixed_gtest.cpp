@@ -0,0 +1,85 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gesv_mixed.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+typedef std::tuple<vector<int>, int> gesv_mixed_tuple;
+
+// vector of vector, each vector is a {N, lda, ldb};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range = {
+    {10, 10, 10}, {64, 70, 64}, {200, 200, 210}, {700, 700, 700}
+};
+
+// each is a nrhs
+const vector<int> nrhs_range = {
+    1, 8, 50,
+};
+
+
+Arguments setup_arguments(gesv_mixed_tuple tup) {
+
+  vector<int> matrix_size = std::get<0>(tup);
+  int nrhs = std::get<1>(tup);
+
+  Arguments arg;
+
+  arg.N = matrix_size[0];
+  arg.lda = matrix_size[1];
+  arg.ldb = matrix_size[2];
+  arg.K = nrhs;
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class MixedSolver : public ::TestWithParam<gesv_mixed_tuple> {
+protected:
+  MixedSolver() {}
+  virtual ~MixedSolver() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(MixedSolver, dsgesv) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gesv_mixed<double,double>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(MixedSolver, zcgesv) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gesv_mixed<rocblas_double_complex,double>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(MixedSolver, dsgesv_fallback) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_gesv_mixed<double,double>(arg, 1e300);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, MixedSolver,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(nrhs_range)));
@@ -24,7 +24,7 @@ typedef std::tuple<vector<int>, vector<int>> getf2_getrf_tuple;
 
 // vector of vector, each vector is a {M, lda};
 const vector<vector<int>> matrix_size_range = {
-    {0, 1}, {-1, 1}, {20, 5}, {50, 50}, {70, 100}
+    {0, 1}, {-1, 1}, {20, 5}, {50, 50}, {64, 64}, {70, 100}
 };
 
 // each is a {N, stP}
@@ -27,7 +27,7 @@ typedef std::tuple<vector<int>, vector<int>> getf2_getrf_tuple;
 // if stA == 0: strideA is lda*N
 // if stA == 1: strideA > lda*N 
 const vector<vector<int>> matrix_size_range = {
-    {0, 1, 0}, {-1, 1, 0}, {20, 5, 0}, {50, 50, 1}, {70, 100, 0}
+    {0, 1, 0}, {-1, 1, 0}, {20, 5, 0}, {50, 50, 1}, {64, 64, 0}, {70, 100, 0}
 };
 
 // each is a {N, stP}
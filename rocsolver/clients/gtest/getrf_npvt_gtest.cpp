@@ -0,0 +1,157 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_getrf_npvt.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+typedef std::tuple<vector<int>, int> getrf_npvt_tuple;
+
+// vector of vector, each vector is a {M, lda};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range = {
+    {32, 32}, {50, 50}, {70, 100}, {640, 640}
+};
+
+// each is a N
+const vector<int> n_size_range = {
+    16, 20, 130, 400,
+};
+
+
+Arguments setup_arguments(getrf_npvt_tuple tup) {
+
+  vector<int> matrix_size = std::get<0>(tup);
+  int n_size = std::get<1>(tup);
+
+  Arguments arg;
+
+  arg.M = matrix_size[0];
+  arg.N = n_size;
+  arg.lda = matrix_size[1];
+  arg.batch_count = 3;
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class LUnpvt : public ::TestWithParam<getrf_npvt_tuple> {
+protected:
+  LUnpvt() {}
+  virtual ~LUnpvt() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(LUnpvt, float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getrf_npvt<float,float,0>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUnpvt, double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getrf_npvt<double,double,0>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUnpvt, float_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getrf_npvt<rocblas_float_complex,float,0>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUnpvt, double_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getrf_npvt<rocblas_double_complex,double,0>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUnpvt, batched_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getrf_npvt<float,float,1>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUnpvt, batched_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getrf_npvt<double,double,1>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUnpvt, batched_float_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getrf_npvt<rocblas_float_complex,float,1>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUnpvt, batched_double_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getrf_npvt<rocblas_double_complex,double,1>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUnpvt, strided_batched_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getrf_npvt<float,float,2>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUnpvt, strided_batched_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getrf_npvt<double,double,2>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUnpvt, strided_batched_float_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getrf_npvt<rocblas_float_complex,float,2>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUnpvt, strided_batched_double_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getrf_npvt<rocblas_double_complex,double,2>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, LUnpvt,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(n_size_range)));
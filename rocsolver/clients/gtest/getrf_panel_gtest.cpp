@@ -0,0 +1,132 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_getrf_panel.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+typedef std::tuple<vector<int>, int> getrf_panel_tuple;
+
+// vector of vector, each vector is a {M, lda};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range = {
+    {70, 100}, {640, 640}, {2000, 2000}
+};
+
+// each is a N
+const vector<int> n_size_range = {
+    64, 150, 300,
+};
+
+
+Arguments setup_arguments(getrf_panel_tuple tup) {
+
+  vector<int> matrix_size = std::get<0>(tup);
+  int n_size = std::get<1>(tup);
+
+  Arguments arg;
+
+  arg.M = matrix_size[0];
+  arg.N = n_size;
+  arg.lda = matrix_size[1];
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class LUpanel : public ::TestWithParam<getrf_panel_tuple> {
+protected:
+  LUpanel() {}
+  virtual ~LUpanel() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(LUpanel, recursive_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getrf_panel<float,float>(arg, rocblas_panel_recursive);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUpanel, recursive_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getrf_panel<double,double>(arg, rocblas_panel_recursive);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUpanel, recursive_double_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getrf_panel<rocblas_double_complex,double>(arg, rocblas_panel_recursive);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUpanel, lookahead_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getrf_panel<float,float>(arg, rocblas_panel_auto, 1);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUpanel, lookahead_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getrf_panel<double,double>(arg, rocblas_panel_auto, 1);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUpanel, tournament_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getrf_panel<float,float>(arg, rocblas_panel_tournament);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUpanel, tournament_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getrf_panel<double,double>(arg, rocblas_panel_tournament);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUpanel, tournament_float_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getrf_panel<rocblas_float_complex,float>(arg, rocblas_panel_tournament);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUpanel, tournament_lookahead_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getrf_panel<double,double>(arg, rocblas_panel_tournament, 1);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, LUpanel,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(n_size_range)));
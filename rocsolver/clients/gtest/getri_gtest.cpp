@@ -0,0 +1,139 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_getri.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+typedef vector<int> getri_tuple;
+
+// vector of vector, each vector is a {N, lda};
+// small sizes use the single-kernel path, larger ones the blocked algorithm
+const vector<vector<int>> matrix_size_range = {
+    {10, 10}, {40, 60}, {64, 64}, {65, 70}, {150, 150}, {300, 320}
+};
+
+
+Arguments setup_arguments(getri_tuple tup) {
+
+  Arguments arg;
+
+  arg.N = tup[0];
+  arg.lda = tup[1];
+  arg.batch_count = 3;
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class LUinverse : public ::TestWithParam<getri_tuple> {
+protected:
+  LUinverse() {}
+  virtual ~LUinverse() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(LUinverse, float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getri<float,float,0>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUinverse, double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getri<double,double,0>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUinverse, float_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getri<rocblas_float_complex,float,0>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUinverse, double_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getri<rocblas_double_complex,double,0>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUinverse, outofplace_batched_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getri<float,float,1>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUinverse, outofplace_batched_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getri<double,double,1>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUinverse, outofplace_batched_float_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getri<rocblas_float_complex,float,1>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUinverse, outofplace_batched_double_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getri<rocblas_double_complex,double,1>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUinverse, singular_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getri<double,double,0>(arg, true);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUinverse, singular_outofplace_batched_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getri<float,float,1>(arg, true);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(LUinverse, singular_outofplace_batched_double_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_getri<rocblas_double_complex,double,1>(arg, true);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, LUinverse,
+                        ValuesIn(matrix_size_range));
@@ -34,7 +34,7 @@ const vector<vector<int>> matrix_sizeA_range = {
 // if std = 0 strides are the minimum
 // if std = 1 strides are larger
 const vector<vector<int>> matrix_sizeB_range = {
-    {-1, 0, 0}, {0, 0, 0}, {10, 0, 0}, {20, 1, 1}, {30, 0, 0},
+    {-1, 0, 0}, {0, 0, 0}, {1, 0, 0}, {4, 1, 1}, {8, 0, 1}, {10, 0, 0}, {20, 1, 1}, {30, 0, 0},
 };
 
 const vector<vector<int>> large_matrix_sizeA_range = {
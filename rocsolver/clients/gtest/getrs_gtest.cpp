@@ -30,7 +30,7 @@ const vector<vector<int>> matrix_sizeA_range = {
 // if trans = 1 then transpose
 // if trans = 2 then conjugate transpose
 const vector<vector<int>> matrix_sizeB_range = {
-    {-1, 0}, {0, 0}, {10, 0}, {20, 1}, {30, 2},
+    {-1, 0}, {0, 0}, {1, 0}, {8, 1}, {5, 2}, {10, 0}, {20, 1}, {30, 2},
 };
 
 const vector<vector<int>> large_matrix_sizeA_range = {
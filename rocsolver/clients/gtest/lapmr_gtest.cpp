@@ -0,0 +1,93 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_lapmr.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+typedef std::tuple<vector<int>, int> lapmr_tuple;
+
+// vector of vector, each vector is a {M, ldx, K};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range = {
+    {1, 1, 1}, {10, 10, 10}, {50, 60, 30}, {300, 300, 300}, {1000, 1024, 700}
+};
+
+// each is a N (number of columns)
+const vector<int> n_range = {
+    1, 16, 100,
+};
+
+
+Arguments setup_arguments(lapmr_tuple tup) {
+
+  vector<int> matrix_size = std::get<0>(tup);
+  int n = std::get<1>(tup);
+
+  Arguments arg;
+
+  arg.M = matrix_size[0];
+  arg.lda = matrix_size[1];
+  arg.K = matrix_size[2];
+  arg.N = n;
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class gather : public ::TestWithParam<lapmr_tuple> {
+protected:
+  gather() {}
+  virtual ~gather() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(gather, lapmr_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_lapmr<float>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(gather, lapmr_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_lapmr<double>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(gather, lapmr_float_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_lapmr<rocblas_float_complex>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(gather, lapmr_double_complex) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_lapmr<rocblas_double_complex>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, gather,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(n_range)));
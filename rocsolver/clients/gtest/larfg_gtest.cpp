@@ -90,6 +90,36 @@ TEST_P(HHreflec, larfg_double) {
   }
 }
 
+TEST_P(HHreflec, larfg_float_large) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_larfg<float>(arg, 1e30f);
+
+  if (status != rocblas_status_success) {
+    EXPECT_TRUE(arg.N < 0 || arg.incx < 1);
+  }
+}
+
+TEST_P(HHreflec, larfg_double_large) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_larfg<double>(arg, 1e200);
+
+  if (status != rocblas_status_success) {
+    EXPECT_TRUE(arg.N < 0 || arg.incx < 1);
+  }
+}
+
+TEST_P(HHreflec, larfg_double_small) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_larfg<double>(arg, 1e-200);
+
+  if (status != rocblas_status_success) {
+    EXPECT_TRUE(arg.N < 0 || arg.incx < 1);
+  }
+}
+
 INSTANTIATE_TEST_CASE_P(daily_lapack, HHreflec,
                         Combine(ValuesIn(large_n_size_range),
                                 ValuesIn(incx_range)));
@@ -0,0 +1,117 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_pbtrf_pbtrs.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+typedef std::tuple<vector<int>, vector<int>, char> pbtrs_tuple;
+
+// vector of vector, each vector is a {N, ldb};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range = {
+    {8, 8}, {40, 40}, {64, 70}, {200, 210}
+};
+
+// vector of vector, each vector is a {kd, nrhs};
+// add/delete as a group
+const vector<vector<int>> band_range = {
+    {0, 1}, {1, 8}, {5, 1}, {16, 50}
+};
+
+// each is an uplo
+const vector<char> uplo_range = {'L', 'U'};
+
+
+Arguments setup_pbtrs_arguments(pbtrs_tuple tup) {
+
+  vector<int> matrix_size = std::get<0>(tup);
+  vector<int> band = std::get<1>(tup);
+  char uplo = std::get<2>(tup);
+
+  Arguments arg;
+
+  arg.N = matrix_size[0];
+  arg.ldb = matrix_size[1];
+  arg.k1 = band[0];
+  arg.K = band[1];
+  arg.uplo_option = uplo;
+  arg.batch_count = 3;
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class BandChol : public ::TestWithParam<pbtrs_tuple> {
+protected:
+  BandChol() {}
+  virtual ~BandChol() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(BandChol, pbtrs_float) {
+  Arguments arg = setup_pbtrs_arguments(GetParam());
+
+  rocblas_status status = testing_pbtrf_pbtrs<float,0>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(BandChol, pbtrs_double) {
+  Arguments arg = setup_pbtrs_arguments(GetParam());
+
+  rocblas_status status = testing_pbtrf_pbtrs<double,0>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(BandChol, batched_pbtrs_float) {
+  Arguments arg = setup_pbtrs_arguments(GetParam());
+
+  rocblas_status status = testing_pbtrf_pbtrs<float,1>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(BandChol, batched_pbtrs_double) {
+  Arguments arg = setup_pbtrs_arguments(GetParam());
+
+  rocblas_status status = testing_pbtrf_pbtrs<double,1>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(BandChol, strided_batched_pbtrs_float) {
+  Arguments arg = setup_pbtrs_arguments(GetParam());
+
+  rocblas_status status = testing_pbtrf_pbtrs<float,2>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(BandChol, strided_batched_pbtrs_double) {
+  Arguments arg = setup_pbtrs_arguments(GetParam());
+
+  rocblas_status status = testing_pbtrf_pbtrs<double,2>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, BandChol,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(band_range),
+                                ValuesIn(uplo_range)));
@@ -24,7 +24,7 @@ typedef std::tuple<vector<int>, char> cholB_tuple;
 
 // vector of vector, each vector is a {N, lda};
 const vector<vector<int>> matrix_size_range = {
-    {-1, 1}, {0, 1}, {10, 2}, {10, 10}, {20, 30}, {50, 50}, {70, 80}
+    {-1, 1}, {0, 1}, {10, 2}, {8, 8}, {10, 10}, {20, 30}, {50, 50}, {64, 64}, {70, 80}
 };
 
 const vector<vector<int>> large_matrix_size_range = {
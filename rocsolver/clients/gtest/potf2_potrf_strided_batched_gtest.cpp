@@ -26,7 +26,7 @@ typedef std::tuple<vector<int>, char> cholSB_tuple;
 // if stA == 0: strideA is lda*N
 // if stA == 1; strideA > lda*N
 const vector<vector<int>> matrix_size_range = {
-    {-1, 1, 0}, {0, 1, 0}, {10, 2, 0}, {10, 10, 0}, {20, 30, 1}, {50, 50, 0}, {70, 80, 0}
+    {-1, 1, 0}, {0, 1, 0}, {10, 2, 0}, {8, 8, 0}, {10, 10, 0}, {20, 30, 1}, {50, 50, 0}, {64, 64, 1}, {70, 80, 0}
 };
 
 const vector<vector<int>> large_matrix_size_range = {
@@ -0,0 +1,164 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_potrs_posv.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+typedef std::tuple<vector<int>, int, char> posv_tuple;
+
+// vector of vector, each vector is a {N, lda, ldb};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range = {
+    {8, 8, 8}, {40, 50, 40}, {64, 70, 64}, {200, 200, 210}
+};
+
+// each is a nrhs
+const vector<int> nrhs_range = {
+    1, 8, 50,
+};
+
+// each is an uplo
+const vector<char> uplo_range = {'L', 'U'};
+
+
+Arguments setup_arguments(posv_tuple tup) {
+
+  vector<int> matrix_size = std::get<0>(tup);
+  int nrhs = std::get<1>(tup);
+  char uplo = std::get<2>(tup);
+
+  Arguments arg;
+
+  arg.N = matrix_size[0];
+  arg.lda = matrix_size[1];
+  arg.ldb = matrix_size[2];
+  arg.K = nrhs;
+  arg.uplo_option = uplo;
+  arg.batch_count = 3;
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class CholSolver : public ::TestWithParam<posv_tuple> {
+protected:
+  CholSolver() {}
+  virtual ~CholSolver() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(CholSolver, potrs_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_potrs_posv<float,0,false>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CholSolver, potrs_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_potrs_posv<double,0,false>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CholSolver, batched_potrs_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_potrs_posv<float,1,false>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CholSolver, batched_potrs_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_potrs_posv<double,1,false>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CholSolver, strided_batched_potrs_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_potrs_posv<float,2,false>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CholSolver, strided_batched_potrs_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_potrs_posv<double,2,false>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CholSolver, posv_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_potrs_posv<float,0,true>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CholSolver, posv_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_potrs_posv<double,0,true>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CholSolver, batched_posv_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_potrs_posv<float,1,true>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CholSolver, batched_posv_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_potrs_posv<double,1,true>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CholSolver, strided_batched_posv_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_potrs_posv<float,2,true>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(CholSolver, strided_batched_posv_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_potrs_posv<double,2,true>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, CholSolver,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(nrhs_range),
+                                ValuesIn(uplo_range)));
@@ -0,0 +1,115 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_pptrf_pptrs.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+typedef std::tuple<vector<int>, int, char> pptrs_tuple;
+
+// vector of vector, each vector is a {N, ldb};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range = {
+    {8, 8}, {40, 40}, {64, 70}, {200, 210}
+};
+
+// each is a nrhs
+const vector<int> nrhs_range = {
+    1, 8, 50,
+};
+
+// each is an uplo
+const vector<char> uplo_range = {'L', 'U'};
+
+
+Arguments setup_pptrs_arguments(pptrs_tuple tup) {
+
+  vector<int> matrix_size = std::get<0>(tup);
+  int nrhs = std::get<1>(tup);
+  char uplo = std::get<2>(tup);
+
+  Arguments arg;
+
+  arg.N = matrix_size[0];
+  arg.ldb = matrix_size[1];
+  arg.K = nrhs;
+  arg.uplo_option = uplo;
+  arg.batch_count = 3;
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class PackedChol : public ::TestWithParam<pptrs_tuple> {
+protected:
+  PackedChol() {}
+  virtual ~PackedChol() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(PackedChol, pptrs_float) {
+  Arguments arg = setup_pptrs_arguments(GetParam());
+
+  rocblas_status status = testing_pptrf_pptrs<float,0>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(PackedChol, pptrs_double) {
+  Arguments arg = setup_pptrs_arguments(GetParam());
+
+  rocblas_status status = testing_pptrf_pptrs<double,0>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(PackedChol, batched_pptrs_float) {
+  Arguments arg = setup_pptrs_arguments(GetParam());
+
+  rocblas_status status = testing_pptrf_pptrs<float,1>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(PackedChol, batched_pptrs_double) {
+  Arguments arg = setup_pptrs_arguments(GetParam());
+
+  rocblas_status status = testing_pptrf_pptrs<double,1>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(PackedChol, strided_batched_pptrs_float) {
+  Arguments arg = setup_pptrs_arguments(GetParam());
+
+  rocblas_status status = testing_pptrf_pptrs<float,2>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(PackedChol, strided_batched_pptrs_double) {
+  Arguments arg = setup_pptrs_arguments(GetParam());
+
+  rocblas_status status = testing_pptrf_pptrs<double,2>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, PackedChol,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(nrhs_range),
+                                ValuesIn(uplo_range)));
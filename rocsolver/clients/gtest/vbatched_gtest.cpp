@@ -0,0 +1,123 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_vbatched.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+typedef std::tuple<int, char> vbatched_tuple;
+
+// vector of int, each is the largest size N in the batch
+// (the other matrices have sizes N-13 and N-26)
+const vector<int> matrix_size_range = {
+    40, 150, 300
+};
+
+// vector of char, each is an uplo, which can be "Lower (L) or Upper (U)"
+// (only used by potrf)
+const vector<char> uplo_range = {'L', 'U'};
+
+Arguments setup_vbatched_arguments(vbatched_tuple tup)
+{
+  int matrix_size = std::get<0>(tup);
+  char uplo = std::get<1>(tup);
+
+  Arguments arg;
+
+  arg.N = matrix_size;
+
+  arg.uplo_option = uplo;
+
+  arg.timing = 0;
+  arg.batch_count = 7;
+
+  return arg;
+}
+
+class VBatched : public ::TestWithParam<vbatched_tuple> {
+protected:
+  VBatched() {}
+  virtual ~VBatched() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(VBatched, getrf_float) {
+  Arguments arg = setup_vbatched_arguments(GetParam());
+
+  rocblas_status status = testing_vbatched<float,float,VBATCHED_GETRF>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(VBatched, getrf_double) {
+  Arguments arg = setup_vbatched_arguments(GetParam());
+
+  rocblas_status status = testing_vbatched<double,double,VBATCHED_GETRF>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(VBatched, getrf_float_complex) {
+  Arguments arg = setup_vbatched_arguments(GetParam());
+
+  rocblas_status status = testing_vbatched<rocblas_float_complex,float,VBATCHED_GETRF>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(VBatched, getrf_double_complex) {
+  Arguments arg = setup_vbatched_arguments(GetParam());
+
+  rocblas_status status = testing_vbatched<rocblas_double_complex,double,VBATCHED_GETRF>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(VBatched, potrf_float) {
+  Arguments arg = setup_vbatched_arguments(GetParam());
+
+  rocblas_status status = testing_vbatched<float,float,VBATCHED_POTRF>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(VBatched, potrf_double) {
+  Arguments arg = setup_vbatched_arguments(GetParam());
+
+  rocblas_status status = testing_vbatched<double,double,VBATCHED_POTRF>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(VBatched, geqrf_float) {
+  Arguments arg = setup_vbatched_arguments(GetParam());
+
+  rocblas_status status = testing_vbatched<float,float,VBATCHED_GEQRF>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(VBatched, geqrf_double) {
+  Arguments arg = setup_vbatched_arguments(GetParam());
+
+  rocblas_status status = testing_vbatched<double,double,VBATCHED_GEQRF>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+INSTANTIATE_TEST_CASE_P(daily_lapack, VBatched,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(uplo_range)));
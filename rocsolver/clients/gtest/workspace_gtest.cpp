@@ -0,0 +1,92 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_workspace.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+
+typedef std::tuple<vector<int>, int> workspace_tuple;
+
+// vector of vector, each vector is a {M, lda};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range = {
+    {20, 20}, {70, 100}, {200, 200}
+};
+
+// each is a N
+const vector<int> n_size_range = {
+    16, 100, 300,
+};
+
+
+Arguments setup_arguments(workspace_tuple tup) {
+
+  vector<int> matrix_size = std::get<0>(tup);
+  int n_size = std::get<1>(tup);
+
+  Arguments arg;
+
+  arg.M = matrix_size[0];
+  arg.N = n_size;
+  arg.lda = matrix_size[1];
+
+  arg.timing = 0;
+
+  return arg;
+}
+
+class Workspace : public ::TestWithParam<workspace_tuple> {
+protected:
+  Workspace() {}
+  virtual ~Workspace() {}
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_P(Workspace, geqrf_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_workspace<float,0>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(Workspace, geqrf_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_workspace<double,0>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(Workspace, getrf_float) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_workspace<float,1>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+TEST_P(Workspace, getrf_double) {
+  Arguments arg = setup_arguments(GetParam());
+
+  rocblas_status status = testing_workspace<double,1>(arg);
+
+  EXPECT_EQ(rocblas_status_success, status);
+}
+
+INSTANTIATE_TEST_CASE_P(checkin_auxiliary, Workspace,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(n_size_range)));
@@ -33,6 +33,36 @@ inline rocblas_status rocsolver_laswp(rocblas_handle handle, rocblas_int n, rocb
   return rocsolver_zlaswp(handle,n,A,lda,k1,k2,ipiv,inc);
 }
 
+//lapmr
+
+template <typename T>
+inline rocblas_status rocsolver_lapmr(rocblas_handle handle, rocblas_direct direct, rocblas_int m, rocblas_int n,
+                                      T *X, rocblas_int ldx, rocblas_int *perm);
+
+template <>
+inline rocblas_status rocsolver_lapmr(rocblas_handle handle, rocblas_direct direct, rocblas_int m, rocblas_int n,
+                                      float *X, rocblas_int ldx, rocblas_int *perm) {
+  return rocsolver_slapmr(handle,direct,m,n,X,ldx,perm);
+}
+
+template <>
+inline rocblas_status rocsolver_lapmr(rocblas_handle handle, rocblas_direct direct, rocblas_int m, rocblas_int n,
+                                      double *X, rocblas_int ldx, rocblas_int *perm) {
+  return rocsolver_dlapmr(handle,direct,m,n,X,ldx,perm);
+}
+
+template <>
+inline rocblas_status rocsolver_lapmr(rocblas_handle handle, rocblas_direct direct, rocblas_int m, rocblas_int n,
+                                      rocblas_float_complex *X, rocblas_int ldx, rocblas_int *perm) {
+  return rocsolver_clapmr(handle,direct,m,n,X,ldx,perm);
+}
+
+template <>
+inline rocblas_status rocsolver_lapmr(rocblas_handle handle, rocblas_direct direct, rocblas_int m, rocblas_int n,
+                                      rocblas_double_complex *X, rocblas_int ldx, rocblas_int *perm) {
+  return rocsolver_zlapmr(handle,direct,m,n,X,ldx,perm);
+}
+
 //larfg
 
 template <typename T>
@@ -410,6 +440,24 @@ inline rocblas_status rocsolver_potrf_strided_batched(rocblas_handle handle, roc
   return rocsolver_dpotrf_strided_batched(handle, uplo, n, A, lda, strideA, info, batch_count);
 }
 
+//potrf_vbatched
+
+template <typename T>
+inline rocblas_status rocsolver_potrf_vbatched(rocblas_handle handle, rocblas_fill uplo,
+                                      const rocblas_int *n, T *const A[], const rocblas_int *lda, rocblas_int *info, rocblas_int batch_count);
+
+template <>
+inline rocblas_status rocsolver_potrf_vbatched(rocblas_handle handle, rocblas_fill uplo,
+                                      const rocblas_int *n, float *const A[], const rocblas_int *lda, rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_spotrf_vbatched(handle, uplo, n, A, lda, info, batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_potrf_vbatched(rocblas_handle handle, rocblas_fill uplo,
+                                      const rocblas_int *n, double *const A[], const rocblas_int *lda, rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_dpotrf_vbatched(handle, uplo, n, A, lda, info, batch_count);
+}
+
 //potrf_batched
 
 template <typename T>
@@ -641,6 +689,146 @@ inline rocblas_status rocsolver_getrf_strided_batched(rocblas_handle handle, roc
   return rocsolver_zgetrf_strided_batched(handle, m, n, A, lda, strideA, ipiv, stridep, info, batch_count);
 }
 
+//getrf_vbatched
+
+template <typename T>
+inline rocblas_status rocsolver_getrf_vbatched(rocblas_handle handle, const rocblas_int *m,
+                                      const rocblas_int *n, T *const A[], const rocblas_int *lda,
+                                      rocblas_int *const ipiv[], rocblas_int *info, rocblas_int batch_count);
+
+template <>
+inline rocblas_status rocsolver_getrf_vbatched(rocblas_handle handle, const rocblas_int *m,
+                                      const rocblas_int *n, float *const A[], const rocblas_int *lda,
+                                      rocblas_int *const ipiv[], rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_sgetrf_vbatched(handle, m, n, A, lda, ipiv, info, batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_vbatched(rocblas_handle handle, const rocblas_int *m,
+                                      const rocblas_int *n, double *const A[], const rocblas_int *lda,
+                                      rocblas_int *const ipiv[], rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_dgetrf_vbatched(handle, m, n, A, lda, ipiv, info, batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_vbatched(rocblas_handle handle, const rocblas_int *m,
+                                      const rocblas_int *n, rocblas_float_complex *const A[], const rocblas_int *lda,
+                                      rocblas_int *const ipiv[], rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_cgetrf_vbatched(handle, m, n, A, lda, ipiv, info, batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_vbatched(rocblas_handle handle, const rocblas_int *m,
+                                      const rocblas_int *n, rocblas_double_complex *const A[], const rocblas_int *lda,
+                                      rocblas_int *const ipiv[], rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_zgetrf_vbatched(handle, m, n, A, lda, ipiv, info, batch_count);
+}
+
+//getrf_npvt
+
+template <typename T>
+inline rocblas_status rocsolver_getrf_npvt(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, T *A, rocblas_int lda,
+                                      rocblas_int *info);
+
+template <>
+inline rocblas_status rocsolver_getrf_npvt(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, float *A, rocblas_int lda,
+                                      rocblas_int *info) {
+  return rocsolver_sgetrf_npvt(handle, m, n, A, lda, info);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_npvt(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, double *A, rocblas_int lda,
+                                      rocblas_int *info) {
+  return rocsolver_dgetrf_npvt(handle, m, n, A, lda, info);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_npvt(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, rocblas_float_complex *A, rocblas_int lda,
+                                      rocblas_int *info) {
+  return rocsolver_cgetrf_npvt(handle, m, n, A, lda, info);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_npvt(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, rocblas_double_complex *A, rocblas_int lda,
+                                      rocblas_int *info) {
+  return rocsolver_zgetrf_npvt(handle, m, n, A, lda, info);
+}
+
+//getrf_npvt_batched
+
+template <typename T>
+inline rocblas_status rocsolver_getrf_npvt_batched(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, T *const A[], rocblas_int lda,
+                                      rocblas_int *info, rocblas_int batch_count);
+
+template <>
+inline rocblas_status rocsolver_getrf_npvt_batched(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, float *const A[], rocblas_int lda,
+                                      rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_sgetrf_npvt_batched(handle, m, n, A, lda, info, batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_npvt_batched(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, double *const A[], rocblas_int lda,
+                                      rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_dgetrf_npvt_batched(handle, m, n, A, lda, info, batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_npvt_batched(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, rocblas_float_complex *const A[], rocblas_int lda,
+                                      rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_cgetrf_npvt_batched(handle, m, n, A, lda, info, batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_npvt_batched(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, rocblas_double_complex *const A[], rocblas_int lda,
+                                      rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_zgetrf_npvt_batched(handle, m, n, A, lda, info, batch_count);
+}
+
+//getrf_npvt_strided_batched
+
+template <typename T>
+inline rocblas_status rocsolver_getrf_npvt_strided_batched(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, T *A, rocblas_int lda, rocblas_int strideA,
+                                      rocblas_int *info, rocblas_int batch_count);
+
+template <>
+inline rocblas_status rocsolver_getrf_npvt_strided_batched(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, float *A, rocblas_int lda, rocblas_int strideA,
+                                      rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_sgetrf_npvt_strided_batched(handle, m, n, A, lda, strideA, info, batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_npvt_strided_batched(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, double *A, rocblas_int lda, rocblas_int strideA,
+                                      rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_dgetrf_npvt_strided_batched(handle, m, n, A, lda, strideA, info, batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_npvt_strided_batched(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, rocblas_float_complex *A, rocblas_int lda, rocblas_int strideA,
+                                      rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_cgetrf_npvt_strided_batched(handle, m, n, A, lda, strideA, info, batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_getrf_npvt_strided_batched(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, rocblas_double_complex *A, rocblas_int lda, rocblas_int strideA,
+                                      rocblas_int *info, rocblas_int batch_count) {
+  return rocsolver_zgetrf_npvt_strided_batched(handle, m, n, A, lda, strideA, info, batch_count);
+}
+
 //getrs
 
 template <typename T>
@@ -761,131 +949,1084 @@ rocsolver_getrs_strided_batched(rocblas_handle handle, rocblas_operation trans,
     return rocsolver_zgetrs_strided_batched(handle,trans,n,nrhs,A,lda,strideA,ipiv,strideP,B,ldb,strideB,batch_count);
 }
 
+//gbtrf
 
-//geqr2
+template <typename T>
+inline rocblas_status
+rocsolver_gbtrf(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int kl, rocblas_int ku, T *AB, rocblas_int ldab,
+                rocblas_int *ipiv, rocblas_int *info);
+
+template <>
+inline rocblas_status
+rocsolver_gbtrf(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int kl, rocblas_int ku, float *AB, rocblas_int ldab,
+                rocblas_int *ipiv, rocblas_int *info) {
+    return rocsolver_sgbtrf(handle,m,n,kl,ku,AB,ldab,ipiv,info);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gbtrf(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int kl, rocblas_int ku, double *AB, rocblas_int ldab,
+                rocblas_int *ipiv, rocblas_int *info) {
+    return rocsolver_dgbtrf(handle,m,n,kl,ku,AB,ldab,ipiv,info);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gbtrf(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int kl, rocblas_int ku, rocblas_float_complex *AB, rocblas_int ldab,
+                rocblas_int *ipiv, rocblas_int *info) {
+    return rocsolver_cgbtrf(handle,m,n,kl,ku,AB,ldab,ipiv,info);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gbtrf(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int kl, rocblas_int ku, rocblas_double_complex *AB, rocblas_int ldab,
+                rocblas_int *ipiv, rocblas_int *info) {
+    return rocsolver_zgbtrf(handle,m,n,kl,ku,AB,ldab,ipiv,info);
+}
+
+//gbtrf_batched
 
 template <typename T>
-inline rocblas_status rocsolver_geqr2(rocblas_handle handle, rocblas_int m,
-                                      rocblas_int n, T *A, rocblas_int lda,
-                                      T *ipiv);
+inline rocblas_status
+rocsolver_gbtrf_batched(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int kl, rocblas_int ku, T *const AB[], rocblas_int ldab,
+                rocblas_int *ipiv, rocblas_int strideP, rocblas_int *info, rocblas_int batch_count);
 
 template <>
-inline rocblas_status rocsolver_geqr2(rocblas_handle handle, rocblas_int m,
-                                      rocblas_int n, float *A, rocblas_int lda,
-                                      float *ipiv) {
-  return rocsolver_sgeqr2(handle, m, n, A, lda, ipiv);
+inline rocblas_status
+rocsolver_gbtrf_batched(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int kl, rocblas_int ku, float *const AB[], rocblas_int ldab,
+                rocblas_int *ipiv, rocblas_int strideP, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_sgbtrf_batched(handle,m,n,kl,ku,AB,ldab,ipiv,strideP,info,batch_count);
 }
 
 template <>
-inline rocblas_status rocsolver_geqr2(rocblas_handle handle, rocblas_int m,
-                                      rocblas_int n, double *A, rocblas_int lda,
-                                      double *ipiv) {
-  return rocsolver_dgeqr2(handle, m, n, A, lda, ipiv);
+inline rocblas_status
+rocsolver_gbtrf_batched(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int kl, rocblas_int ku, double *const AB[], rocblas_int ldab,
+                rocblas_int *ipiv, rocblas_int strideP, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_dgbtrf_batched(handle,m,n,kl,ku,AB,ldab,ipiv,strideP,info,batch_count);
 }
 
-//geqr2_batched
+template <>
+inline rocblas_status
+rocsolver_gbtrf_batched(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int kl, rocblas_int ku, rocblas_float_complex *const AB[], rocblas_int ldab,
+                rocblas_int *ipiv, rocblas_int strideP, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_cgbtrf_batched(handle,m,n,kl,ku,AB,ldab,ipiv,strideP,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gbtrf_batched(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int kl, rocblas_int ku, rocblas_double_complex *const AB[], rocblas_int ldab,
+                rocblas_int *ipiv, rocblas_int strideP, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_zgbtrf_batched(handle,m,n,kl,ku,AB,ldab,ipiv,strideP,info,batch_count);
+}
+
+//gbtrf_strided_batched
 
 template <typename T>
-inline rocblas_status rocsolver_geqr2_batched(rocblas_handle handle, rocblas_int m,
-                                      rocblas_int n, T *const A[], rocblas_int lda,
-                                      T *ipiv, rocblas_int stridep, rocblas_int batch_count);
+inline rocblas_status
+rocsolver_gbtrf_strided_batched(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int kl, rocblas_int ku, T *AB, rocblas_int ldab, rocblas_int strideA,
+                rocblas_int *ipiv, rocblas_int strideP, rocblas_int *info, rocblas_int batch_count);
 
 template <>
-inline rocblas_status rocsolver_geqr2_batched(rocblas_handle handle, rocblas_int m,
-                                      rocblas_int n, float *const A[], rocblas_int lda,
-                                      float *ipiv, rocblas_int stridep, rocblas_int batch_count) {
-  return rocsolver_sgeqr2_batched(handle, m, n, A, lda, ipiv, stridep, batch_count);
+inline rocblas_status
+rocsolver_gbtrf_strided_batched(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int kl, rocblas_int ku, float *AB, rocblas_int ldab, rocblas_int strideA,
+                rocblas_int *ipiv, rocblas_int strideP, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_sgbtrf_strided_batched(handle,m,n,kl,ku,AB,ldab,strideA,ipiv,strideP,info,batch_count);
 }
 
 template <>
-inline rocblas_status rocsolver_geqr2_batched(rocblas_handle handle, rocblas_int m,
-                                      rocblas_int n, double *const A[], rocblas_int lda,
-                                      double *ipiv, rocblas_int stridep, rocblas_int batch_count) {
-  return rocsolver_dgeqr2_batched(handle, m, n, A, lda, ipiv, stridep, batch_count);
+inline rocblas_status
+rocsolver_gbtrf_strided_batched(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int kl, rocblas_int ku, double *AB, rocblas_int ldab, rocblas_int strideA,
+                rocblas_int *ipiv, rocblas_int strideP, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_dgbtrf_strided_batched(handle,m,n,kl,ku,AB,ldab,strideA,ipiv,strideP,info,batch_count);
 }
 
-//geqr2_strided_batched
+template <>
+inline rocblas_status
+rocsolver_gbtrf_strided_batched(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int kl, rocblas_int ku, rocblas_float_complex *AB, rocblas_int ldab, rocblas_int strideA,
+                rocblas_int *ipiv, rocblas_int strideP, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_cgbtrf_strided_batched(handle,m,n,kl,ku,AB,ldab,strideA,ipiv,strideP,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gbtrf_strided_batched(rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int kl, rocblas_int ku, rocblas_double_complex *AB, rocblas_int ldab, rocblas_int strideA,
+                rocblas_int *ipiv, rocblas_int strideP, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_zgbtrf_strided_batched(handle,m,n,kl,ku,AB,ldab,strideA,ipiv,strideP,info,batch_count);
+}
+
+//gbtrs
 
 template <typename T>
-inline rocblas_status rocsolver_geqr2_strided_batched(rocblas_handle handle, rocblas_int m,
-                                      rocblas_int n, T *A, rocblas_int lda, rocblas_int strideA,
-                                      T *ipiv, rocblas_int stridep, rocblas_int batch_count);
+inline rocblas_status
+rocsolver_gbtrs(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int kl, rocblas_int ku,
+                rocblas_int nrhs, T *AB, rocblas_int ldab, rocblas_int *ipiv, T *B, rocblas_int ldb);
 
 template <>
-inline rocblas_status rocsolver_geqr2_strided_batched(rocblas_handle handle, rocblas_int m,
-                                      rocblas_int n, float *A, rocblas_int lda, rocblas_int strideA,
-                                      float *ipiv, rocblas_int stridep, rocblas_int batch_count) {
-  return rocsolver_sgeqr2_strided_batched(handle, m, n, A, lda, strideA, ipiv, stridep, batch_count);
+inline rocblas_status
+rocsolver_gbtrs(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int kl, rocblas_int ku,
+                rocblas_int nrhs, float *AB, rocblas_int ldab, rocblas_int *ipiv, float *B, rocblas_int ldb) {
+    return rocsolver_sgbtrs(handle,trans,n,kl,ku,nrhs,AB,ldab,ipiv,B,ldb);
 }
 
 template <>
-inline rocblas_status rocsolver_geqr2_strided_batched(rocblas_handle handle, rocblas_int m,
-                                      rocblas_int n, double *A, rocblas_int lda, rocblas_int strideA,
-                                      double *ipiv, rocblas_int stridep, rocblas_int batch_count) {
-  return rocsolver_dgeqr2_strided_batched(handle, m, n, A, lda, strideA, ipiv, stridep, batch_count);
+inline rocblas_status
+rocsolver_gbtrs(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int kl, rocblas_int ku,
+                rocblas_int nrhs, double *AB, rocblas_int ldab, rocblas_int *ipiv, double *B, rocblas_int ldb) {
+    return rocsolver_dgbtrs(handle,trans,n,kl,ku,nrhs,AB,ldab,ipiv,B,ldb);
 }
 
-//geqrf
+template <>
+inline rocblas_status
+rocsolver_gbtrs(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int kl, rocblas_int ku,
+                rocblas_int nrhs, rocblas_float_complex *AB, rocblas_int ldab, rocblas_int *ipiv, rocblas_float_complex *B, rocblas_int ldb) {
+    return rocsolver_cgbtrs(handle,trans,n,kl,ku,nrhs,AB,ldab,ipiv,B,ldb);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gbtrs(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int kl, rocblas_int ku,
+                rocblas_int nrhs, rocblas_double_complex *AB, rocblas_int ldab, rocblas_int *ipiv, rocblas_double_complex *B, rocblas_int ldb) {
+    return rocsolver_zgbtrs(handle,trans,n,kl,ku,nrhs,AB,ldab,ipiv,B,ldb);
+}
+
+//gbtrs_batched
 
 template <typename T>
-inline rocblas_status rocsolver_geqrf(rocblas_handle handle, rocblas_int m,
-                                      rocblas_int n, T *A, rocblas_int lda,
-                                      T *ipiv);
+inline rocblas_status
+rocsolver_gbtrs_batched(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int kl, rocblas_int ku,
+                rocblas_int nrhs, T *const AB[], rocblas_int ldab, rocblas_int *ipiv, rocblas_int strideP,
+                T *const B[], rocblas_int ldb, rocblas_int batch_count);
 
 template <>
-inline rocblas_status rocsolver_geqrf(rocblas_handle handle, rocblas_int m,
-                                      rocblas_int n, float *A, rocblas_int lda,
-                                      float *ipiv) {
-  return rocsolver_sgeqrf(handle, m, n, A, lda, ipiv);
+inline rocblas_status
+rocsolver_gbtrs_batched(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int kl, rocblas_int ku,
+                rocblas_int nrhs, float *const AB[], rocblas_int ldab, rocblas_int *ipiv, rocblas_int strideP,
+                float *const B[], rocblas_int ldb, rocblas_int batch_count) {
+    return rocsolver_sgbtrs_batched(handle,trans,n,kl,ku,nrhs,AB,ldab,ipiv,strideP,B,ldb,batch_count);
 }
 
 template <>
-inline rocblas_status rocsolver_geqrf(rocblas_handle handle, rocblas_int m,
-                                      rocblas_int n, double *A, rocblas_int lda,
-                                      double *ipiv) {
-  return rocsolver_dgeqrf(handle, m, n, A, lda, ipiv);
+inline rocblas_status
+rocsolver_gbtrs_batched(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int kl, rocblas_int ku,
+                rocblas_int nrhs, double *const AB[], rocblas_int ldab, rocblas_int *ipiv, rocblas_int strideP,
+                double *const B[], rocblas_int ldb, rocblas_int batch_count) {
+    return rocsolver_dgbtrs_batched(handle,trans,n,kl,ku,nrhs,AB,ldab,ipiv,strideP,B,ldb,batch_count);
 }
 
-//geqrf_batched
+template <>
+inline rocblas_status
+rocsolver_gbtrs_batched(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int kl, rocblas_int ku,
+                rocblas_int nrhs, rocblas_float_complex *const AB[], rocblas_int ldab, rocblas_int *ipiv, rocblas_int strideP,
+                rocblas_float_complex *const B[], rocblas_int ldb, rocblas_int batch_count) {
+    return rocsolver_cgbtrs_batched(handle,trans,n,kl,ku,nrhs,AB,ldab,ipiv,strideP,B,ldb,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gbtrs_batched(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int kl, rocblas_int ku,
+                rocblas_int nrhs, rocblas_double_complex *const AB[], rocblas_int ldab, rocblas_int *ipiv, rocblas_int strideP,
+                rocblas_double_complex *const B[], rocblas_int ldb, rocblas_int batch_count) {
+    return rocsolver_zgbtrs_batched(handle,trans,n,kl,ku,nrhs,AB,ldab,ipiv,strideP,B,ldb,batch_count);
+}
+
+//gbtrs_strided_batched
 
 template <typename T>
-inline rocblas_status rocsolver_geqrf_batched(rocblas_handle handle, rocblas_int m,
-                                      rocblas_int n, T *const A[], rocblas_int lda,
-                                      T *ipiv, rocblas_int stridep, rocblas_int batch_count);
+inline rocblas_status
+rocsolver_gbtrs_strided_batched(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int kl, rocblas_int ku,
+                rocblas_int nrhs, T *AB, rocblas_int ldab, rocblas_int strideA, rocblas_int *ipiv, rocblas_int strideP,
+                T *B, rocblas_int ldb, rocblas_int strideB, rocblas_int batch_count);
 
 template <>
-inline rocblas_status rocsolver_geqrf_batched(rocblas_handle handle, rocblas_int m,
-                                      rocblas_int n, float *const A[], rocblas_int lda,
-                                      float *ipiv, rocblas_int stridep, rocblas_int batch_count) {
-  return rocsolver_sgeqrf_batched(handle, m, n, A, lda, ipiv, stridep, batch_count);
+inline rocblas_status
+rocsolver_gbtrs_strided_batched(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int kl, rocblas_int ku,
+                rocblas_int nrhs, float *AB, rocblas_int ldab, rocblas_int strideA, rocblas_int *ipiv, rocblas_int strideP,
+                float *B, rocblas_int ldb, rocblas_int strideB, rocblas_int batch_count) {
+    return rocsolver_sgbtrs_strided_batched(handle,trans,n,kl,ku,nrhs,AB,ldab,strideA,ipiv,strideP,B,ldb,strideB,batch_count);
 }
 
 template <>
-inline rocblas_status rocsolver_geqrf_batched(rocblas_handle handle, rocblas_int m,
-                                      rocblas_int n, double *const A[], rocblas_int lda,
-                                      double *ipiv, rocblas_int stridep, rocblas_int batch_count) {
-  return rocsolver_dgeqrf_batched(handle, m, n, A, lda, ipiv, stridep, batch_count);
+inline rocblas_status
+rocsolver_gbtrs_strided_batched(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int kl, rocblas_int ku,
+                rocblas_int nrhs, double *AB, rocblas_int ldab, rocblas_int strideA, rocblas_int *ipiv, rocblas_int strideP,
+                double *B, rocblas_int ldb, rocblas_int strideB, rocblas_int batch_count) {
+    return rocsolver_dgbtrs_strided_batched(handle,trans,n,kl,ku,nrhs,AB,ldab,strideA,ipiv,strideP,B,ldb,strideB,batch_count);
 }
 
-//geqrf_strided_batched
+template <>
+inline rocblas_status
+rocsolver_gbtrs_strided_batched(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int kl, rocblas_int ku,
+                rocblas_int nrhs, rocblas_float_complex *AB, rocblas_int ldab, rocblas_int strideA, rocblas_int *ipiv, rocblas_int strideP,
+                rocblas_float_complex *B, rocblas_int ldb, rocblas_int strideB, rocblas_int batch_count) {
+    return rocsolver_cgbtrs_strided_batched(handle,trans,n,kl,ku,nrhs,AB,ldab,strideA,ipiv,strideP,B,ldb,strideB,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gbtrs_strided_batched(rocblas_handle handle, rocblas_operation trans, rocblas_int n, rocblas_int kl, rocblas_int ku,
+                rocblas_int nrhs, rocblas_double_complex *AB, rocblas_int ldab, rocblas_int strideA, rocblas_int *ipiv, rocblas_int strideP,
+                rocblas_double_complex *B, rocblas_int ldb, rocblas_int strideB, rocblas_int batch_count) {
+    return rocsolver_zgbtrs_strided_batched(handle,trans,n,kl,ku,nrhs,AB,ldab,strideA,ipiv,strideP,B,ldb,strideB,batch_count);
+}
+
+//gesv
 
 template <typename T>
-inline rocblas_status rocsolver_geqrf_strided_batched(rocblas_handle handle, rocblas_int m,
-                                      rocblas_int n, T *A, rocblas_int lda, rocblas_int strideA,
-                                      T *ipiv, rocblas_int stridep, rocblas_int batch_count);
+inline rocblas_status
+rocsolver_gesv(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, T *A, rocblas_int lda, rocblas_int *ipiv, T *B, rocblas_int ldb, rocblas_int *info);
 
 template <>
-inline rocblas_status rocsolver_geqrf_strided_batched(rocblas_handle handle, rocblas_int m,
-                                      rocblas_int n, float *A, rocblas_int lda, rocblas_int strideA,
-                                      float *ipiv, rocblas_int stridep, rocblas_int batch_count) {
-  return rocsolver_sgeqrf_strided_batched(handle, m, n, A, lda, strideA, ipiv, stridep, batch_count);
+inline rocblas_status
+rocsolver_gesv(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, float *A, rocblas_int lda, rocblas_int *ipiv, float *B, rocblas_int ldb, rocblas_int *info) {
+    return rocsolver_sgesv(handle,n,nrhs,A,lda,ipiv,B,ldb,info);
 }
 
 template <>
-inline rocblas_status rocsolver_geqrf_strided_batched(rocblas_handle handle, rocblas_int m,
-                                      rocblas_int n, double *A, rocblas_int lda, rocblas_int strideA,
-                                      double *ipiv, rocblas_int stridep, rocblas_int batch_count) {
-  return rocsolver_dgeqrf_strided_batched(handle, m, n, A, lda, strideA, ipiv, stridep, batch_count);
+inline rocblas_status
+rocsolver_gesv(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, double *A, rocblas_int lda, rocblas_int *ipiv, double *B, rocblas_int ldb, rocblas_int *info) {
+    return rocsolver_dgesv(handle,n,nrhs,A,lda,ipiv,B,ldb,info);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gesv(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, rocblas_float_complex *A, rocblas_int lda, rocblas_int *ipiv, rocblas_float_complex *B, rocblas_int ldb, rocblas_int *info) {
+    return rocsolver_cgesv(handle,n,nrhs,A,lda,ipiv,B,ldb,info);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gesv(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, rocblas_double_complex *A, rocblas_int lda, rocblas_int *ipiv, rocblas_double_complex *B, rocblas_int ldb, rocblas_int *info) {
+    return rocsolver_zgesv(handle,n,nrhs,A,lda,ipiv,B,ldb,info);
+}
+
+//gesv_batched
+
+template <typename T>
+inline rocblas_status
+rocsolver_gesv_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, T *const A[], rocblas_int lda, rocblas_int *ipiv, rocblas_int strideP,
+                T *const B[], rocblas_int ldb, rocblas_int *info, rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_gesv_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, float *const A[], rocblas_int lda, rocblas_int *ipiv, rocblas_int strideP,
+                float *const B[], rocblas_int ldb, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_sgesv_batched(handle,n,nrhs,A,lda,ipiv,strideP,B,ldb,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gesv_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, double *const A[], rocblas_int lda, rocblas_int *ipiv, rocblas_int strideP,
+                double *const B[], rocblas_int ldb, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_dgesv_batched(handle,n,nrhs,A,lda,ipiv,strideP,B,ldb,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gesv_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, rocblas_float_complex *const A[], rocblas_int lda, rocblas_int *ipiv, rocblas_int strideP,
+                rocblas_float_complex *const B[], rocblas_int ldb, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_cgesv_batched(handle,n,nrhs,A,lda,ipiv,strideP,B,ldb,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gesv_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, rocblas_double_complex *const A[], rocblas_int lda, rocblas_int *ipiv, rocblas_int strideP,
+                rocblas_double_complex *const B[], rocblas_int ldb, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_zgesv_batched(handle,n,nrhs,A,lda,ipiv,strideP,B,ldb,info,batch_count);
+}
+
+//gesv_strided_batched
+
+template <typename T>
+inline rocblas_status
+rocsolver_gesv_strided_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, T *A, rocblas_int lda, rocblas_int strideA, rocblas_int *ipiv, rocblas_int strideP,
+                T *B, rocblas_int ldb, rocblas_int strideB, rocblas_int *info, rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_gesv_strided_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, float *A, rocblas_int lda, rocblas_int strideA, rocblas_int *ipiv, rocblas_int strideP,
+                float *B, rocblas_int ldb, rocblas_int strideB, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_sgesv_strided_batched(handle,n,nrhs,A,lda,strideA,ipiv,strideP,B,ldb,strideB,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gesv_strided_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, double *A, rocblas_int lda, rocblas_int strideA, rocblas_int *ipiv, rocblas_int strideP,
+                double *B, rocblas_int ldb, rocblas_int strideB, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_dgesv_strided_batched(handle,n,nrhs,A,lda,strideA,ipiv,strideP,B,ldb,strideB,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gesv_strided_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, rocblas_float_complex *A, rocblas_int lda, rocblas_int strideA, rocblas_int *ipiv, rocblas_int strideP,
+                rocblas_float_complex *B, rocblas_int ldb, rocblas_int strideB, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_cgesv_strided_batched(handle,n,nrhs,A,lda,strideA,ipiv,strideP,B,ldb,strideB,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gesv_strided_batched(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, rocblas_double_complex *A, rocblas_int lda, rocblas_int strideA, rocblas_int *ipiv, rocblas_int strideP,
+                rocblas_double_complex *B, rocblas_int ldb, rocblas_int strideB, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_zgesv_strided_batched(handle,n,nrhs,A,lda,strideA,ipiv,strideP,B,ldb,strideB,info,batch_count);
+}
+
+//dsgesv and zcgesv
+
+template <typename T>
+inline rocblas_status
+rocsolver_gesv_mixed(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, T *A, rocblas_int lda, rocblas_int *ipiv,
+                T *B, rocblas_int ldb, T *X, rocblas_int ldx, rocblas_int *iter, rocblas_int *info);
+
+template <>
+inline rocblas_status
+rocsolver_gesv_mixed(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, double *A, rocblas_int lda, rocblas_int *ipiv,
+                double *B, rocblas_int ldb, double *X, rocblas_int ldx, rocblas_int *iter, rocblas_int *info) {
+    return rocsolver_dsgesv(handle,n,nrhs,A,lda,ipiv,B,ldb,X,ldx,iter,info);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gesv_mixed(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, rocblas_double_complex *A, rocblas_int lda, rocblas_int *ipiv,
+                rocblas_double_complex *B, rocblas_int ldb, rocblas_double_complex *X, rocblas_int ldx, rocblas_int *iter, rocblas_int *info) {
+    return rocsolver_zcgesv(handle,n,nrhs,A,lda,ipiv,B,ldb,X,ldx,iter,info);
+}
+
+//potrs
+
+template <typename T>
+inline rocblas_status
+rocsolver_potrs(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, T *A, rocblas_int lda, T *B, rocblas_int ldb);
+
+template <>
+inline rocblas_status
+rocsolver_potrs(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, float *A, rocblas_int lda, float *B, rocblas_int ldb) {
+    return rocsolver_spotrs(handle,uplo,n,nrhs,A,lda,B,ldb);
+}
+
+template <>
+inline rocblas_status
+rocsolver_potrs(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, double *A, rocblas_int lda, double *B, rocblas_int ldb) {
+    return rocsolver_dpotrs(handle,uplo,n,nrhs,A,lda,B,ldb);
+}
+
+//potrs_batched
+
+template <typename T>
+inline rocblas_status
+rocsolver_potrs_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, T *const A[], rocblas_int lda,
+                T *const B[], rocblas_int ldb, rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_potrs_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, float *const A[], rocblas_int lda,
+                float *const B[], rocblas_int ldb, rocblas_int batch_count) {
+    return rocsolver_spotrs_batched(handle,uplo,n,nrhs,A,lda,B,ldb,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_potrs_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, double *const A[], rocblas_int lda,
+                double *const B[], rocblas_int ldb, rocblas_int batch_count) {
+    return rocsolver_dpotrs_batched(handle,uplo,n,nrhs,A,lda,B,ldb,batch_count);
+}
+
+//potrs_strided_batched
+
+template <typename T>
+inline rocblas_status
+rocsolver_potrs_strided_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, T *A, rocblas_int lda, rocblas_int strideA,
+                T *B, rocblas_int ldb, rocblas_int strideB, rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_potrs_strided_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, float *A, rocblas_int lda, rocblas_int strideA,
+                float *B, rocblas_int ldb, rocblas_int strideB, rocblas_int batch_count) {
+    return rocsolver_spotrs_strided_batched(handle,uplo,n,nrhs,A,lda,strideA,B,ldb,strideB,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_potrs_strided_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, double *A, rocblas_int lda, rocblas_int strideA,
+                double *B, rocblas_int ldb, rocblas_int strideB, rocblas_int batch_count) {
+    return rocsolver_dpotrs_strided_batched(handle,uplo,n,nrhs,A,lda,strideA,B,ldb,strideB,batch_count);
+}
+
+//pptrf
+
+template <typename T>
+inline rocblas_status
+rocsolver_pptrf(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, T *AP, rocblas_int *info);
+
+template <>
+inline rocblas_status
+rocsolver_pptrf(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, float *AP, rocblas_int *info) {
+    return rocsolver_spptrf(handle,uplo,n,AP,info);
+}
+
+template <>
+inline rocblas_status
+rocsolver_pptrf(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, double *AP, rocblas_int *info) {
+    return rocsolver_dpptrf(handle,uplo,n,AP,info);
+}
+
+//pptrf_batched
+
+template <typename T>
+inline rocblas_status
+rocsolver_pptrf_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, T *const AP[], rocblas_int *info, rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_pptrf_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, float *const AP[], rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_spptrf_batched(handle,uplo,n,AP,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_pptrf_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, double *const AP[], rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_dpptrf_batched(handle,uplo,n,AP,info,batch_count);
+}
+
+//pptrf_strided_batched
+
+template <typename T>
+inline rocblas_status
+rocsolver_pptrf_strided_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, T *AP, rocblas_int strideA,
+                rocblas_int *info, rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_pptrf_strided_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, float *AP, rocblas_int strideA,
+                rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_spptrf_strided_batched(handle,uplo,n,AP,strideA,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_pptrf_strided_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, double *AP, rocblas_int strideA,
+                rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_dpptrf_strided_batched(handle,uplo,n,AP,strideA,info,batch_count);
+}
+
+//pptrs
+
+template <typename T>
+inline rocblas_status
+rocsolver_pptrs(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, T *AP, T *B, rocblas_int ldb);
+
+template <>
+inline rocblas_status
+rocsolver_pptrs(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, float *AP, float *B, rocblas_int ldb) {
+    return rocsolver_spptrs(handle,uplo,n,nrhs,AP,B,ldb);
+}
+
+template <>
+inline rocblas_status
+rocsolver_pptrs(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, double *AP, double *B, rocblas_int ldb) {
+    return rocsolver_dpptrs(handle,uplo,n,nrhs,AP,B,ldb);
+}
+
+//pptrs_batched
+
+template <typename T>
+inline rocblas_status
+rocsolver_pptrs_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, T *const AP[],
+                T *const B[], rocblas_int ldb, rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_pptrs_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, float *const AP[],
+                float *const B[], rocblas_int ldb, rocblas_int batch_count) {
+    return rocsolver_spptrs_batched(handle,uplo,n,nrhs,AP,B,ldb,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_pptrs_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, double *const AP[],
+                double *const B[], rocblas_int ldb, rocblas_int batch_count) {
+    return rocsolver_dpptrs_batched(handle,uplo,n,nrhs,AP,B,ldb,batch_count);
+}
+
+//pptrs_strided_batched
+
+template <typename T>
+inline rocblas_status
+rocsolver_pptrs_strided_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, T *AP, rocblas_int strideA,
+                T *B, rocblas_int ldb, rocblas_int strideB, rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_pptrs_strided_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, float *AP, rocblas_int strideA,
+                float *B, rocblas_int ldb, rocblas_int strideB, rocblas_int batch_count) {
+    return rocsolver_spptrs_strided_batched(handle,uplo,n,nrhs,AP,strideA,B,ldb,strideB,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_pptrs_strided_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, double *AP, rocblas_int strideA,
+                double *B, rocblas_int ldb, rocblas_int strideB, rocblas_int batch_count) {
+    return rocsolver_dpptrs_strided_batched(handle,uplo,n,nrhs,AP,strideA,B,ldb,strideB,batch_count);
+}
+
+//pbtrf
+
+template <typename T>
+inline rocblas_status
+rocsolver_pbtrf(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int kd, T *AB, rocblas_int ldab, rocblas_int *info);
+
+template <>
+inline rocblas_status
+rocsolver_pbtrf(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int kd, float *AB, rocblas_int ldab, rocblas_int *info) {
+    return rocsolver_spbtrf(handle,uplo,n,kd,AB,ldab,info);
+}
+
+template <>
+inline rocblas_status
+rocsolver_pbtrf(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int kd, double *AB, rocblas_int ldab, rocblas_int *info) {
+    return rocsolver_dpbtrf(handle,uplo,n,kd,AB,ldab,info);
+}
+
+//pbtrf_batched
+
+template <typename T>
+inline rocblas_status
+rocsolver_pbtrf_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int kd, T *const AB[], rocblas_int ldab,
+                rocblas_int *info, rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_pbtrf_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int kd, float *const AB[], rocblas_int ldab,
+                rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_spbtrf_batched(handle,uplo,n,kd,AB,ldab,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_pbtrf_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int kd, double *const AB[], rocblas_int ldab,
+                rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_dpbtrf_batched(handle,uplo,n,kd,AB,ldab,info,batch_count);
+}
+
+//pbtrf_strided_batched
+
+template <typename T>
+inline rocblas_status
+rocsolver_pbtrf_strided_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int kd, T *AB, rocblas_int ldab, rocblas_int strideA,
+                rocblas_int *info, rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_pbtrf_strided_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int kd, float *AB, rocblas_int ldab, rocblas_int strideA,
+                rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_spbtrf_strided_batched(handle,uplo,n,kd,AB,ldab,strideA,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_pbtrf_strided_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int kd, double *AB, rocblas_int ldab, rocblas_int strideA,
+                rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_dpbtrf_strided_batched(handle,uplo,n,kd,AB,ldab,strideA,info,batch_count);
+}
+
+//pbtrs
+
+template <typename T>
+inline rocblas_status
+rocsolver_pbtrs(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int kd, rocblas_int nrhs, T *AB, rocblas_int ldab,
+                T *B, rocblas_int ldb);
+
+template <>
+inline rocblas_status
+rocsolver_pbtrs(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int kd, rocblas_int nrhs, float *AB, rocblas_int ldab,
+                float *B, rocblas_int ldb) {
+    return rocsolver_spbtrs(handle,uplo,n,kd,nrhs,AB,ldab,B,ldb);
+}
+
+template <>
+inline rocblas_status
+rocsolver_pbtrs(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int kd, rocblas_int nrhs, double *AB, rocblas_int ldab,
+                double *B, rocblas_int ldb) {
+    return rocsolver_dpbtrs(handle,uplo,n,kd,nrhs,AB,ldab,B,ldb);
+}
+
+//pbtrs_batched
+
+template <typename T>
+inline rocblas_status
+rocsolver_pbtrs_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int kd, rocblas_int nrhs, T *const AB[], rocblas_int ldab,
+                T *const B[], rocblas_int ldb, rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_pbtrs_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int kd, rocblas_int nrhs, float *const AB[], rocblas_int ldab,
+                float *const B[], rocblas_int ldb, rocblas_int batch_count) {
+    return rocsolver_spbtrs_batched(handle,uplo,n,kd,nrhs,AB,ldab,B,ldb,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_pbtrs_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int kd, rocblas_int nrhs, double *const AB[], rocblas_int ldab,
+                double *const B[], rocblas_int ldb, rocblas_int batch_count) {
+    return rocsolver_dpbtrs_batched(handle,uplo,n,kd,nrhs,AB,ldab,B,ldb,batch_count);
+}
+
+//pbtrs_strided_batched
+
+template <typename T>
+inline rocblas_status
+rocsolver_pbtrs_strided_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int kd, rocblas_int nrhs, T *AB, rocblas_int ldab, rocblas_int strideA,
+                T *B, rocblas_int ldb, rocblas_int strideB, rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_pbtrs_strided_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int kd, rocblas_int nrhs, float *AB, rocblas_int ldab, rocblas_int strideA,
+                float *B, rocblas_int ldb, rocblas_int strideB, rocblas_int batch_count) {
+    return rocsolver_spbtrs_strided_batched(handle,uplo,n,kd,nrhs,AB,ldab,strideA,B,ldb,strideB,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_pbtrs_strided_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int kd, rocblas_int nrhs, double *AB, rocblas_int ldab, rocblas_int strideA,
+                double *B, rocblas_int ldb, rocblas_int strideB, rocblas_int batch_count) {
+    return rocsolver_dpbtrs_strided_batched(handle,uplo,n,kd,nrhs,AB,ldab,strideA,B,ldb,strideB,batch_count);
+}
+
+//posv
+
+template <typename T>
+inline rocblas_status
+rocsolver_posv(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, T *A, rocblas_int lda, T *B, rocblas_int ldb, rocblas_int *info);
+
+template <>
+inline rocblas_status
+rocsolver_posv(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, float *A, rocblas_int lda, float *B, rocblas_int ldb, rocblas_int *info) {
+    return rocsolver_sposv(handle,uplo,n,nrhs,A,lda,B,ldb,info);
+}
+
+template <>
+inline rocblas_status
+rocsolver_posv(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, double *A, rocblas_int lda, double *B, rocblas_int ldb, rocblas_int *info) {
+    return rocsolver_dposv(handle,uplo,n,nrhs,A,lda,B,ldb,info);
+}
+
+//posv_batched
+
+template <typename T>
+inline rocblas_status
+rocsolver_posv_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, T *const A[], rocblas_int lda,
+                T *const B[], rocblas_int ldb, rocblas_int *info, rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_posv_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, float *const A[], rocblas_int lda,
+                float *const B[], rocblas_int ldb, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_sposv_batched(handle,uplo,n,nrhs,A,lda,B,ldb,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_posv_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, double *const A[], rocblas_int lda,
+                double *const B[], rocblas_int ldb, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_dposv_batched(handle,uplo,n,nrhs,A,lda,B,ldb,info,batch_count);
+}
+
+//posv_strided_batched
+
+template <typename T>
+inline rocblas_status
+rocsolver_posv_strided_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, T *A, rocblas_int lda, rocblas_int strideA,
+                T *B, rocblas_int ldb, rocblas_int strideB, rocblas_int *info, rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_posv_strided_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, float *A, rocblas_int lda, rocblas_int strideA,
+                float *B, rocblas_int ldb, rocblas_int strideB, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_sposv_strided_batched(handle,uplo,n,nrhs,A,lda,strideA,B,ldb,strideB,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_posv_strided_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, rocblas_int nrhs, double *A, rocblas_int lda, rocblas_int strideA,
+                double *B, rocblas_int ldb, rocblas_int strideB, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_dposv_strided_batched(handle,uplo,n,nrhs,A,lda,strideA,B,ldb,strideB,info,batch_count);
+}
+
+//getri
+
+template <typename T>
+inline rocblas_status
+rocsolver_getri(rocblas_handle handle, rocblas_int n, T *A, rocblas_int lda, rocblas_int *ipiv, rocblas_int *info);
+
+template <>
+inline rocblas_status
+rocsolver_getri(rocblas_handle handle, rocblas_int n, float *A, rocblas_int lda, rocblas_int *ipiv, rocblas_int *info) {
+    return rocsolver_sgetri(handle,n,A,lda,ipiv,info);
+}
+
+template <>
+inline rocblas_status
+rocsolver_getri(rocblas_handle handle, rocblas_int n, double *A, rocblas_int lda, rocblas_int *ipiv, rocblas_int *info) {
+    return rocsolver_dgetri(handle,n,A,lda,ipiv,info);
+}
+
+template <>
+inline rocblas_status
+rocsolver_getri(rocblas_handle handle, rocblas_int n, rocblas_float_complex *A, rocblas_int lda, rocblas_int *ipiv, rocblas_int *info) {
+    return rocsolver_cgetri(handle,n,A,lda,ipiv,info);
+}
+
+template <>
+inline rocblas_status
+rocsolver_getri(rocblas_handle handle, rocblas_int n, rocblas_double_complex *A, rocblas_int lda, rocblas_int *ipiv, rocblas_int *info) {
+    return rocsolver_zgetri(handle,n,A,lda,ipiv,info);
+}
+
+//getri_outofplace_batched
+
+template <typename T>
+inline rocblas_status
+rocsolver_getri_outofplace_batched(rocblas_handle handle, rocblas_int n, T *const A[], rocblas_int lda,
+                rocblas_int *ipiv, rocblas_int strideP, T *const C[], rocblas_int ldc, rocblas_int *info, rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_getri_outofplace_batched(rocblas_handle handle, rocblas_int n, float *const A[], rocblas_int lda,
+                rocblas_int *ipiv, rocblas_int strideP, float *const C[], rocblas_int ldc, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_sgetri_outofplace_batched(handle,n,A,lda,ipiv,strideP,C,ldc,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_getri_outofplace_batched(rocblas_handle handle, rocblas_int n, double *const A[], rocblas_int lda,
+                rocblas_int *ipiv, rocblas_int strideP, double *const C[], rocblas_int ldc, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_dgetri_outofplace_batched(handle,n,A,lda,ipiv,strideP,C,ldc,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_getri_outofplace_batched(rocblas_handle handle, rocblas_int n, rocblas_float_complex *const A[], rocblas_int lda,
+                rocblas_int *ipiv, rocblas_int strideP, rocblas_float_complex *const C[], rocblas_int ldc, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_cgetri_outofplace_batched(handle,n,A,lda,ipiv,strideP,C,ldc,info,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_getri_outofplace_batched(rocblas_handle handle, rocblas_int n, rocblas_double_complex *const A[], rocblas_int lda,
+                rocblas_int *ipiv, rocblas_int strideP, rocblas_double_complex *const C[], rocblas_int ldc, rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_zgetri_outofplace_batched(handle,n,A,lda,ipiv,strideP,C,ldc,info,batch_count);
+}
+
+
+//gecon
+
+template <typename T, typename S>
+inline rocblas_status
+rocsolver_gecon(rocblas_handle handle, rocblas_int n, T *A, rocblas_int lda, S *anorm, S *rcond);
+
+template <>
+inline rocblas_status
+rocsolver_gecon(rocblas_handle handle, rocblas_int n, float *A, rocblas_int lda, float *anorm, float *rcond) {
+    return rocsolver_sgecon(handle,n,A,lda,anorm,rcond);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gecon(rocblas_handle handle, rocblas_int n, double *A, rocblas_int lda, double *anorm, double *rcond) {
+    return rocsolver_dgecon(handle,n,A,lda,anorm,rcond);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gecon(rocblas_handle handle, rocblas_int n, rocblas_float_complex *A, rocblas_int lda, float *anorm, float *rcond) {
+    return rocsolver_cgecon(handle,n,A,lda,anorm,rcond);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gecon(rocblas_handle handle, rocblas_int n, rocblas_double_complex *A, rocblas_int lda, double *anorm, double *rcond) {
+    return rocsolver_zgecon(handle,n,A,lda,anorm,rcond);
+}
+
+
+//gecon_batched
+
+template <typename T, typename S>
+inline rocblas_status
+rocsolver_gecon_batched(rocblas_handle handle, rocblas_int n, T *const A[], rocblas_int lda,
+                S *anorm, S *rcond, rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_gecon_batched(rocblas_handle handle, rocblas_int n, float *const A[], rocblas_int lda,
+                float *anorm, float *rcond, rocblas_int batch_count) {
+    return rocsolver_sgecon_batched(handle,n,A,lda,anorm,rcond,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gecon_batched(rocblas_handle handle, rocblas_int n, double *const A[], rocblas_int lda,
+                double *anorm, double *rcond, rocblas_int batch_count) {
+    return rocsolver_dgecon_batched(handle,n,A,lda,anorm,rcond,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gecon_batched(rocblas_handle handle, rocblas_int n, rocblas_float_complex *const A[], rocblas_int lda,
+                float *anorm, float *rcond, rocblas_int batch_count) {
+    return rocsolver_cgecon_batched(handle,n,A,lda,anorm,rcond,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gecon_batched(rocblas_handle handle, rocblas_int n, rocblas_double_complex *const A[], rocblas_int lda,
+                double *anorm, double *rcond, rocblas_int batch_count) {
+    return rocsolver_zgecon_batched(handle,n,A,lda,anorm,rcond,batch_count);
+}
+
+
+//gecon_strided_batched
+
+template <typename T, typename S>
+inline rocblas_status
+rocsolver_gecon_strided_batched(rocblas_handle handle, rocblas_int n, T *A, rocblas_int lda, rocblas_int strideA,
+                S *anorm, S *rcond, rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_gecon_strided_batched(rocblas_handle handle, rocblas_int n, float *A, rocblas_int lda, rocblas_int strideA,
+                float *anorm, float *rcond, rocblas_int batch_count) {
+    return rocsolver_sgecon_strided_batched(handle,n,A,lda,strideA,anorm,rcond,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gecon_strided_batched(rocblas_handle handle, rocblas_int n, double *A, rocblas_int lda, rocblas_int strideA,
+                double *anorm, double *rcond, rocblas_int batch_count) {
+    return rocsolver_dgecon_strided_batched(handle,n,A,lda,strideA,anorm,rcond,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gecon_strided_batched(rocblas_handle handle, rocblas_int n, rocblas_float_complex *A, rocblas_int lda, rocblas_int strideA,
+                float *anorm, float *rcond, rocblas_int batch_count) {
+    return rocsolver_cgecon_strided_batched(handle,n,A,lda,strideA,anorm,rcond,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_gecon_strided_batched(rocblas_handle handle, rocblas_int n, rocblas_double_complex *A, rocblas_int lda, rocblas_int strideA,
+                double *anorm, double *rcond, rocblas_int batch_count) {
+    return rocsolver_zgecon_strided_batched(handle,n,A,lda,strideA,anorm,rcond,batch_count);
+}
+
+
+//pocon
+
+template <typename T, typename S>
+inline rocblas_status
+rocsolver_pocon(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, T *A, rocblas_int lda, S *anorm, S *rcond);
+
+template <>
+inline rocblas_status
+rocsolver_pocon(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, float *A, rocblas_int lda, float *anorm, float *rcond) {
+    return rocsolver_spocon(handle,uplo,n,A,lda,anorm,rcond);
+}
+
+template <>
+inline rocblas_status
+rocsolver_pocon(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, double *A, rocblas_int lda, double *anorm, double *rcond) {
+    return rocsolver_dpocon(handle,uplo,n,A,lda,anorm,rcond);
+}
+
+
+//pocon_batched
+
+template <typename T, typename S>
+inline rocblas_status
+rocsolver_pocon_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, T *const A[], rocblas_int lda,
+                S *anorm, S *rcond, rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_pocon_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, float *const A[], rocblas_int lda,
+                float *anorm, float *rcond, rocblas_int batch_count) {
+    return rocsolver_spocon_batched(handle,uplo,n,A,lda,anorm,rcond,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_pocon_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, double *const A[], rocblas_int lda,
+                double *anorm, double *rcond, rocblas_int batch_count) {
+    return rocsolver_dpocon_batched(handle,uplo,n,A,lda,anorm,rcond,batch_count);
+}
+
+
+//pocon_strided_batched
+
+template <typename T, typename S>
+inline rocblas_status
+rocsolver_pocon_strided_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, T *A, rocblas_int lda, rocblas_int strideA,
+                S *anorm, S *rcond, rocblas_int batch_count);
+
+template <>
+inline rocblas_status
+rocsolver_pocon_strided_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, float *A, rocblas_int lda, rocblas_int strideA,
+                float *anorm, float *rcond, rocblas_int batch_count) {
+    return rocsolver_spocon_strided_batched(handle,uplo,n,A,lda,strideA,anorm,rcond,batch_count);
+}
+
+template <>
+inline rocblas_status
+rocsolver_pocon_strided_batched(rocblas_handle handle, rocblas_fill uplo, rocblas_int n, double *A, rocblas_int lda, rocblas_int strideA,
+                double *anorm, double *rcond, rocblas_int batch_count) {
+    return rocsolver_dpocon_strided_batched(handle,uplo,n,A,lda,strideA,anorm,rcond,batch_count);
+}
+
+
+//geqr2
+
+template <typename T>
+inline rocblas_status rocsolver_geqr2(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, T *A, rocblas_int lda,
+                                      T *ipiv);
+
+template <>
+inline rocblas_status rocsolver_geqr2(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, float *A, rocblas_int lda,
+                                      float *ipiv) {
+  return rocsolver_sgeqr2(handle, m, n, A, lda, ipiv);
+}
+
+template <>
+inline rocblas_status rocsolver_geqr2(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, double *A, rocblas_int lda,
+                                      double *ipiv) {
+  return rocsolver_dgeqr2(handle, m, n, A, lda, ipiv);
+}
+
+//geqr2_batched
+
+template <typename T>
+inline rocblas_status rocsolver_geqr2_batched(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, T *const A[], rocblas_int lda,
+                                      T *ipiv, rocblas_int stridep, rocblas_int batch_count);
+
+template <>
+inline rocblas_status rocsolver_geqr2_batched(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, float *const A[], rocblas_int lda,
+                                      float *ipiv, rocblas_int stridep, rocblas_int batch_count) {
+  return rocsolver_sgeqr2_batched(handle, m, n, A, lda, ipiv, stridep, batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_geqr2_batched(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, double *const A[], rocblas_int lda,
+                                      double *ipiv, rocblas_int stridep, rocblas_int batch_count) {
+  return rocsolver_dgeqr2_batched(handle, m, n, A, lda, ipiv, stridep, batch_count);
+}
+
+//geqr2_strided_batched
+
+template <typename T>
+inline rocblas_status rocsolver_geqr2_strided_batched(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, T *A, rocblas_int lda, rocblas_int strideA,
+                                      T *ipiv, rocblas_int stridep, rocblas_int batch_count);
+
+template <>
+inline rocblas_status rocsolver_geqr2_strided_batched(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, float *A, rocblas_int lda, rocblas_int strideA,
+                                      float *ipiv, rocblas_int stridep, rocblas_int batch_count) {
+  return rocsolver_sgeqr2_strided_batched(handle, m, n, A, lda, strideA, ipiv, stridep, batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_geqr2_strided_batched(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, double *A, rocblas_int lda, rocblas_int strideA,
+                                      double *ipiv, rocblas_int stridep, rocblas_int batch_count) {
+  return rocsolver_dgeqr2_strided_batched(handle, m, n, A, lda, strideA, ipiv, stridep, batch_count);
+}
+
+//geqrf
+
+template <typename T>
+inline rocblas_status rocsolver_geqrf(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, T *A, rocblas_int lda,
+                                      T *ipiv);
+
+template <>
+inline rocblas_status rocsolver_geqrf(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, float *A, rocblas_int lda,
+                                      float *ipiv) {
+  return rocsolver_sgeqrf(handle, m, n, A, lda, ipiv);
+}
+
+template <>
+inline rocblas_status rocsolver_geqrf(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, double *A, rocblas_int lda,
+                                      double *ipiv) {
+  return rocsolver_dgeqrf(handle, m, n, A, lda, ipiv);
+}
+
+//geqrf_batched
+
+template <typename T>
+inline rocblas_status rocsolver_geqrf_batched(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, T *const A[], rocblas_int lda,
+                                      T *ipiv, rocblas_int stridep, rocblas_int batch_count);
+
+template <>
+inline rocblas_status rocsolver_geqrf_batched(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, float *const A[], rocblas_int lda,
+                                      float *ipiv, rocblas_int stridep, rocblas_int batch_count) {
+  return rocsolver_sgeqrf_batched(handle, m, n, A, lda, ipiv, stridep, batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_geqrf_batched(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, double *const A[], rocblas_int lda,
+                                      double *ipiv, rocblas_int stridep, rocblas_int batch_count) {
+  return rocsolver_dgeqrf_batched(handle, m, n, A, lda, ipiv, stridep, batch_count);
+}
+
+//geqrf_strided_batched
+
+template <typename T>
+inline rocblas_status rocsolver_geqrf_strided_batched(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, T *A, rocblas_int lda, rocblas_int strideA,
+                                      T *ipiv, rocblas_int stridep, rocblas_int batch_count);
+
+template <>
+inline rocblas_status rocsolver_geqrf_strided_batched(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, float *A, rocblas_int lda, rocblas_int strideA,
+                                      float *ipiv, rocblas_int stridep, rocblas_int batch_count) {
+  return rocsolver_sgeqrf_strided_batched(handle, m, n, A, lda, strideA, ipiv, stridep, batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_geqrf_strided_batched(rocblas_handle handle, rocblas_int m,
+                                      rocblas_int n, double *A, rocblas_int lda, rocblas_int strideA,
+                                      double *ipiv, rocblas_int stridep, rocblas_int batch_count) {
+  return rocsolver_dgeqrf_strided_batched(handle, m, n, A, lda, strideA, ipiv, stridep, batch_count);
+}
+
+//geqrf_vbatched
+
+template <typename T>
+inline rocblas_status rocsolver_geqrf_vbatched(rocblas_handle handle, const rocblas_int *m,
+                                      const rocblas_int *n, T *const A[], const rocblas_int *lda,
+                                      T *const ipiv[], rocblas_int batch_count);
+
+template <>
+inline rocblas_status rocsolver_geqrf_vbatched(rocblas_handle handle, const rocblas_int *m,
+                                      const rocblas_int *n, float *const A[], const rocblas_int *lda,
+                                      float *const ipiv[], rocblas_int batch_count) {
+  return rocsolver_sgeqrf_vbatched(handle, m, n, A, lda, ipiv, batch_count);
+}
+
+template <>
+inline rocblas_status rocsolver_geqrf_vbatched(rocblas_handle handle, const rocblas_int *m,
+                                      const rocblas_int *n, double *const A[], const rocblas_int *lda,
+                                      double *const ipiv[], rocblas_int batch_count) {
+  return rocsolver_dgeqrf_vbatched(handle, m, n, A, lda, ipiv, batch_count);
 }
 
 //gelq2
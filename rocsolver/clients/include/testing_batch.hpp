@@ -0,0 +1,75 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _TESTING_BATCH_HPP
+#define _TESTING_BATCH_HPP
+
+#include <algorithm>
+#include <vector>
+
+#include "rocblas_test_unique_ptr.hpp"
+#include "utility.h"
+
+/*!\file
+ * \brief device data shared by the tests of the solvers that run in mode 0 (normal),
+ * 1 (batched) or 2 (strided_batched).
+ */
+
+/*! \brief batch_count matrices A (strideA entries apart) and right hand sides B (strideB entries
+ * apart) stored contiguously on the device, the arrays of pointers to them used by the batched
+ * functions, the pivots (strideP entries per matrix) and the info of every matrix.
+ * Check valid() after construction. */
+template <typename T>
+struct testing_batch
+{
+    rocblas_int strideA, strideB, strideP, batch_count;
+    rocblas_unique_ptr A_managed, B_managed, ipiv_managed, info_managed, Aarr_managed, Barr_managed;
+    T *A, *B;
+    T **Aarr, **Barr;
+    rocblas_int *ipiv, *info;
+
+    testing_batch(rocblas_int strideA, rocblas_int strideB, rocblas_int strideP, rocblas_int batch_count)
+        : strideA(strideA), strideB(strideB), strideP(strideP), batch_count(batch_count),
+          A_managed(rocblas_test::device_malloc(sizeof(T) * strideA * batch_count), rocblas_test::device_free),
+          B_managed(rocblas_test::device_malloc(sizeof(T) * strideB * batch_count), rocblas_test::device_free),
+          ipiv_managed(rocblas_test::device_malloc(sizeof(int) * std::max(strideP, 1) * batch_count), rocblas_test::device_free),
+          info_managed(rocblas_test::device_malloc(sizeof(int) * batch_count), rocblas_test::device_free),
+          Aarr_managed(rocblas_test::device_malloc(sizeof(T*) * batch_count), rocblas_test::device_free),
+          Barr_managed(rocblas_test::device_malloc(sizeof(T*) * batch_count), rocblas_test::device_free)
+    {
+        A = (T *)A_managed.get();
+        B = (T *)B_managed.get();
+        ipiv = (rocblas_int *)ipiv_managed.get();
+        info = (rocblas_int *)info_managed.get();
+        Aarr = (T **)Aarr_managed.get();
+        Barr = (T **)Barr_managed.get();
+    }
+
+    /*! \brief false if an allocation failed */
+    bool valid() const { return A && B && ipiv && info && Aarr && Barr; }
+
+    /*! \brief copies hA and hB (stored with the same strides) to the device and sets the pointer arrays */
+    void upload(const T *hA, const T *hB)
+    {
+        std::vector<T*> pA(batch_count), pB(batch_count);
+        for (int b = 0; b < batch_count; ++b) {
+            pA[b] = A + b * strideA;
+            pB[b] = B + b * strideB;
+        }
+        CHECK_HIP_ERROR(hipMemcpy(A, hA, sizeof(T) * strideA * batch_count, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(B, hB, sizeof(T) * strideB * batch_count, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(Aarr, pA.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(Barr, pB.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    }
+
+    /*! \brief copies the solutions B and the info back to the host */
+    void download(T *hX, int *hinfo)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(hX, B, sizeof(T) * strideB * batch_count, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hinfo, info, sizeof(int) * batch_count, hipMemcpyDeviceToHost));
+    }
+};
+
+#endif
@@ -0,0 +1,176 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER element of the factors (relative to the factors computed without early exit)
+#define ERROR_EPS_MULTIPLIER 6000
+
+using namespace std;
+
+// getrf_strided_batched
+template <typename T>
+rocblas_status factorize_batch(std::false_type, rocblas_handle handle, rocblas_fill uplo, rocblas_int N,
+                               T *dA, rocblas_int lda, rocblas_int strideA, rocblas_int *dIpiv, rocblas_int strideP,
+                               rocblas_int *dinfo, rocblas_int batch_count) {
+    return rocsolver_getrf_strided_batched<T>(handle, N, N, dA, lda, strideA, dIpiv, strideP, dinfo, batch_count);
+}
+
+// potrf_strided_batched
+template <typename T>
+rocblas_status factorize_batch(std::true_type, rocblas_handle handle, rocblas_fill uplo, rocblas_int N,
+                               T *dA, rocblas_int lda, rocblas_int strideA, rocblas_int *dIpiv, rocblas_int strideP,
+                               rocblas_int *dinfo, rocblas_int batch_count) {
+    return rocsolver_potrf_strided_batched<T>(handle, uplo, N, dA, lda, strideA, dinfo, batch_count);
+}
+
+// Factorizes a batch with getrf (PO = false) or potrf (PO = true) without and with early exit.
+// Every other matrix of the batch fails at column N/2 (a zero column for getrf, a negative diagonal
+// element for potrf). Both runs must return the same info, and the same factors (and pivots) for the
+// matrices that do not fail.
+template <typename T, typename U, bool PO>
+rocblas_status testing_early_exit(Arguments argus) {
+    rocblas_int N = argus.N;
+    rocblas_int lda = argus.lda;
+    char char_uplo = argus.uplo_option;
+    rocblas_fill uplo = char2rocblas_fill(char_uplo);
+    rocblas_int batch_count = argus.batch_count;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // check invalid arguments
+    if (N < 1 || lda < N || batch_count < 1)
+        return rocblas_status_invalid_size;
+
+    rocblas_int size_A = lda * N;
+    rocblas_int strideA = size_A;
+    rocblas_int strideP = N;
+    rocblas_int k = N / 2;      //column where the failing matrices fail
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A * batch_count);
+    vector<T> hA1(size_A * batch_count);
+    vector<T> hA2(size_A * batch_count);
+    vector<T> hW(size_A);
+    vector<int> hIpiv1(strideP * batch_count);
+    vector<int> hIpiv2(strideP * batch_count);
+    vector<int> hinfo1(batch_count);
+    vector<int> hinfo2(batch_count);
+
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A * batch_count), rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    auto dIpiv_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * strideP * batch_count), rocblas_test::device_free};
+    rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+    auto dinfo_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * batch_count), rocblas_test::device_free};
+    rocblas_int *dinfo = (rocblas_int *)dinfo_managed.get();
+
+    if (!dA || !dIpiv || !dinfo) {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    //initialize full random matrices hA with all entries in [1, 10]. For getrf hA has a dominant
+    //diagonal, for potrf it is made symmetric positive definite as in the potrf tests
+    for (int b = 0; b < batch_count; ++b) {
+        T *a = hA.data() + b * strideA;
+        rocblas_init<T>(a, N, N, lda);
+        if (PO) {
+            for (int i = 0; i < N; i++) {
+                for (int j = 0; j < N; j++)
+                    hW[i + j * lda] = (a[i + j * lda] - T(1)) / T(10);
+            }
+            cblas_gemm(rocblas_operation_none, rocblas_operation_transpose, N, N, N,
+                       (T)1.0, hW.data(), lda, hW.data(), lda, (T)0.0, a, lda);
+            for (int i = 0; i < N; i++)
+                a[i + i * lda] += 1;
+        }
+        else {
+            for (int i = 0; i < N; i++)
+                a[i + i * lda] += 400;
+        }
+
+        // failing matrices
+        if (b % 2) {
+            if (PO)
+                a[k + k * lda] = -1;
+            else {
+                for (int i = 0; i < N; i++)
+                    a[i + k * lda] = 0;
+            }
+        }
+    }
+
+/* =====================================================================
+           ROCSOLVER
+    =================================================================== */
+    // reference: without early exit
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A * batch_count, hipMemcpyHostToDevice));
+    CHECK_ROCBLAS_ERROR(factorize_batch<T>(std::integral_constant<bool,PO>(), handle, uplo, N, dA, lda, strideA,
+                                           dIpiv, strideP, dinfo, batch_count));
+    CHECK_HIP_ERROR(hipMemcpy(hA1.data(), dA, sizeof(T) * size_A * batch_count, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hIpiv1.data(), dIpiv, sizeof(int) * strideP * batch_count, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hinfo1.data(), dinfo, sizeof(int) * batch_count, hipMemcpyDeviceToHost));
+
+    // with early exit
+    CHECK_ROCBLAS_ERROR(rocsolver_set_early_exit(handle, 1));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A * batch_count, hipMemcpyHostToDevice));
+    CHECK_ROCBLAS_ERROR(factorize_batch<T>(std::integral_constant<bool,PO>(), handle, uplo, N, dA, lda, strideA,
+                                           dIpiv, strideP, dinfo, batch_count));
+    CHECK_HIP_ERROR(hipMemcpy(hA2.data(), dA, sizeof(T) * size_A * batch_count, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hIpiv2.data(), dIpiv, sizeof(int) * strideP * batch_count, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hinfo2.data(), dinfo, sizeof(int) * batch_count, hipMemcpyDeviceToHost));
+
+    // +++++++++ Error Check +++++++++++++
+    double eps = std::numeric_limits<U>::epsilon();
+    double max_err_1 = 0.0, max_val = 0.0;
+    double diff;
+    for (int b = 0; b < batch_count; ++b) {
+        EXPECT_EQ(hinfo1[b], hinfo2[b]);
+        if (b % 2) {
+            EXPECT_EQ(hinfo2[b], k + 1);
+            continue;
+        }
+        EXPECT_EQ(hinfo2[b], 0);
+
+        // only the triangle of the factor is referenced by potrf
+        for (int i = 0; i < N; i++) {
+            for (int j = 0; j < N; j++) {
+                if (PO && (uplo == rocblas_fill_lower ? i < j : i > j))
+                    continue;
+                rocblas_int e = b * strideA + i + j * lda;
+                diff = abs(hA1[e]);
+                max_val = max_val > diff ? max_val : diff;
+                diff = abs(hA2[e] - hA1[e]);
+                max_err_1 = max_err_1 > diff ? max_err_1 : diff;
+            }
+            if (!PO)
+                EXPECT_EQ(hIpiv1[b * strideP + i], hIpiv2[b * strideP + i]);
+        }
+    }
+    max_err_1 = max_err_1 / max_val;
+    getf2_err_res_check<U>(max_err_1, N, N, ERROR_EPS_MULTIPLIER, eps);
+
+    return rocblas_status_success;
+}
+
+#undef ERROR_EPS_MULTIPLIER
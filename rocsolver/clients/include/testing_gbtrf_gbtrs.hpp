@@ -0,0 +1,177 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdexcept>
+#include <stdlib.h>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "testing_batch.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER element of the solution X (relative to the size of X)
+#define ERROR_EPS_MULTIPLIER 6000
+
+using namespace std;
+
+// gbtrf + gbtrs
+template <typename T, int mode>
+rocblas_status gbtrf_gbtrs_solve(rocblas_handle handle, rocblas_operation trans, rocblas_int N, rocblas_int kl, rocblas_int ku,
+                                 rocblas_int nrhs, testing_batch<T> &d, rocblas_int ldab, rocblas_int ldb) {
+    rocblas_status status;
+    if (mode == 0) {
+        status = rocsolver_gbtrf<T>(handle, N, N, kl, ku, d.A, ldab, d.ipiv, d.info);
+        if (status != rocblas_status_success)
+            return status;
+        return rocsolver_gbtrs<T>(handle, trans, N, kl, ku, nrhs, d.A, ldab, d.ipiv, d.B, ldb);
+    }
+    else if (mode == 1) {
+        status = rocsolver_gbtrf_batched<T>(handle, N, N, kl, ku, d.Aarr, ldab, d.ipiv, d.strideP, d.info, d.batch_count);
+        if (status != rocblas_status_success)
+            return status;
+        return rocsolver_gbtrs_batched<T>(handle, trans, N, kl, ku, nrhs, d.Aarr, ldab, d.ipiv, d.strideP, d.Barr, ldb, d.batch_count);
+    }
+    else {
+        status = rocsolver_gbtrf_strided_batched<T>(handle, N, N, kl, ku, d.A, ldab, d.strideA, d.ipiv, d.strideP, d.info, d.batch_count);
+        if (status != rocblas_status_success)
+            return status;
+        return rocsolver_gbtrs_strided_batched<T>(handle, trans, N, kl, ku, nrhs, d.A, ldab, d.strideA, d.ipiv, d.strideP,
+                                                  d.B, ldb, d.strideB, d.batch_count);
+    }
+}
+
+// Tests gbtrf + gbtrs with mode = 0 (normal), 1 (batched) or 2 (strided_batched). The solution is
+// compared with the one computed by the reference getrf + getrs on the full matrix; in the batched
+// modes the second matrix has a zero column and its info is checked instead of the solution.
+template <typename T, typename U, int mode>
+rocblas_status testing_gbtrf_gbtrs(Arguments argus) {
+    rocblas_int N = argus.N;
+    rocblas_int nrhs = argus.K;
+    rocblas_int ldb = argus.ldb;
+    rocblas_int kl = argus.k1;
+    rocblas_int ku = argus.k2;
+    char trans = argus.transA_option;
+    rocblas_int batch_count = mode ? argus.batch_count : 1;
+
+    rocblas_operation transRoc;
+    if (trans == 'N') {
+        transRoc = rocblas_operation_none;
+    } else if (trans == 'T') {
+        transRoc = rocblas_operation_transpose;
+    } else if (trans == 'C') {
+        transRoc = rocblas_operation_conjugate_transpose;
+    } else {
+        throw runtime_error("Unsupported transpose operation.");
+    }
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // check invalid arguments
+    if (N < 1 || nrhs < 1 || ldb < N || kl < 0 || ku < 0 || batch_count < 1)
+        return rocblas_status_invalid_size;
+
+    rocblas_int kv = kl + ku;
+    rocblas_int ldab = 2 * kl + ku + 1;
+    rocblas_int size_A = N * N;
+    rocblas_int size_AB = ldab * N;
+    rocblas_int size_B = ldb * nrhs;
+    rocblas_int strideA = size_AB;
+    rocblas_int strideB = size_B;
+    rocblas_int strideP = N;
+    rocblas_int singular = (batch_count > 1) ? 1 : -1;    //index of the singular matrix
+    rocblas_int zero_col = N / 2;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A);
+    vector<T> hAB(size_AB * batch_count);
+    vector<T> hB(size_B * batch_count);
+    vector<T> hX(size_B * batch_count);
+    vector<int> hIpiv(N);
+    vector<int> hinfo(batch_count);
+
+    testing_batch<T> d(strideA, strideB, strideP, batch_count);
+    if (!d.valid()) {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    //initialize random matrices hAB and hB with all entries in [1, 10]; only the band of
+    //hAB (rows kl to 2*kl+ku) is used, the first kl rows are left with garbage on purpose
+    rocblas_init<T>(hAB.data(), ldab, N * batch_count, ldab);
+    rocblas_init<T>(hB.data(), ldb, nrhs * batch_count, ldb);
+    for (int b = 0; b < batch_count; ++b) {
+        T *ab = hAB.data() + b * strideA;
+        for (int j = 0; j < N; j++) {
+            for (int i = max(0, j - ku); i <= min(N - 1, j + kl); i++) {
+                T &aij = ab[kv + i - j + j * ldab];
+                aij = (aij - 1.0) / 10.0;
+                if (i == j)
+                    aij += 1.0;
+                if (b == singular && j == zero_col)
+                    aij = T(0);
+            }
+        }
+    }
+
+    d.upload(hAB.data(), hB.data());
+
+/* =====================================================================
+           ROCSOLVER
+    =================================================================== */
+    CHECK_ROCBLAS_ERROR(gbtrf_gbtrs_solve<T,mode>(handle, transRoc, N, kl, ku, nrhs, d, ldab, ldb));
+    d.download(hX.data(), hinfo.data());
+
+    // +++++++++ Error Check +++++++++++++
+    // (the reference solution is computed with the full matrix)
+    U eps = std::numeric_limits<U>::epsilon();
+    double max_err_1 = 0.0, max_val = 0.0, diff;
+    for (int b = 0; b < batch_count; ++b) {
+        if (b == singular) {
+            EXPECT_EQ(hinfo[b], zero_col + 1);
+            continue;
+        }
+        EXPECT_EQ(hinfo[b], 0);
+
+        T *ab = hAB.data() + b * strideA;
+        T *bb = hB.data() + b * strideB;
+        T *x = hX.data() + b * strideB;
+        for (int j = 0; j < N; j++) {
+            for (int i = 0; i < N; i++)
+                hA[i + j * N] = (i >= j - ku && i <= j + kl) ? ab[kv + i - j + j * ldab] : T(0);
+        }
+        int retCBLAS;
+        cblas_getrf<T>(N, N, hA.data(), N, hIpiv.data(), &retCBLAS);
+        cblas_getrs<T>(trans, N, nrhs, hA.data(), N, hIpiv.data(), bb, ldb);
+
+        for (int j = 0; j < nrhs; j++) {
+            for (int i = 0; i < N; i++) {
+                diff = abs(bb[i + j * ldb]);
+                max_val = max_val > diff ? max_val : diff;
+                diff = abs(x[i + j * ldb] - bb[i + j * ldb]);
+                max_err_1 = max_err_1 > diff ? max_err_1 : diff;
+            }
+        }
+    }
+    max_err_1 = max_err_1 / max_val;
+    getrs_err_res_check<U>(max_err_1, N, nrhs, ERROR_EPS_MULTIPLIER, eps);
+
+    return rocblas_status_success;
+}
+
+#undef ERROR_EPS_MULTIPLIER
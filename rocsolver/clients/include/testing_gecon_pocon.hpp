@@ -0,0 +1,212 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// the estimate of norm(inv(A)) cannot be larger than the true value (up to rounding errors, which
+// also affect the reference), and for these matrices it is expected to be within a factor of 10 of it
+#define RCOND_MIN_RATIO 0.95
+#define RCOND_MAX_RATIO 10.0
+
+using namespace std;
+
+// getrf + gecon
+template <typename T, int mode, typename U>
+rocblas_status factorize_and_estimate(std::false_type, rocblas_handle handle, rocblas_fill uplo, rocblas_int N,
+                                      T *dA, T **dAarr, rocblas_int lda, rocblas_int strideA,
+                                      rocblas_int *dIpiv, rocblas_int strideP, rocblas_int *dinfo,
+                                      U *danorm, U *drcond, rocblas_int batch_count) {
+    rocblas_status status;
+    if (mode == 0) {
+        status = rocsolver_getrf<T>(handle, N, N, dA, lda, dIpiv, dinfo);
+        if (status != rocblas_status_success)
+            return status;
+        return rocsolver_gecon<T>(handle, N, dA, lda, danorm, drcond);
+    }
+    else if (mode == 1) {
+        status = rocsolver_getrf_batched<T>(handle, N, N, dAarr, lda, dIpiv, strideP, dinfo, batch_count);
+        if (status != rocblas_status_success)
+            return status;
+        return rocsolver_gecon_batched<T>(handle, N, dAarr, lda, danorm, drcond, batch_count);
+    }
+    else {
+        status = rocsolver_getrf_strided_batched<T>(handle, N, N, dA, lda, strideA, dIpiv, strideP, dinfo, batch_count);
+        if (status != rocblas_status_success)
+            return status;
+        return rocsolver_gecon_strided_batched<T>(handle, N, dA, lda, strideA, danorm, drcond, batch_count);
+    }
+}
+
+// potrf + pocon
+template <typename T, int mode, typename U>
+rocblas_status factorize_and_estimate(std::true_type, rocblas_handle handle, rocblas_fill uplo, rocblas_int N,
+                                      T *dA, T **dAarr, rocblas_int lda, rocblas_int strideA,
+                                      rocblas_int *dIpiv, rocblas_int strideP, rocblas_int *dinfo,
+                                      U *danorm, U *drcond, rocblas_int batch_count) {
+    rocblas_status status;
+    if (mode == 0) {
+        status = rocsolver_potrf<T>(handle, uplo, N, dA, lda, dinfo);
+        if (status != rocblas_status_success)
+            return status;
+        return rocsolver_pocon<T>(handle, uplo, N, dA, lda, danorm, drcond);
+    }
+    else if (mode == 1) {
+        status = rocsolver_potrf_batched<T>(handle, uplo, N, dAarr, lda, dinfo, batch_count);
+        if (status != rocblas_status_success)
+            return status;
+        return rocsolver_pocon_batched<T>(handle, uplo, N, dAarr, lda, danorm, drcond, batch_count);
+    }
+    else {
+        status = rocsolver_potrf_strided_batched<T>(handle, uplo, N, dA, lda, strideA, dinfo, batch_count);
+        if (status != rocblas_status_success)
+            return status;
+        return rocsolver_pocon_strided_batched<T>(handle, uplo, N, dA, lda, strideA, danorm, drcond, batch_count);
+    }
+}
+
+// Tests gecon (PO = false) or pocon (PO = true), with mode = 0 (normal), 1 (batched) or 2 (strided_batched).
+// The matrices are factorized on the device with getrf/potrf first. In the batched modes the second
+// matrix is given anorm = 0, for which rcond must be 0.
+template <typename T, typename U, int mode, bool PO>
+rocblas_status testing_gecon_pocon(Arguments argus) {
+    rocblas_int N = argus.N;
+    rocblas_int lda = argus.lda;
+    char char_uplo = argus.uplo_option;
+    rocblas_fill uplo = char2rocblas_fill(char_uplo);
+    rocblas_int batch_count = mode ? argus.batch_count : 1;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // check invalid arguments
+    if (N < 1 || lda < N || batch_count < 1)
+        return rocblas_status_invalid_size;
+
+    rocblas_int size_A = lda * N;
+    rocblas_int strideA = size_A;
+    rocblas_int strideP = N;
+    rocblas_int zero_norm = batch_count > 1 ? 1 : -1;    //index of the matrix with anorm = 0
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A * batch_count);
+    vector<T> hLU(size_A);
+    vector<T> hInv(size_A);
+    vector<int> hIpiv(N);
+    vector<U> hanorm(batch_count);
+    vector<U> hrcond(batch_count);
+
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A * batch_count), rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    auto dIpiv_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * strideP * batch_count), rocblas_test::device_free};
+    rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+    auto dinfo_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * batch_count), rocblas_test::device_free};
+    rocblas_int *dinfo = (rocblas_int *)dinfo_managed.get();
+    auto danorm_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(U) * batch_count), rocblas_test::device_free};
+    U *danorm = (U *)danorm_managed.get();
+    auto drcond_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(U) * batch_count), rocblas_test::device_free};
+    U *drcond = (U *)drcond_managed.get();
+    auto dAarr_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T*) * batch_count), rocblas_test::device_free};
+    T **dAarr = (T **)dAarr_managed.get();
+
+    if (!dA || !dIpiv || !dinfo || !danorm || !drcond || !dAarr) {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    //initialize full random matrices hA with all entries in [1, 10]. For gecon hA has a dominant
+    //diagonal, for pocon it is made symmetric positive definite as in the potrf tests
+    for (int b = 0; b < batch_count; ++b) {
+        T *a = hA.data() + b * strideA;
+        rocblas_init<T>(a, N, N, lda);
+        if (PO) {
+            for (int i = 0; i < N; i++) {
+                for (int j = 0; j < N; j++)
+                    hLU[i + j * lda] = (a[i + j * lda] - T(1)) / T(10);
+            }
+            cblas_gemm(rocblas_operation_none, rocblas_operation_transpose, N, N, N,
+                       (T)1.0, hLU.data(), lda, hLU.data(), lda, (T)0.0, a, lda);
+            for (int i = 0; i < N; i++)
+                a[i + i * lda] += 1;
+        }
+        else {
+            for (int i = 0; i < N; i++)
+                a[i + i * lda] += 10;
+        }
+    }
+
+    // 1-norm of the matrices, and reciprocal condition numbers computed with the explicit inverses
+    vector<double> rcond_true(batch_count);
+    for (int b = 0; b < batch_count; ++b) {
+        T *a = hA.data() + b * strideA;
+        double anrm = 0, inrm = 0;
+        for (int j = 0; j < N; j++) {
+            double s = 0;
+            for (int i = 0; i < N; i++) {
+                hLU[i + j * lda] = a[i + j * lda];
+                hInv[i + j * lda] = (i == j) ? T(1) : T(0);
+                s += abs(a[i + j * lda]);
+            }
+            anrm = anrm > s ? anrm : s;
+        }
+        int hinfo;
+        cblas_getrf<T>(N, N, hLU.data(), lda, hIpiv.data(), &hinfo);
+        cblas_getrs<T>('N', N, N, hLU.data(), lda, hIpiv.data(), hInv.data(), lda);
+        for (int j = 0; j < N; j++) {
+            double si = 0;
+            for (int i = 0; i < N; i++)
+                si += abs(hInv[i + j * lda]);
+            inrm = inrm > si ? inrm : si;
+        }
+        hanorm[b] = (b == zero_norm) ? U(0) : U(anrm);
+        rcond_true[b] = 1.0 / (anrm * inrm);
+    }
+
+    vector<T*> A(batch_count);
+    for (int b = 0; b < batch_count; ++b)
+        A[b] = dA + b * strideA;
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dAarr, A.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(danorm, hanorm.data(), sizeof(U) * batch_count, hipMemcpyHostToDevice));
+
+/* =====================================================================
+           ROCSOLVER
+    =================================================================== */
+    CHECK_ROCBLAS_ERROR(factorize_and_estimate<T,mode>(std::integral_constant<bool,PO>(), handle, uplo, N, dA, dAarr, lda, strideA,
+                                                       dIpiv, strideP, dinfo, danorm, drcond, batch_count));
+    CHECK_HIP_ERROR(hipMemcpy(hrcond.data(), drcond, sizeof(U) * batch_count, hipMemcpyDeviceToHost));
+
+    // +++++++++ Error Check +++++++++++++
+    for (int b = 0; b < batch_count; ++b) {
+        if (b == zero_norm) {
+            EXPECT_EQ(hrcond[b], U(0));
+            continue;
+        }
+        double ratio = hrcond[b] / rcond_true[b];
+        EXPECT_GE(ratio, RCOND_MIN_RATIO);
+        EXPECT_LE(ratio, RCOND_MAX_RATIO);
+    }
+
+    return rocblas_status_success;
+}
+
+#undef RCOND_MIN_RATIO
+#undef RCOND_MAX_RATIO
@@ -0,0 +1,128 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "testing_batch.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER element of the residual A*X - B (relative to the size of B)
+#define ERROR_EPS_MULTIPLIER 6000
+
+using namespace std;
+
+// Tests gesv (mode = 0), gesv_batched (mode = 1) or gesv_strided_batched (mode = 2).
+// In the batched modes the second matrix is singular: its info must be positive and
+// its right hand sides must not be modified.
+template <typename T, typename U, int mode>
+rocblas_status testing_gesv(Arguments argus) {
+    rocblas_int N = argus.N;
+    rocblas_int nrhs = argus.K;
+    rocblas_int lda = argus.lda;
+    rocblas_int ldb = argus.ldb;
+    rocblas_int batch_count = mode ? argus.batch_count : 1;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // check invalid arguments
+    if (N < 1 || nrhs < 1 || lda < N || ldb < N || batch_count < 1)
+        return rocblas_status_invalid_size;
+
+    rocblas_int size_A = lda * N;
+    rocblas_int size_B = ldb * nrhs;
+    rocblas_int strideA = size_A;
+    rocblas_int strideB = size_B;
+    rocblas_int strideP = N;
+    rocblas_int singular = batch_count > 1 ? 1 : -1;    //index of the singular matrix
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A * batch_count);
+    vector<T> hB(size_B * batch_count);
+    vector<T> hX(size_B * batch_count);
+    vector<int> hinfo(batch_count);
+
+    testing_batch<T> d(strideA, strideB, strideP, batch_count);
+    if (!d.valid()) {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    //initialize full random matrices hA and hB with all entries in [1, 10]; hA with a dominant diagonal
+    for (int b = 0; b < batch_count; ++b) {
+        rocblas_init<T>(hA.data() + b * strideA, N, N, lda);
+        rocblas_init<T>(hB.data() + b * strideB, N, nrhs, ldb);
+        for (int i = 0; i < N; ++i)
+            hA[b * strideA + i + i * lda] += 400;
+    }
+    if (singular >= 0) {
+        for (int i = 0; i < N; ++i)
+            hA[singular * strideA + i] = 0;
+    }
+
+    d.upload(hA.data(), hB.data());
+
+/* =====================================================================
+           ROCSOLVER
+    =================================================================== */
+    if (mode == 0) {
+        CHECK_ROCBLAS_ERROR(rocsolver_gesv<T>(handle, N, nrhs, d.A, lda, d.ipiv, d.B, ldb, d.info));
+    }
+    else if (mode == 1) {
+        CHECK_ROCBLAS_ERROR(rocsolver_gesv_batched<T>(handle, N, nrhs, d.Aarr, lda, d.ipiv, strideP, d.Barr, ldb, d.info, batch_count));
+    }
+    else {
+        CHECK_ROCBLAS_ERROR(rocsolver_gesv_strided_batched<T>(handle, N, nrhs, d.A, lda, strideA, d.ipiv, strideP,
+                                                              d.B, ldb, strideB, d.info, batch_count));
+    }
+    d.download(hX.data(), hinfo.data());
+
+    // +++++++++ Error Check +++++++++++++
+    double eps = std::numeric_limits<U>::epsilon();
+    double max_err_1 = 0.0, max_val = 0.0, diff;
+    for (int b = 0; b < batch_count; ++b) {
+        T *a = hA.data() + b * strideA;
+        T *bb = hB.data() + b * strideB;
+        T *x = hX.data() + b * strideB;
+        if (b == singular) {
+            EXPECT_GT(hinfo[b], 0);
+            for (int k = 0; k < size_B; ++k)
+                EXPECT_TRUE(x[k] == bb[k]);
+            continue;
+        }
+        EXPECT_EQ(hinfo[b], 0);
+        for (int j = 0; j < nrhs; j++) {
+            for (int i = 0; i < N; i++) {
+                T s = -bb[i + j * ldb];
+                for (int k = 0; k < N; k++)
+                    s += a[i + k * lda] * x[k + j * ldb];
+                diff = abs(s);
+                max_err_1 = max_err_1 > diff ? max_err_1 : diff;
+                diff = abs(bb[i + j * ldb]);
+                max_val = max_val > diff ? max_val : diff;
+            }
+        }
+    }
+    max_err_1 = max_err_1 / max_val;
+    getf2_err_res_check<U>(max_err_1, N, nrhs, ERROR_EPS_MULTIPLIER, eps);
+
+    return rocblas_status_success;
+}
+
+#undef ERROR_EPS_MULTIPLIER
@@ -0,0 +1,121 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER element of the residual A*X - B (relative to the size of A*X)
+#define ERROR_EPS_MULTIPLIER 6000
+
+using namespace std;
+
+// Tests dsgesv/zcgesv with diagonally dominant matrices. The refinement is expected to converge,
+// unless the entries are scaled by a factor that does not fit in single precision; then the
+// double precision fallback must be used (iter = -2).
+template <typename T, typename U>
+rocblas_status testing_gesv_mixed(Arguments argus, double scale = 1.0) {
+    rocblas_int N = argus.N;
+    rocblas_int nrhs = argus.K;
+    rocblas_int lda = argus.lda;
+    rocblas_int ldb = argus.ldb;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // check invalid arguments
+    if (N < 1 || nrhs < 1 || lda < N || ldb < N)
+        return rocblas_status_invalid_size;
+
+    rocblas_int size_A = lda * N;
+    rocblas_int size_B = ldb * nrhs;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A);
+    vector<T> hB(size_B);
+    vector<T> hX(size_B);
+    int hinfo, hiter;
+
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A), rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    auto dB_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_B), rocblas_test::device_free};
+    T *dB = (T *)dB_managed.get();
+    auto dX_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_B), rocblas_test::device_free};
+    T *dX = (T *)dX_managed.get();
+    auto dIpiv_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * N), rocblas_test::device_free};
+    rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+    auto dinfo_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int)), rocblas_test::device_free};
+    rocblas_int *dinfo = (rocblas_int *)dinfo_managed.get();
+    auto diter_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int)), rocblas_test::device_free};
+    rocblas_int *diter = (rocblas_int *)diter_managed.get();
+
+    if (!dA || !dB || !dX || !dIpiv || !dinfo || !diter) {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    //initialize full random matrices hA and hB with all entries in [1, 10]; hA with a dominant diagonal
+    rocblas_init<T>(hA.data(), N, N, lda);
+    rocblas_init<T>(hB.data(), N, nrhs, ldb);
+    for (int i = 0; i < N; ++i)
+        hA[i + i * lda] += 400;
+    for (int i = 0; i < size_A; ++i)
+        hA[i] = hA[i] * T(scale);
+    for (int i = 0; i < size_B; ++i)
+        hB[i] = hB[i] * T(scale);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * size_B, hipMemcpyHostToDevice));
+
+/* =====================================================================
+           ROCSOLVER
+    =================================================================== */
+    CHECK_ROCBLAS_ERROR(rocsolver_gesv_mixed<T>(handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldb, diter, dinfo));
+    CHECK_HIP_ERROR(hipMemcpy(hX.data(), dX, sizeof(T) * size_B, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(&hinfo, dinfo, sizeof(int), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(&hiter, diter, sizeof(int), hipMemcpyDeviceToHost));
+
+    // +++++++++ Error Check +++++++++++++
+    EXPECT_EQ(hinfo, 0);
+    if (scale == 1.0)
+        EXPECT_GE(hiter, 0);
+    else
+        EXPECT_EQ(hiter, -2);
+
+    // residual, computed with the host copies of A and B
+    double eps = std::numeric_limits<U>::epsilon();
+    double max_err_1 = 0.0, max_val = 0.0, diff;
+    for (int j = 0; j < nrhs; j++) {
+        for (int i = 0; i < N; i++) {
+            T s = -hB[i + j * ldb];
+            for (int k = 0; k < N; k++)
+                s += hA[i + k * lda] * hX[k + j * ldb];
+            diff = abs(s);
+            max_err_1 = max_err_1 > diff ? max_err_1 : diff;
+            diff = abs(hB[i + j * ldb]);
+            max_val = max_val > diff ? max_val : diff;
+        }
+    }
+    max_err_1 = max_err_1 / max_val;
+    getf2_err_res_check<U>(max_err_1, N, nrhs, ERROR_EPS_MULTIPLIER, eps);
+
+    return rocblas_status_success;
+}
+
+#undef ERROR_EPS_MULTIPLIER
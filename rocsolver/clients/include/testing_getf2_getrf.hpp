@@ -94,6 +94,10 @@ rocblas_status testing_getf2_getrf(Arguments argus) {
     // copy data from CPU to device
     CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
 
+    // look-ahead of getrf (to compare the timings with and without it)
+    if (getrf)
+        CHECK_ROCBLAS_ERROR(rocsolver_set_getrf_lookahead(handle, argus.lookahead));
+
     double gpu_time_used, cpu_time_used;
     double error_eps_multiplier = ERROR_EPS_MULTIPLIER;
     double eps = std::numeric_limits<U>::epsilon();
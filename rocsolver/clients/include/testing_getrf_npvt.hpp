@@ -0,0 +1,142 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER element after the LU
+#define ERROR_EPS_MULTIPLIER 6000
+
+using namespace std;
+
+// reference LU factorization without pivoting (computed on the host)
+template <typename T>
+void getrf_npvt_reference(rocblas_int m, rocblas_int n, T *A, rocblas_int lda, rocblas_int *info) {
+    *info = 0;
+    for (rocblas_int j = 0; j < min(m, n); ++j) {
+        T pivot = A[j + j * lda];
+        if (pivot == T(0)) {
+            if (*info == 0)
+                *info = j + 1;
+        }
+        else {
+            for (rocblas_int i = j + 1; i < m; ++i)
+                A[i + j * lda] /= pivot;
+        }
+        for (rocblas_int k = j + 1; k < n; ++k)
+            for (rocblas_int i = j + 1; i < m; ++i)
+                A[i + k * lda] -= A[i + j * lda] * A[j + k * lda];
+    }
+}
+
+// Tests getrf_npvt (mode = 0), getrf_npvt_batched (mode = 1) or getrf_npvt_strided_batched (mode = 2).
+// The matrices are made diagonally dominant so that the factorization without pivoting is stable.
+template <typename T, typename U, int mode>
+rocblas_status testing_getrf_npvt(Arguments argus) {
+    rocblas_int M = argus.M;
+    rocblas_int N = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_int batch_count = mode ? argus.batch_count : 1;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // check invalid arguments
+    if (M < 1 || N < 1 || lda < M || batch_count < 1)
+        return rocblas_status_invalid_size;
+
+    rocblas_int size_A = lda * N;
+    rocblas_int strideA = size_A;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A * batch_count);
+    vector<T> hAr(size_A * batch_count);
+    vector<int> hinfo(batch_count);
+    vector<int> hinfor(batch_count);
+
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A * batch_count), rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    auto dinfo_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * batch_count), rocblas_test::device_free};
+    rocblas_int *dinfo = (rocblas_int *)dinfo_managed.get();
+    auto dAarr_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T*) * batch_count), rocblas_test::device_free};
+    T **dAarr = (T **)dAarr_managed.get();
+
+    if (!dA || !dinfo || !dAarr) {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    //initialize full random matrices hA with all entries in [1, 10] and a dominant diagonal
+    for (int b = 0; b < batch_count; ++b) {
+        rocblas_init<T>(hA.data() + b * strideA, M, N, lda);
+        for (int i = 0; i < min(M, N); ++i)
+            hA[b * strideA + i + i * lda] += 400;
+    }
+
+    vector<T*> A(batch_count);
+    for (int b = 0; b < batch_count; ++b)
+        A[b] = dA + b * strideA;
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dAarr, A.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+
+/* =====================================================================
+           ROCSOLVER
+    =================================================================== */
+    if (mode == 0) {
+        CHECK_ROCBLAS_ERROR(rocsolver_getrf_npvt<T>(handle, M, N, dA, lda, dinfo));
+    }
+    else if (mode == 1) {
+        CHECK_ROCBLAS_ERROR(rocsolver_getrf_npvt_batched<T>(handle, M, N, dAarr, lda, dinfo, batch_count));
+    }
+    else {
+        CHECK_ROCBLAS_ERROR(rocsolver_getrf_npvt_strided_batched<T>(handle, M, N, dA, lda, strideA, dinfo, batch_count));
+    }
+    CHECK_HIP_ERROR(hipMemcpy(hAr.data(), dA, sizeof(T) * size_A * batch_count, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hinfor.data(), dinfo, sizeof(int) * batch_count, hipMemcpyDeviceToHost));
+
+    //CPU reference
+    for (int b = 0; b < batch_count; ++b)
+        getrf_npvt_reference<T>(M, N, hA.data() + b * strideA, lda, hinfo.data() + b);
+
+    // +++++++++ Error Check +++++++++++++
+    EXPECT_TRUE(hinfo == hinfor);
+
+    double eps = std::numeric_limits<U>::epsilon();
+    double max_err_1 = 0.0, max_val, diff, err;
+    for (int b = 0; b < batch_count; ++b) {
+        err = 0.0;
+        max_val = 0.0;
+        for (int i = 0; i < M; i++) {
+            for (int j = 0; j < N; j++) {
+                diff = abs(hA[b * strideA + i + j * lda]);
+                max_val = max_val > diff ? max_val : diff;
+                diff = abs(hAr[b * strideA + i + j * lda] - hA[b * strideA + i + j * lda]);
+                err = err > diff ? err : diff;
+            }
+        }
+        err = err / max_val;
+        max_err_1 = max_err_1 > err ? max_err_1 : err;
+    }
+    getf2_err_res_check<U>(max_err_1, M, N, ERROR_EPS_MULTIPLIER, eps);
+
+    return rocblas_status_success;
+}
+
+#undef ERROR_EPS_MULTIPLIER
@@ -0,0 +1,131 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER element after the LU
+#define ERROR_EPS_MULTIPLIER 6000
+
+using namespace std;
+
+// Factorizes the same matrix with getrf using the given panel algorithm (and look-ahead if
+// requested) and compares the result with the one obtained when the panels are unblocked.
+// Tournament pivoting may choose other pivots, so in that case the residual P*A - L*U is checked instead.
+template <typename T, typename U>
+rocblas_status testing_getrf_panel(Arguments argus, rocblas_panel panel, rocblas_int lookahead = 0) {
+    rocblas_int M = argus.M;
+    rocblas_int N = argus.N;
+    rocblas_int lda = argus.lda;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // check invalid arguments
+    if (M < 1 || N < 1 || lda < M)
+        return rocblas_status_invalid_size;
+
+    rocblas_int size_A = lda * N;
+    rocblas_int size_piv = min(M, N);
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A);
+    vector<T> hA1(size_A);
+    vector<T> hA2(size_A);
+    vector<int> hIpiv1(size_piv);
+    vector<int> hIpiv2(size_piv);
+    int hinfo1, hinfo2;
+
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A), rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    auto dIpiv_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * size_piv), rocblas_test::device_free};
+    rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+    auto dinfo_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int)), rocblas_test::device_free};
+    rocblas_int *dinfo = (rocblas_int *)dinfo_managed.get();
+
+    if (!dA || !dIpiv || !dinfo) {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    //initialize full random matrix hA with all entries in [1, 10]
+    rocblas_init<T>(hA.data(), M, N, lda);
+
+    // reference: unblocked panels
+    CHECK_ROCBLAS_ERROR(rocsolver_set_getrf_panel(handle, rocblas_panel_unblocked));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_ROCBLAS_ERROR(rocsolver_getrf<T>(handle, M, N, dA, lda, dIpiv, dinfo));
+    CHECK_HIP_ERROR(hipMemcpy(hA1.data(), dA, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hIpiv1.data(), dIpiv, sizeof(int) * size_piv, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(&hinfo1, dinfo, sizeof(int), hipMemcpyDeviceToHost));
+
+    // panel algorithm under test
+    CHECK_ROCBLAS_ERROR(rocsolver_set_getrf_panel(handle, panel));
+    CHECK_ROCBLAS_ERROR(rocsolver_set_getrf_lookahead(handle, lookahead));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_ROCBLAS_ERROR(rocsolver_getrf<T>(handle, M, N, dA, lda, dIpiv, dinfo));
+    CHECK_HIP_ERROR(hipMemcpy(hA2.data(), dA, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hIpiv2.data(), dIpiv, sizeof(int) * size_piv, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(&hinfo2, dinfo, sizeof(int), hipMemcpyDeviceToHost));
+
+    // +++++++++ Error Check +++++++++++++
+    EXPECT_EQ(hinfo1, hinfo2);
+    double eps = std::numeric_limits<U>::epsilon();
+    double max_err_1 = 0.0, max_val = 0.0;
+    double diff;
+
+    if (panel == rocblas_panel_tournament) {
+        // apply the interchanges to A
+        for (int k = 0; k < size_piv; k++) {
+            for (int j = 0; j < N; j++)
+                std::swap(hA[k + j * lda], hA[hIpiv2[k] - 1 + j * lda]);
+        }
+        for (int i = 0; i < M; i++) {
+            for (int j = 0; j < N; j++) {
+                T s = -hA[i + j * lda];
+                for (int k = 0; k <= min(i, j) && k < size_piv; k++)
+                    s += (k == i ? T(1) : hA2[i + k * lda]) * hA2[k + j * lda];
+                diff = abs(s);
+                max_err_1 = max_err_1 > diff ? max_err_1 : diff;
+                diff = abs(hA[i + j * lda]);
+                max_val = max_val > diff ? max_val : diff;
+            }
+        }
+        max_err_1 = max_err_1 / max_val;
+        getf2_err_res_check<U>(max_err_1, M, N, ERROR_EPS_MULTIPLIER, eps);
+        return rocblas_status_success;
+    }
+
+    EXPECT_TRUE(hIpiv1 == hIpiv2);
+    for (int i = 0; i < M; i++) {
+        for (int j = 0; j < N; j++) {
+            diff = abs(hA1[i + j * lda]);
+            max_val = max_val > diff ? max_val : diff;
+            diff = abs(hA2[i + j * lda] - hA1[i + j * lda]);
+            max_err_1 = max_err_1 > diff ? max_err_1 : diff;
+        }
+    }
+    max_err_1 = max_err_1 / max_val;
+    getf2_err_res_check<U>(max_err_1, M, N, ERROR_EPS_MULTIPLIER, eps);
+
+    return rocblas_status_success;
+}
+
+#undef ERROR_EPS_MULTIPLIER
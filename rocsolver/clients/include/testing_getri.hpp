@@ -0,0 +1,146 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER element of A*inv(A) - I
+#define ERROR_EPS_MULTIPLIER 6000
+
+using namespace std;
+
+// Tests getri (batched = 0) or getri_outofplace_batched (batched = 1). The matrices are factorized
+// with getrf (getrf_batched), inverted, and the product A*inv(A) is compared with the identity.
+// The matrices are made diagonally dominant so that they are well conditioned. With singular = true,
+// one matrix (the second one of a batch) has a zero column; its info is checked and its inverse
+// (A itself for getri) must be left untouched.
+template <typename T, typename U, int batched>
+rocblas_status testing_getri(Arguments argus, bool singular = false) {
+    rocblas_int N = argus.N;
+    rocblas_int lda = argus.lda;
+    rocblas_int batch_count = batched ? argus.batch_count : 1;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // check invalid arguments
+    if (N < 1 || lda < N || batch_count < 1)
+        return rocblas_status_invalid_size;
+
+    rocblas_int size_A = lda * N;
+    rocblas_int strideA = size_A;
+    rocblas_int strideP = N;
+    rocblas_int zero_col = N / 2;
+    rocblas_int sing = !singular ? -1 : (batch_count > 1 ? 1 : 0);    //index of the singular matrix
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A * batch_count);
+    vector<T> hC(size_A * batch_count);
+    vector<T> hC0(size_A * batch_count);
+    vector<int> hinfo(batch_count);
+
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A * batch_count), rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    auto dC_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A * batch_count), rocblas_test::device_free};
+    T *dC = (T *)dC_managed.get();
+    auto dIpiv_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * strideP * batch_count), rocblas_test::device_free};
+    rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+    auto dinfo_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * batch_count), rocblas_test::device_free};
+    rocblas_int *dinfo = (rocblas_int *)dinfo_managed.get();
+    auto dAarr_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T*) * batch_count), rocblas_test::device_free};
+    T **dAarr = (T **)dAarr_managed.get();
+    auto dCarr_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T*) * batch_count), rocblas_test::device_free};
+    T **dCarr = (T **)dCarr_managed.get();
+
+    if (!dA || !dC || !dIpiv || !dinfo || !dAarr || !dCarr) {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    //initialize full random matrices hA with all entries in [1, 10] and a dominant diagonal
+    for (int b = 0; b < batch_count; ++b) {
+        rocblas_init<T>(hA.data() + b * strideA, N, N, lda);
+        for (int i = 0; i < N; ++i)
+            hA[b * strideA + i + i * lda] += 400;
+        if (b == sing) {
+            for (int i = 0; i < N; ++i)
+                hA[b * strideA + i + zero_col * lda] = 0;
+        }
+    }
+
+    vector<T*> A(batch_count), C(batch_count);
+    for (int b = 0; b < batch_count; ++b) {
+        A[b] = dA + b * strideA;
+        C[b] = dC + b * strideA;
+    }
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hA.data(), sizeof(T) * size_A * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dAarr, A.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dCarr, C.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+
+/* =====================================================================
+           ROCSOLVER
+    =================================================================== */
+    if (batched) {
+        CHECK_ROCBLAS_ERROR(rocsolver_getrf_batched<T>(handle, N, N, dAarr, lda, dIpiv, strideP, dinfo, batch_count));
+        CHECK_ROCBLAS_ERROR(rocsolver_getri_outofplace_batched<T>(handle, N, dAarr, lda, dIpiv, strideP, dCarr, lda, dinfo, batch_count));
+    }
+    else {
+        CHECK_ROCBLAS_ERROR(rocsolver_getrf<T>(handle, N, N, dA, lda, dIpiv, dinfo));
+        // the factors, which must not be modified if the matrix is singular
+        CHECK_HIP_ERROR(hipMemcpy(hC0.data(), dA, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+        CHECK_ROCBLAS_ERROR(rocsolver_getri<T>(handle, N, dA, lda, dIpiv, dinfo));
+    }
+    CHECK_HIP_ERROR(hipMemcpy(hC.data(), batched ? dC : dA, sizeof(T) * size_A * batch_count, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hinfo.data(), dinfo, sizeof(int) * batch_count, hipMemcpyDeviceToHost));
+
+    // +++++++++ Error Check +++++++++++++
+    double eps = std::numeric_limits<U>::epsilon();
+    double max_err_1 = 0.0, diff;
+    for (int b = 0; b < batch_count; ++b) {
+        T *a = hA.data() + b * strideA;
+        T *c = hC.data() + b * strideA;
+        if (b == sing) {
+            // nothing is written for a singular matrix
+            T *c0 = batched ? a : hC0.data();
+            EXPECT_EQ(hinfo[b], zero_col + 1);
+            for (int i = 0; i < N; i++) {
+                for (int j = 0; j < N; j++)
+                    EXPECT_EQ(c[i + j * lda], c0[i + j * lda]);
+            }
+            continue;
+        }
+        EXPECT_EQ(hinfo[b], 0);
+        for (int i = 0; i < N; i++) {
+            for (int j = 0; j < N; j++) {
+                T s = (i == j) ? -1 : 0;
+                for (int k = 0; k < N; k++)
+                    s += a[i + k * lda] * c[k + j * lda];
+                diff = abs(s);
+                max_err_1 = max_err_1 > diff ? max_err_1 : diff;
+            }
+        }
+    }
+    getf2_err_res_check<U>(max_err_1, N, N, ERROR_EPS_MULTIPLIER, eps);
+
+    return rocblas_status_success;
+}
+
+#undef ERROR_EPS_MULTIPLIER
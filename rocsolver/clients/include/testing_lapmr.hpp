@@ -0,0 +1,98 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+using namespace std;
+
+// Converts random pivot indices into a permutation vector with ipiv2perm, and applies it
+// with lapmr. The forward permutation must give the same rows as laswp with the pivot
+// indices, and the backward permutation must restore the original matrix.
+template <typename T>
+rocblas_status testing_lapmr(Arguments argus) {
+    rocblas_int M = argus.M;
+    rocblas_int N = argus.N;
+    rocblas_int ldx = argus.lda;
+    rocblas_int K = argus.K;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // check invalid arguments
+    if (M < 1 || N < 1 || ldx < M || K < 1 || K > M)
+        return rocblas_status_invalid_size;
+
+    rocblas_int size_X = ldx * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hX(size_X);
+    vector<T> hXr(size_X);
+    vector<T> hXp(size_X);
+    vector<int> hIpiv(K);
+
+    auto dX_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_X), rocblas_test::device_free};
+    T *dX = (T *)dX_managed.get();
+    auto dIpiv_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * K), rocblas_test::device_free};
+    rocblas_int *dIpiv = (rocblas_int *)dIpiv_managed.get();
+    auto dPerm_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * M), rocblas_test::device_free};
+    rocblas_int *dPerm = (rocblas_int *)dPerm_managed.get();
+
+    if (!dX || !dIpiv || !dPerm) {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    //initialize full random matrix hX, and random pivot indices as returned by getrf (ipiv[i] >= i+1)
+    rocblas_init<T>(hX.data(), M, N, ldx);
+    for (int i = 0; i < K; ++i)
+        hIpiv[i] = i + 1 + rand() % (M - i);
+
+    CHECK_HIP_ERROR(hipMemcpy(dX, hX.data(), sizeof(T) * size_X, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dIpiv, hIpiv.data(), sizeof(int) * K, hipMemcpyHostToDevice));
+
+    // reference
+    hXr = hX;
+    cblas_laswp<T>(N, hXr.data(), ldx, 1, K, hIpiv.data(), 1);
+
+/* =====================================================================
+           ROCSOLVER
+    =================================================================== */
+    CHECK_ROCBLAS_ERROR(rocsolver_ipiv2perm(handle, M, K, dIpiv, dPerm));
+    CHECK_ROCBLAS_ERROR(rocsolver_lapmr<T>(handle, rocblas_forward_direction, M, N, dX, ldx, dPerm));
+    CHECK_HIP_ERROR(hipMemcpy(hXp.data(), dX, sizeof(T) * size_X, hipMemcpyDeviceToHost));
+
+    // +++++++++ Error Check +++++++++++++
+    // rows are only moved, so the results must be exact
+    for (int j = 0; j < N; ++j) {
+        for (int i = 0; i < M; ++i)
+            EXPECT_TRUE(hXp[i + j * ldx] == hXr[i + j * ldx]);
+    }
+
+    CHECK_ROCBLAS_ERROR(rocsolver_lapmr<T>(handle, rocblas_backward_direction, M, N, dX, ldx, dPerm));
+    CHECK_HIP_ERROR(hipMemcpy(hXp.data(), dX, sizeof(T) * size_X, hipMemcpyDeviceToHost));
+
+    for (int j = 0; j < N; ++j) {
+        for (int i = 0; i < M; ++i)
+            EXPECT_TRUE(hXp[i + j * ldx] == hX[i + j * ldx]);
+    }
+
+    return rocblas_status_success;
+}
@@ -29,8 +29,10 @@
 
 using namespace std;
 
+// The inputs are random entries in [1, 10] multiplied by scale (very large or very small
+// scales check that the norm of x neither overflows nor underflows).
 template <typename T> 
-rocblas_status testing_larfg(Arguments argus) {
+rocblas_status testing_larfg(Arguments argus, T scale = 1) {
     rocblas_int N = argus.N;
     rocblas_int incx = argus.incx;
     int hot_calls = argus.iters;
@@ -84,6 +86,9 @@ rocblas_status testing_larfg(Arguments argus) {
     //initialize full random inputs, all entries in [1, 10]
     rocblas_init<T>(hx.data(), 1, N-1, incx);
     rocblas_init<T>(&halpha, 1, 1, 1);
+    for (int i = 0; i < N-1; i++)
+        hx[i * incx] *= scale;
+    halpha *= scale;
 
     // copy data from CPU to device
     CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * sizex, hipMemcpyHostToDevice));
@@ -0,0 +1,171 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "testing_batch.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER element of the residual A*X - B (relative to the size of |A|*|X|)
+#define ERROR_EPS_MULTIPLIER 6000
+
+using namespace std;
+
+// pbtrf + pbtrs
+template <typename T, int mode>
+rocblas_status pbtrf_pbtrs_solve(rocblas_handle handle, rocblas_fill uplo, rocblas_int N, rocblas_int kd, rocblas_int nrhs,
+                                 testing_batch<T> &d, rocblas_int ldab, rocblas_int ldb) {
+    rocblas_status status;
+    if (mode == 0) {
+        status = rocsolver_pbtrf<T>(handle, uplo, N, kd, d.A, ldab, d.info);
+        if (status != rocblas_status_success)
+            return status;
+        return rocsolver_pbtrs<T>(handle, uplo, N, kd, nrhs, d.A, ldab, d.B, ldb);
+    }
+    else if (mode == 1) {
+        status = rocsolver_pbtrf_batched<T>(handle, uplo, N, kd, d.Aarr, ldab, d.info, d.batch_count);
+        if (status != rocblas_status_success)
+            return status;
+        return rocsolver_pbtrs_batched<T>(handle, uplo, N, kd, nrhs, d.Aarr, ldab, d.Barr, ldb, d.batch_count);
+    }
+    else {
+        status = rocsolver_pbtrf_strided_batched<T>(handle, uplo, N, kd, d.A, ldab, d.strideA, d.info, d.batch_count);
+        if (status != rocblas_status_success)
+            return status;
+        return rocsolver_pbtrs_strided_batched<T>(handle, uplo, N, kd, nrhs, d.A, ldab, d.strideA, d.B, ldb, d.strideB, d.batch_count);
+    }
+}
+
+// Tests pbtrf + pbtrs with mode = 0 (normal), 1 (batched) or 2 (strided_batched). The matrices are
+// symmetric, banded and diagonally dominant, and are stored in band format on the host; in the
+// batched modes the second matrix is not positive definite and its info is checked instead of the solution.
+template <typename T, int mode>
+rocblas_status testing_pbtrf_pbtrs(Arguments argus) {
+    rocblas_int N = argus.N;
+    rocblas_int nrhs = argus.K;
+    rocblas_int ldb = argus.ldb;
+    rocblas_int kd = argus.k1;
+    char char_uplo = argus.uplo_option;
+    rocblas_fill uplo = char2rocblas_fill(char_uplo);
+    rocblas_int batch_count = mode ? argus.batch_count : 1;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // check invalid arguments
+    if (N < 1 || nrhs < 1 || ldb < N || kd < 0 || batch_count < 1)
+        return rocblas_status_invalid_size;
+
+    rocblas_int ldab = kd + 1;
+    rocblas_int size_A = N * N;
+    rocblas_int size_AB = ldab * N;
+    rocblas_int size_B = ldb * nrhs;
+    rocblas_int strideA = size_AB;
+    rocblas_int strideB = size_B;
+    rocblas_int indefinite = (batch_count > 1) ? 1 : -1;    //index of the non positive definite matrix
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A * batch_count);
+    vector<T> hAB(size_AB * batch_count);
+    vector<T> hB(size_B * batch_count);
+    vector<T> hX(size_B * batch_count);
+    vector<int> hinfo(batch_count);
+
+    testing_batch<T> d(strideA, strideB, 0, batch_count);
+    if (!d.valid()) {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    //initialize full random matrices hA and hB with all entries in [1, 10];
+    //hA is made symmetric, banded and diagonally dominant, and then stored in band format
+    for (int b = 0; b < batch_count; ++b) {
+        T *a = hA.data() + b * size_A;
+        rocblas_init<T>(a, N, N, N);
+        rocblas_init<T>(hB.data() + b * strideB, N, nrhs, ldb);
+        for (int j = 0; j < N; j++) {
+            for (int i = 0; i < N; i++) {
+                if (i - j > kd || j - i > kd)
+                    a[i + j * N] = 0;
+                else if (i > j)
+                    a[i + j * N] = (a[i + j * N] - 1.0) / 10.0;
+            }
+        }
+        for (int j = 0; j < N; j++) {
+            for (int i = 0; i < j; i++)
+                a[i + j * N] = a[j + i * N];
+            a[j + j * N] = 2 * kd + 1;
+        }
+        if (b == indefinite)
+            a[(N - 1) + (N - 1) * N] = -1;
+
+        T *ab = hAB.data() + b * strideA;
+        for (int j = 0; j < N; j++) {
+            for (int i = max(0, j - kd); i <= min(N - 1, j + kd); i++) {
+                if (uplo == rocblas_fill_upper && i <= j)
+                    ab[kd + i - j + j * ldab] = a[i + j * N];
+                if (uplo == rocblas_fill_lower && i >= j)
+                    ab[i - j + j * ldab] = a[i + j * N];
+            }
+        }
+    }
+
+    d.upload(hAB.data(), hB.data());
+
+/* =====================================================================
+           ROCSOLVER
+    =================================================================== */
+    CHECK_ROCBLAS_ERROR(pbtrf_pbtrs_solve<T,mode>(handle, uplo, N, kd, nrhs, d, ldab, ldb));
+    d.download(hX.data(), hinfo.data());
+
+    // +++++++++ Error Check +++++++++++++
+    // (the residual is computed with the full symmetric matrix)
+    double eps = std::numeric_limits<T>::epsilon();
+    double max_err_1 = 0.0, max_val = 0.0, diff;
+    for (int b = 0; b < batch_count; ++b) {
+        T *a = hA.data() + b * size_A;
+        T *bb = hB.data() + b * strideB;
+        T *x = hX.data() + b * strideB;
+        if (b == indefinite) {
+            EXPECT_EQ(hinfo[b], N);
+            continue;
+        }
+        EXPECT_EQ(hinfo[b], 0);
+        for (int j = 0; j < nrhs; j++) {
+            for (int i = 0; i < N; i++) {
+                T s = -bb[i + j * ldb];
+                double t = 0;
+                for (int k = max(0, i - kd); k <= min(N - 1, i + kd); k++) {
+                    s += a[i + k * N] * x[k + j * ldb];
+                    t += abs(a[i + k * N] * x[k + j * ldb]);
+                }
+                diff = abs(s);
+                max_err_1 = max_err_1 > diff ? max_err_1 : diff;
+                max_val = max_val > t ? max_val : t;
+            }
+        }
+    }
+    max_err_1 = max_err_1 / max_val;
+    getf2_err_res_check<T>(max_err_1, N, nrhs, ERROR_EPS_MULTIPLIER, eps);
+
+    return rocblas_status_success;
+}
+
+#undef ERROR_EPS_MULTIPLIER
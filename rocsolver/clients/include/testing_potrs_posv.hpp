@@ -0,0 +1,168 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "testing_batch.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER element of the residual A*X - B (relative to the size of |A|*|X|)
+#define ERROR_EPS_MULTIPLIER 6000
+
+using namespace std;
+
+// potrf + potrs
+template <typename T, int mode>
+rocblas_status potrs_posv_solve(std::false_type, rocblas_handle handle, rocblas_fill uplo, rocblas_int N, rocblas_int nrhs,
+                                testing_batch<T> &d, rocblas_int lda, rocblas_int ldb) {
+    rocblas_status status;
+    if (mode == 0) {
+        status = rocsolver_potrf<T>(handle, uplo, N, d.A, lda, d.info);
+        if (status != rocblas_status_success)
+            return status;
+        return rocsolver_potrs<T>(handle, uplo, N, nrhs, d.A, lda, d.B, ldb);
+    }
+    else if (mode == 1) {
+        status = rocsolver_potrf_batched<T>(handle, uplo, N, d.Aarr, lda, d.info, d.batch_count);
+        if (status != rocblas_status_success)
+            return status;
+        return rocsolver_potrs_batched<T>(handle, uplo, N, nrhs, d.Aarr, lda, d.Barr, ldb, d.batch_count);
+    }
+    else {
+        status = rocsolver_potrf_strided_batched<T>(handle, uplo, N, d.A, lda, d.strideA, d.info, d.batch_count);
+        if (status != rocblas_status_success)
+            return status;
+        return rocsolver_potrs_strided_batched<T>(handle, uplo, N, nrhs, d.A, lda, d.strideA, d.B, ldb, d.strideB, d.batch_count);
+    }
+}
+
+// posv
+template <typename T, int mode>
+rocblas_status potrs_posv_solve(std::true_type, rocblas_handle handle, rocblas_fill uplo, rocblas_int N, rocblas_int nrhs,
+                                testing_batch<T> &d, rocblas_int lda, rocblas_int ldb) {
+    if (mode == 0)
+        return rocsolver_posv<T>(handle, uplo, N, nrhs, d.A, lda, d.B, ldb, d.info);
+    else if (mode == 1)
+        return rocsolver_posv_batched<T>(handle, uplo, N, nrhs, d.Aarr, lda, d.Barr, ldb, d.info, d.batch_count);
+    else
+        return rocsolver_posv_strided_batched<T>(handle, uplo, N, nrhs, d.A, lda, d.strideA, d.B, ldb, d.strideB, d.info, d.batch_count);
+}
+
+// Tests potrf + potrs (DRIVER = false) or posv (DRIVER = true), with mode = 0 (normal), 1 (batched)
+// or 2 (strided_batched). For posv in the batched modes the second matrix is not positive definite:
+// its info must be positive and its right hand sides must not be modified.
+template <typename T, int mode, bool DRIVER>
+rocblas_status testing_potrs_posv(Arguments argus) {
+    rocblas_int N = argus.N;
+    rocblas_int nrhs = argus.K;
+    rocblas_int lda = argus.lda;
+    rocblas_int ldb = argus.ldb;
+    char char_uplo = argus.uplo_option;
+    rocblas_fill uplo = char2rocblas_fill(char_uplo);
+    rocblas_int batch_count = mode ? argus.batch_count : 1;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // check invalid arguments
+    if (N < 1 || nrhs < 1 || lda < N || ldb < N || batch_count < 1)
+        return rocblas_status_invalid_size;
+
+    rocblas_int size_A = lda * N;
+    rocblas_int size_B = ldb * nrhs;
+    rocblas_int strideA = size_A;
+    rocblas_int strideB = size_B;
+    rocblas_int indefinite = (DRIVER && batch_count > 1) ? 1 : -1;    //index of the non positive definite matrix
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A * batch_count);
+    vector<T> hM(size_A);
+    vector<T> hB(size_B * batch_count);
+    vector<T> hX(size_B * batch_count);
+    vector<int> hinfo(batch_count);
+
+    testing_batch<T> d(strideA, strideB, 0, batch_count);
+    if (!d.valid()) {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    //initialize full random matrices hA and hB with all entries in [1, 10]; 
+    //hA is made symmetric positive definite as in the potrf tests
+    for (int b = 0; b < batch_count; ++b) {
+        T *a = hA.data() + b * strideA;
+        rocblas_init<T>(hM.data(), N, N, lda);
+        rocblas_init<T>(hB.data() + b * strideB, N, nrhs, ldb);
+        for (int i = 0; i < N; i++) {
+            for (int j = 0; j < N; j++)
+                hM[i + j * lda] = (hM[i + j * lda] - 1.0) / 10.0;
+        }
+        cblas_gemm(rocblas_operation_none, rocblas_operation_transpose, N, N, N,
+                   (T)1.0, hM.data(), lda, hM.data(), lda, (T)0.0, a, lda);
+        for (int i = 0; i < N; i++)
+            a[i + i * lda] += 1;
+    }
+    if (indefinite >= 0)
+        hA[indefinite * strideA + (N - 1) + (N - 1) * lda] = -1;
+
+    d.upload(hA.data(), hB.data());
+
+/* =====================================================================
+           ROCSOLVER
+    =================================================================== */
+    CHECK_ROCBLAS_ERROR(potrs_posv_solve<T,mode>(std::integral_constant<bool,DRIVER>(), handle, uplo, N, nrhs, d, lda, ldb));
+    d.download(hX.data(), hinfo.data());
+
+    // +++++++++ Error Check +++++++++++++
+    // (the residual is computed with the full symmetric matrix)
+    double eps = std::numeric_limits<T>::epsilon();
+    double max_err_1 = 0.0, max_val = 0.0, diff;
+    for (int b = 0; b < batch_count; ++b) {
+        T *a = hA.data() + b * strideA;
+        T *bb = hB.data() + b * strideB;
+        T *x = hX.data() + b * strideB;
+        if (b == indefinite) {
+            EXPECT_EQ(hinfo[b], N);
+            for (int k = 0; k < size_B; ++k)
+                EXPECT_TRUE(x[k] == bb[k]);
+            continue;
+        }
+        EXPECT_EQ(hinfo[b], 0);
+        for (int j = 0; j < nrhs; j++) {
+            for (int i = 0; i < N; i++) {
+                T s = -bb[i + j * ldb];
+                double t = 0;
+                for (int k = 0; k < N; k++) {
+                    s += a[i + k * lda] * x[k + j * ldb];
+                    t += abs(a[i + k * lda] * x[k + j * ldb]);
+                }
+                diff = abs(s);
+                max_err_1 = max_err_1 > diff ? max_err_1 : diff;
+                max_val = max_val > t ? max_val : t;
+            }
+        }
+    }
+    max_err_1 = max_err_1 / max_val;
+    getf2_err_res_check<T>(max_err_1, N, nrhs, ERROR_EPS_MULTIPLIER, eps);
+
+    return rocblas_status_success;
+}
+
+#undef ERROR_EPS_MULTIPLIER
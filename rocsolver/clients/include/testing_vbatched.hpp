@@ -0,0 +1,250 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <cmath> // std::abs
+#include <fstream>
+#include <iostream>
+#include <limits> // std::numeric_limits<T>::epsilon();
+#include <stdlib.h>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+// this is max error PER element of the factors (relative to the factors computed one matrix at a time)
+#define ERROR_EPS_MULTIPLIER 6000
+
+using namespace std;
+
+#define VBATCHED_GETRF 0
+#define VBATCHED_POTRF 1
+#define VBATCHED_GEQRF 2
+
+// getrf
+template <typename T>
+rocblas_status factorize_vbatched(std::integral_constant<int,VBATCHED_GETRF>, rocblas_handle handle, rocblas_fill uplo,
+                                  const rocblas_int *m, const rocblas_int *n, T *const A[], const rocblas_int *lda,
+                                  rocblas_int *const ipiv[], T *const tau[], rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_getrf_vbatched<T>(handle, m, n, A, lda, ipiv, info, batch_count);
+}
+
+template <typename T>
+rocblas_status factorize_one(std::integral_constant<int,VBATCHED_GETRF>, rocblas_handle handle, rocblas_fill uplo,
+                             rocblas_int m, rocblas_int n, T *A, rocblas_int lda,
+                             rocblas_int *ipiv, T *tau, rocblas_int *info) {
+    return rocsolver_getrf<T>(handle, m, n, A, lda, ipiv, info);
+}
+
+// potrf
+template <typename T>
+rocblas_status factorize_vbatched(std::integral_constant<int,VBATCHED_POTRF>, rocblas_handle handle, rocblas_fill uplo,
+                                  const rocblas_int *m, const rocblas_int *n, T *const A[], const rocblas_int *lda,
+                                  rocblas_int *const ipiv[], T *const tau[], rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_potrf_vbatched<T>(handle, uplo, n, A, lda, info, batch_count);
+}
+
+template <typename T>
+rocblas_status factorize_one(std::integral_constant<int,VBATCHED_POTRF>, rocblas_handle handle, rocblas_fill uplo,
+                             rocblas_int m, rocblas_int n, T *A, rocblas_int lda,
+                             rocblas_int *ipiv, T *tau, rocblas_int *info) {
+    return rocsolver_potrf<T>(handle, uplo, n, A, lda, info);
+}
+
+// geqrf
+template <typename T>
+rocblas_status factorize_vbatched(std::integral_constant<int,VBATCHED_GEQRF>, rocblas_handle handle, rocblas_fill uplo,
+                                  const rocblas_int *m, const rocblas_int *n, T *const A[], const rocblas_int *lda,
+                                  rocblas_int *const ipiv[], T *const tau[], rocblas_int *info, rocblas_int batch_count) {
+    return rocsolver_geqrf_vbatched<T>(handle, m, n, A, lda, tau, batch_count);
+}
+
+template <typename T>
+rocblas_status factorize_one(std::integral_constant<int,VBATCHED_GEQRF>, rocblas_handle handle, rocblas_fill uplo,
+                             rocblas_int m, rocblas_int n, T *A, rocblas_int lda,
+                             rocblas_int *ipiv, T *tau, rocblas_int *info) {
+    return rocsolver_geqrf<T>(handle, m, n, A, lda, tau);
+}
+
+// Factorizes a batch of matrices of different sizes with getrf_vbatched, potrf_vbatched or geqrf_vbatched
+// and compares every matrix with the result of the non-batched routine. The sizes go down from N in steps
+// of 13 and repeat every 3 matrices, so that the batch has several groups with more than one matrix.
+// Odd matrices have m = n + 5 (getrf and geqrf only) and lda = m + 3.
+template <typename T, typename U, int R>
+rocblas_status testing_vbatched(Arguments argus) {
+    rocblas_int N = argus.N;
+    char char_uplo = argus.uplo_option;
+    rocblas_fill uplo = char2rocblas_fill(char_uplo);
+    rocblas_int batch_count = argus.batch_count;
+    bool PO = (R == VBATCHED_POTRF);
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // check invalid arguments
+    if (N < 27 || batch_count < 1)
+        return rocblas_status_invalid_size;
+
+    vector<int> hm(batch_count), hn(batch_count), hlda(batch_count);
+    for (int b = 0; b < batch_count; ++b) {
+        hn[b] = N - 13 * (b % 3);
+        hm[b] = PO ? hn[b] : hn[b] + 5 * (b % 2);
+        hlda[b] = hm[b] + 3 * (b % 2);
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<vector<T>> hA(batch_count), hA1(batch_count), hA2(batch_count);
+    vector<vector<T>> hTau1(batch_count), hTau2(batch_count);
+    vector<vector<int>> hIpiv1(batch_count), hIpiv2(batch_count);
+    vector<int> hinfo1(batch_count), hinfo2(batch_count);
+
+    vector<T*> A(batch_count), Tau(batch_count);
+    vector<rocblas_int*> Ipiv(batch_count);
+    for (int b = 0; b < batch_count; ++b) {
+        rocblas_int size_A = hlda[b] * hn[b];
+        rocblas_int size_P = min(hm[b], hn[b]);
+        hA[b] = vector<T>(size_A);
+        hA1[b] = vector<T>(size_A);
+        hA2[b] = vector<T>(size_A);
+        hTau1[b] = vector<T>(size_P);
+        hTau2[b] = vector<T>(size_P);
+        hIpiv1[b] = vector<int>(size_P);
+        hIpiv2[b] = vector<int>(size_P);
+        hipMalloc(&A[b], sizeof(T) * size_A);
+        hipMalloc(&Tau[b], sizeof(T) * size_P);
+        hipMalloc(&Ipiv[b], sizeof(rocblas_int) * size_P);
+        if (!A[b] || !Tau[b] || !Ipiv[b]) {
+            PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+            return rocblas_status_memory_error;
+        }
+    }
+
+    T **dA, **dTau;
+    rocblas_int **dIpiv;
+    hipMalloc(&dA, sizeof(T*) * batch_count);
+    hipMalloc(&dTau, sizeof(T*) * batch_count);
+    hipMalloc(&dIpiv, sizeof(rocblas_int*) * batch_count);
+    auto dm_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * batch_count), rocblas_test::device_free};
+    rocblas_int *dm = (rocblas_int *)dm_managed.get();
+    auto dn_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * batch_count), rocblas_test::device_free};
+    rocblas_int *dn = (rocblas_int *)dn_managed.get();
+    auto dlda_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * batch_count), rocblas_test::device_free};
+    rocblas_int *dlda = (rocblas_int *)dlda_managed.get();
+    auto dinfo_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int) * batch_count), rocblas_test::device_free};
+    rocblas_int *dinfo = (rocblas_int *)dinfo_managed.get();
+
+    if (!dA || !dTau || !dIpiv || !dm || !dn || !dlda || !dinfo) {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    //initialize full random matrices hA with all entries in [1, 10]. For getrf hA has a dominant
+    //diagonal, for potrf it is made symmetric positive definite as in the potrf tests
+    for (int b = 0; b < batch_count; ++b) {
+        T *a = hA[b].data();
+        rocblas_int n = hn[b], lda = hlda[b];
+        rocblas_init<T>(a, hm[b], n, lda);
+        if (PO) {
+            vector<T> hW(lda * n);
+            for (int i = 0; i < n; i++) {
+                for (int j = 0; j < n; j++)
+                    hW[i + j * lda] = (a[i + j * lda] - T(1)) / T(10);
+            }
+            cblas_gemm(rocblas_operation_none, rocblas_operation_transpose, n, n, n,
+                       (T)1.0, hW.data(), lda, hW.data(), lda, (T)0.0, a, lda);
+            for (int i = 0; i < n; i++)
+                a[i + i * lda] += 1;
+        }
+        else if (R == VBATCHED_GETRF) {
+            for (int i = 0; i < min(hm[b], n); i++)
+                a[i + i * lda] += 400;
+        }
+    }
+
+/* =====================================================================
+           ROCSOLVER
+    =================================================================== */
+    // reference: one matrix at a time
+    for (int b = 0; b < batch_count; ++b) {
+        CHECK_HIP_ERROR(hipMemcpy(A[b], hA[b].data(), sizeof(T) * hA[b].size(), hipMemcpyHostToDevice));
+        CHECK_ROCBLAS_ERROR(factorize_one<T>(std::integral_constant<int,R>(), handle, uplo, hm[b], hn[b], A[b], hlda[b],
+                                             Ipiv[b], Tau[b], dinfo + b));
+        CHECK_HIP_ERROR(hipMemcpy(hA1[b].data(), A[b], sizeof(T) * hA1[b].size(), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hIpiv1[b].data(), Ipiv[b], sizeof(int) * hIpiv1[b].size(), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hTau1[b].data(), Tau[b], sizeof(T) * hTau1[b].size(), hipMemcpyDeviceToHost));
+    }
+    CHECK_HIP_ERROR(hipMemcpy(hinfo1.data(), dinfo, sizeof(int) * batch_count, hipMemcpyDeviceToHost));
+
+    // variable-size batch
+    for (int b = 0; b < batch_count; ++b)
+        CHECK_HIP_ERROR(hipMemcpy(A[b], hA[b].data(), sizeof(T) * hA[b].size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dA, A.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dTau, Tau.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dIpiv, Ipiv.data(), sizeof(rocblas_int*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dm, hm.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dn, hn.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dlda, hlda.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_ROCBLAS_ERROR(factorize_vbatched<T>(std::integral_constant<int,R>(), handle, uplo, dm, dn, dA, dlda,
+                                              dIpiv, dTau, dinfo, batch_count));
+    for (int b = 0; b < batch_count; ++b) {
+        CHECK_HIP_ERROR(hipMemcpy(hA2[b].data(), A[b], sizeof(T) * hA2[b].size(), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hIpiv2[b].data(), Ipiv[b], sizeof(int) * hIpiv2[b].size(), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hTau2[b].data(), Tau[b], sizeof(T) * hTau2[b].size(), hipMemcpyDeviceToHost));
+    }
+    CHECK_HIP_ERROR(hipMemcpy(hinfo2.data(), dinfo, sizeof(int) * batch_count, hipMemcpyDeviceToHost));
+
+    // +++++++++ Error Check +++++++++++++
+    double eps = std::numeric_limits<U>::epsilon();
+    double max_err_1 = 0.0, max_val = 0.0;
+    double diff;
+    for (int b = 0; b < batch_count; ++b) {
+        if (R != VBATCHED_GEQRF)
+            EXPECT_EQ(hinfo1[b], hinfo2[b]);
+
+        // only the triangle of the factor is referenced by potrf
+        for (int i = 0; i < hm[b]; i++) {
+            for (int j = 0; j < hn[b]; j++) {
+                if (PO && (uplo == rocblas_fill_lower ? i < j : i > j))
+                    continue;
+                rocblas_int e = i + j * hlda[b];
+                diff = abs(hA1[b][e]);
+                max_val = max_val > diff ? max_val : diff;
+                diff = abs(hA2[b][e] - hA1[b][e]);
+                max_err_1 = max_err_1 > diff ? max_err_1 : diff;
+            }
+        }
+        for (int i = 0; i < min(hm[b], hn[b]); i++) {
+            if (R == VBATCHED_GETRF)
+                EXPECT_EQ(hIpiv1[b][i], hIpiv2[b][i]);
+            if (R == VBATCHED_GEQRF) {
+                diff = abs(hTau2[b][i] - hTau1[b][i]);
+                max_err_1 = max_err_1 > diff ? max_err_1 : diff;
+            }
+        }
+    }
+    max_err_1 = max_err_1 / max_val;
+    getf2_err_res_check<U>(max_err_1, N, N, ERROR_EPS_MULTIPLIER, eps);
+
+    for (int b = 0; b < batch_count; ++b) {
+        hipFree(A[b]);
+        hipFree(Tau[b]);
+        hipFree(Ipiv[b]);
+    }
+    hipFree(dA);
+    hipFree(dTau);
+    hipFree(dIpiv);
+
+    return rocblas_status_success;
+}
+
+#undef ERROR_EPS_MULTIPLIER
@@ -0,0 +1,144 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "arg_check.h"
+#include "cblas_interface.h"
+#include "norm.h"
+#include "rocblas_test_unique_ptr.hpp"
+#include "rocsolver.hpp"
+#include "unit.h"
+#include "utility.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+
+using namespace std;
+
+// Runs geqrf (getrf = 0) or getrf (getrf = 1) with the workspace managed by the library,
+// then queries the workspace size and runs it again with a workspace provided by the user,
+// also after changing the stream of the handle. All the results must be identical.
+template <typename T, int getrf>
+rocblas_status testing_workspace(Arguments argus) {
+    rocblas_int M = argus.M;
+    rocblas_int N = argus.N;
+    rocblas_int lda = argus.lda;
+    size_t size;
+
+    std::unique_ptr<rocblas_test::handle_struct> unique_ptr_handle(new rocblas_test::handle_struct);
+    rocblas_handle handle = unique_ptr_handle->handle;
+
+    // check invalid arguments
+    if (M < 1 || N < 1 || lda < M)
+        return rocblas_status_invalid_size;
+
+    rocblas_int size_A = lda * N;
+    rocblas_int size_piv = min(M, N);
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> hA(size_A);
+    vector<T> hA1(size_A);
+    vector<T> hA2(size_A);
+    // pivots are compared as raw bytes (rocblas_int for getrf, T for geqrf)
+    vector<char> hIpiv1(sizeof(T) * size_piv);
+    vector<char> hIpiv2(sizeof(T) * size_piv);
+
+    auto dA_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_A), rocblas_test::device_free};
+    T *dA = (T *)dA_managed.get();
+    auto dIpiv_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(T) * size_piv), rocblas_test::device_free};
+    T *dIpiv = (T *)dIpiv_managed.get();
+    auto dinfo_managed = rocblas_unique_ptr{rocblas_test::device_malloc(sizeof(int)), rocblas_test::device_free};
+    rocblas_int *dinfo = (rocblas_int *)dinfo_managed.get();
+
+    if (!dA || !dIpiv || !dinfo) {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+
+    // getrf uses rocblas_int pivots; they are stored in the memory of dIpiv
+    rocblas_int *dIpivInt = (rocblas_int *)dIpiv;
+    auto run = [&]() {
+        if(getrf)
+            return rocsolver_getrf<T>(handle, M, N, dA, lda, dIpivInt, dinfo);
+        else
+            return rocsolver_geqrf<T>(handle, M, N, dA, lda, dIpiv);
+    };
+
+    //initialize full random matrix hA with all entries in [1, 10]
+    rocblas_init<T>(hA.data(), M, N, lda);
+
+    // library-managed workspace
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_ROCBLAS_ERROR(run());
+    CHECK_HIP_ERROR(hipMemcpy(hA1.data(), dA, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hIpiv1.data(), dIpiv, sizeof(T) * size_piv, hipMemcpyDeviceToHost));
+
+    // the device constants of the four precisions are kept together with the handle
+    // (a 2x2 zero matrix of each type, stored at the beginning of dA, is singular but valid)
+    CHECK_HIP_ERROR(hipMemset(dA, 0, 4 * sizeof(rocblas_double_complex)));
+    EXPECT_EQ(rocblas_status_success, rocsolver_getrf<float>(handle, 2, 2, (float *)dA, 2, dIpivInt, dinfo));
+    EXPECT_EQ(rocblas_status_success, rocsolver_getrf<double>(handle, 2, 2, (double *)dA, 2, dIpivInt, dinfo));
+    EXPECT_EQ(rocblas_status_success, rocsolver_getrf<rocblas_float_complex>(handle, 2, 2, (rocblas_float_complex *)dA, 2, dIpivInt, dinfo));
+    EXPECT_EQ(rocblas_status_success, rocsolver_getrf<rocblas_double_complex>(handle, 2, 2, (rocblas_double_complex *)dA, 2, dIpivInt, dinfo));
+
+    // query the workspace size; nothing must be computed
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_ROCBLAS_ERROR(rocsolver_start_workspace_query(handle));
+    CHECK_ROCBLAS_ERROR(run());
+    CHECK_ROCBLAS_ERROR(rocsolver_stop_workspace_query(handle, &size));
+    CHECK_HIP_ERROR(hipMemcpy(hA2.data(), dA, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+    for (int k = 0; k < size_A; ++k)
+        EXPECT_EQ(hA[k], hA2[k]);
+
+    // the workspace always holds at least the constants
+    EXPECT_GT(size, size_t(0));
+
+    // user-provided workspace
+    auto dW_managed = rocblas_unique_ptr{rocblas_test::device_malloc(size), rocblas_test::device_free};
+    void *dW = dW_managed.get();
+    if (!dW) {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return rocblas_status_memory_error;
+    }
+    CHECK_ROCBLAS_ERROR(rocsolver_set_workspace(handle, dW, size));
+    CHECK_ROCBLAS_ERROR(run());
+    CHECK_HIP_ERROR(hipMemcpy(hA2.data(), dA, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hIpiv2.data(), dIpiv, sizeof(T) * size_piv, hipMemcpyDeviceToHost));
+    for (int k = 0; k < size_A; ++k)
+        EXPECT_EQ(hA1[k], hA2[k]);
+    EXPECT_TRUE(hIpiv1 == hIpiv2);
+
+    // a new stream keeps the workspace provided by the user
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, stream));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice));
+    CHECK_ROCBLAS_ERROR(run());
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hipMemcpy(hA2.data(), dA, sizeof(T) * size_A, hipMemcpyDeviceToHost));
+    for (int k = 0; k < size_A; ++k)
+        EXPECT_EQ(hA1[k], hA2[k]);
+    CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, 0));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+    // a handle that is not attached to rocsolver is rejected
+    rocblas_handle plain;
+    CHECK_ROCBLAS_ERROR(rocblas_create_handle(&plain));
+    EXPECT_EQ(rocblas_status_invalid_handle, rocsolver_geqrf<T>(plain, M, N, dA, lda, dIpiv));
+    CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(plain));
+
+    // a workspace that is too small is reported
+    CHECK_ROCBLAS_ERROR(rocsolver_set_workspace(handle, dW, size - 1));
+    EXPECT_EQ(rocblas_status_memory_error, run());
+
+    // give the workspace management back to the library
+    CHECK_ROCBLAS_ERROR(rocsolver_set_workspace(handle, nullptr, 0));
+
+    return rocblas_status_success;
+}
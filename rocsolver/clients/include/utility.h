@@ -360,6 +360,8 @@ public:
 
   rocblas_int iters = 10;
 
+  rocblas_int lookahead = 0;
+
   Arguments &operator=(const Arguments &rhs) {
     M = rhs.M;
     N = rhs.N;
@@ -408,6 +410,8 @@ public:
 
     iters = rhs.iters;
 
+    lookahead = rhs.lookahead;
+
     return *this;
   }
 };
@@ -12,6 +12,7 @@
 
 #include <rocblas.h>
 #include "rocsolver-extra-types.h"
+#include "rocsolver-functions.h"
 
 //rocblas original types
 typedef rocblas_int rocsolver_int;
@@ -30,6 +31,7 @@ typedef rocblas_layer_mode rocsolver_layer_mode;
 //extras types only used in rocsolver
 typedef rocblas_direct rocsolver_direction;
 typedef rocblas_storev rocsolver_storev;
+typedef rocblas_panel rocsolver_panel;
 
 //auxiliaries
 #ifdef __cplusplus
@@ -39,16 +41,28 @@ extern "C" {
 ROCSOLVER_EXPORT __inline rocsolver_status
 rocsolver_create_handle(rocsolver_handle *handle) {
 
-  const rocblas_status stat = rocblas_create_handle(handle);
+  rocblas_status stat = rocblas_create_handle(handle);
   if (stat != rocblas_status_success) {
     return stat;
   }
 
+  stat = rocsolver_attach_handle(*handle);
+  if (stat != rocblas_status_success) {
+    rocblas_destroy_handle(*handle);
+    return stat;
+  }
+
   return rocblas_set_pointer_mode(*handle, rocblas_pointer_mode_device);
 }
 
 ROCSOLVER_EXPORT __inline rocsolver_status
 rocsolver_destroy_handle(rocsolver_handle handle) {
+
+  const rocblas_status stat = rocsolver_detach_handle(handle);
+  if (stat != rocblas_status_success) {
+    return stat;
+  }
+
   return rocblas_destroy_handle(handle);
 }
 
@@ -21,4 +21,14 @@ typedef enum rocblas_storev_
     rocblas_row_wise = 182, /**< Householder vectors are stored in the rows of a matrix. */
 } rocblas_storev;
 
+/*! \brief Used to specify the algorithm that factorizes the panels (block columns) in getrf
+ ********************************************************************************/ 
+typedef enum rocblas_panel_
+{
+    rocblas_panel_auto = 191, /**< The algorithm is chosen according to the size of the panel. */
+    rocblas_panel_unblocked = 192, /**< Panels are factorized column by column. */
+    rocblas_panel_recursive = 193, /**< Panels are split in halves recursively; most of the work is done by trsm and gemm. */
+    rocblas_panel_tournament = 194, /**< The pivots of tall panels are chosen by tournament pivoting (communication-avoiding LU). */
+} rocblas_panel;
+
 #endif
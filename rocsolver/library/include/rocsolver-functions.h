@@ -31,6 +31,208 @@ extern "C" {
 ROCSOLVER_EXPORT rocblas_status rocsolver_get_version_string(char* buf, size_t len);
 
 
+/*
+ * ===========================================================================
+ *      Workspace management
+ * ===========================================================================
+ */
+
+/*! \brief ATTACH_HANDLE creates the rocSOLVER state of a rocblas handle.
+
+    \details
+    rocSOLVER keeps with every handle a state that holds its workspace and its settings
+    (rocsolver_set_workspace, rocsolver_set_getrf_panel, rocsolver_set_getrf_lookahead and
+    rocsolver_set_early_exit). The state is created by this function, which is called by 
+    rocsolver_create_handle, and destroyed by rocsolver_detach_handle, which is called by 
+    rocsolver_destroy_handle. A handle created with rocblas_create_handle must be attached 
+    before it is passed to rocSOLVER, and detached before it is destroyed with 
+    rocblas_destroy_handle; the rocSOLVER functions return rocblas_status_invalid_handle for a 
+    handle that is not attached. 
+
+    Attaching a handle that is already attached replaces its state with a new one (this is 
+    the case of a handle created at the address of one that was destroyed without being detached).
+
+    The state does not depend on the stream of the handle: after rocblas_set_stream the workspace
+    and the settings are kept, and the work on the new stream waits for the work enqueued by 
+    rocSOLVER on the previous one (without blocking the host).
+
+    @param[in]
+    handle    rocblas_handle.
+
+ ******************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_attach_handle(rocblas_handle handle);
+
+/*! \brief DETACH_HANDLE destroys the rocSOLVER state of a rocblas handle.
+
+    \details
+    The workspace (unless it was provided by the user), the device constants and the secondary
+    stream of the handle are freed, and the settings are discarded. See rocsolver_attach_handle.
+
+    @param[in]
+    handle    rocblas_handle.
+
+ ******************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_detach_handle(rocblas_handle handle);
+
+/*! \brief RELEASE_WORKSPACE frees the device memory that rocSOLVER keeps for the given handle.
+
+    \details
+    rocSOLVER functions take the temporary device memory they need from a workspace
+    owned by the handle. The workspace is allocated by the first call that needs it, grows when 
+    a later call requires more memory, and is reused afterwards, so that repeated calls with the same
+    handle do not allocate memory. The handle also keeps in device memory the scalar constants
+    (e.g. 1 and -1) passed to rocBLAS; they are written the first time they are needed to a small
+    area allocated once (or to the head of the workspace provided with rocsolver_set_workspace).
+    The arrays of pointers used to mix batched and strided arguments in rocBLAS calls are taken
+    from the workspace.
+
+    This function frees that memory (a workspace provided by the user is not freed, but it is
+    no longer used) and the secondary stream of the handle. The handle stays attached and keeps 
+    its other settings; the memory is allocated again by the next call that needs it.
+
+    @param[in]
+    handle    rocblas_handle.
+
+ ******************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_release_workspace(rocblas_handle handle);
+
+/*! \brief START_WORKSPACE_QUERY sets the handle in workspace query mode.
+
+    \details
+    While the handle is in query mode, the rocSOLVER functions called with it only validate
+    their arguments and record the size of the workspace they would need; no computation is
+    done and no device memory is allocated. The query mode ends with rocsolver_stop_workspace_query,
+    which returns the largest size recorded (plus the space for the constants kept with the handle).
+
+    @param[in]
+    handle    rocblas_handle.
+
+ ******************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_start_workspace_query(rocblas_handle handle);
+
+/*! \brief STOP_WORKSPACE_QUERY ends the workspace query mode of the handle.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[out]
+    size      pointer to size_t.\n
+              The size (in bytes) of the workspace needed by all the rocSOLVER functions 
+              called with the handle since rocsolver_start_workspace_query.
+
+ ******************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_stop_workspace_query(rocblas_handle handle,
+                                                               size_t *size);
+
+/*! \brief SET_WORKSPACE makes the handle use the given device memory as workspace.
+
+    \details
+    Once a workspace is provided, rocSOLVER functions never allocate device memory; a function
+    that needs more than size bytes returns rocblas_status_memory_error. The first bytes of the
+    workspace hold the scalar constants used by rocSOLVER, and the rest its temporary data.
+    The required size can be obtained with rocsolver_start_workspace_query and 
+    rocsolver_stop_workspace_query. The memory is not freed by rocSOLVER, and must not be
+    modified by the user while it is set as workspace.
+
+    Calling this function with ptr = nullptr and size = 0 returns the workspace management 
+    to the library.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    ptr       pointer to device memory.
+    @param[in]
+    size      size_t.\n
+              The size (in bytes) of the memory pointed by ptr.
+
+ ******************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_set_workspace(rocblas_handle handle,
+                                                        void *ptr,
+                                                        size_t size);
+
+/*! \brief SET_GETRF_PANEL selects the algorithm used by getrf to factorize its panels.
+
+    \details
+    The blocked LU factorization (getrf and its batched versions) factorizes one block column 
+    (panel) at a time. With rocblas_panel_unblocked the panel is factorized column by column; with 
+    rocblas_panel_recursive it is split in halves recursively, so that most of the work is done by 
+    trsm and gemm, which is faster for tall panels. With rocblas_panel_auto (the default) the
+    algorithm is chosen according to the number of rows of the panel.
+
+    With rocblas_panel_tournament, the pivots of very tall panels (thousands of rows) are chosen
+    by tournament pivoting: blocks of rows are factorized independently, and their pivot rows
+    are then reduced pairwise in a binary tree. The panel is factorized without further
+    interchanges once the pivot rows are moved to the top. The pivots may differ from those of
+    partial pivoting, but the factorization is stable in practice. Shorter panels are factorized
+    as with rocblas_panel_auto. The LU factorization without pivoting (getrf_npvt) is not affected.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    panel     rocblas_panel.\n
+              The algorithm to use with this handle.
+
+ ******************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_set_getrf_panel(rocblas_handle handle,
+                                                          const rocblas_panel panel);
+
+/*! \brief SET_GETRF_LOOKAHEAD enables or disables the look-ahead in getrf.
+
+    \details
+    With look-ahead, the blocked LU factorization (getrf and its batched versions) updates the 
+    columns of the next panel first and factorizes that panel on a secondary stream while the 
+    rest of the trailing matrix is updated on the stream of the handle. The secondary stream is 
+    created the first time it is needed and is released with rocsolver_release_workspace. 
+    Look-ahead is disabled by default, and it is not used when the workspace is provided by 
+    the user with rocsolver_set_workspace.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    lookahead rocblas_int.\n
+              If different from 0, getrf uses look-ahead with this handle.
+
+ ******************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_set_getrf_lookahead(rocblas_handle handle,
+                                                              const rocblas_int lookahead);
+
+/*! \brief SET_EARLY_EXIT enables or disables the early exit of the matrices of a batch that fail.
+
+    \details
+    By default, the batched versions of the blocked factorizations (potrf and getrf, and the 
+    drivers that use them) keep updating all the matrices of the batch until the end, even those
+    that were already found to be not positive definite (potrf) or singular (getrf). With early
+    exit, the matrices that failed are dropped from the batch every few block columns, so that
+    the remaining updates (trsm, syrk and gemm) only work on the healthy matrices.
+
+    Dropping the failed matrices needs the number of healthy matrices on the host: each time the
+    batch is compacted, the host waits for all the work queued on the stream of the handle
+    (a hipStreamSynchronize). This happens once every 4 block columns (about n/256 times for
+    matrices of order n), so the calls are not asynchronous with respect to the host anymore; the mode
+    pays off when a significant fraction of the batch fails. The returned info is the same as without
+    early exit, and so are the factors of the healthy matrices. The factors of the matrices that
+    failed are left incomplete (for getrf, the trailing matrix stops being updated some block columns
+    after a zero pivot is found). Matrices that are not batched are not affected.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    early_exit rocblas_int.\n
+              If different from 0, the factorizations use early exit with this handle.
+
+ ******************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_set_early_exit(rocblas_handle handle,
+                                                         const rocblas_int early_exit);
+
+
 /*
  * ===========================================================================
  *      Auxiliary functions
@@ -110,6 +312,143 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zlaswp(rocblas_handle handle,
                                                    const rocblas_int *ipiv, 
                                                    const rocblas_int incx);
 
+/*! \brief IPIV2PERM computes the permutation vector equivalent to a sequence of row interchanges.
+
+    \details
+    The k interchanges in IPIV (as returned by GETRF) are applied, in order, to the
+    rows of the m-by-m identity. On exit, row i of P*A is row PERM[i] of A.
+
+    Unlike the interchanges, the permutation vector can be applied to a matrix in a
+    single parallel pass (see LAPMR).
+
+    @param[in]
+    handle          rocblas_handle
+    @param[in]
+    m               rocblas_int. m >= 0.\n
+                    The number of rows of the matrix to be permuted.
+    @param[in]
+    k               rocblas_int. m >= k >= 0.\n
+                    The number of interchanges in IPIV (min(m,n) after the factorization of an m-by-n matrix).
+    @param[in]
+    ipiv            pointer to rocblas_int. Array on the GPU of dimension k.\n
+                    The vector of pivot indices. Elements of ipiv are considered 1-based.
+    @param[out]
+    perm            pointer to rocblas_int. Array on the GPU of dimension m.\n
+                    The permutation vector. Its elements are 1-based.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_ipiv2perm(rocblas_handle handle,
+                                                   const rocblas_int m,
+                                                   const rocblas_int k,
+                                                   const rocblas_int *ipiv,
+                                                   rocblas_int *perm);
+
+/*! \brief IPIV2PERM_BATCHED computes the permutation vectors equivalent to sequences of row interchanges
+    for a batch of matrices.
+
+    \details
+    The k interchanges in IPIV_j (as returned by GETRF_BATCHED or GETRF_STRIDED_BATCHED) are applied,
+    in order, to the rows of the m-by-m identity. On exit, row i of P_j*A_j is row PERM_j[i] of A_j.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[in]
+    m               rocblas_int. m >= 0.\n
+                    The number of rows of the matrices to be permuted.
+    @param[in]
+    k               rocblas_int. m >= k >= 0.\n
+                    The number of interchanges in each IPIV_j.
+    @param[in]
+    ipiv            pointer to rocblas_int. Array on the GPU (the size depends on the value of strideP).\n
+                    Contains the vectors of pivot indices IPIV_j (corresponding to A_j).
+                    Elements of ipiv are considered 1-based.
+    @param[in]
+    strideP         rocblas_stride.\n
+                    Stride from the start of one vector IPIV_j to the next one IPIV_(j+1).
+    @param[out]
+    perm            pointer to rocblas_int. Array on the GPU (the size depends on the value of strideQ).\n
+                    Contains the permutation vectors PERM_j. Their elements are 1-based.
+    @param[in]
+    strideQ         rocblas_stride.\n
+                    Stride from the start of one vector PERM_j to the next one PERM_(j+1).
+                    There is no restriction for the value of strideQ. Normal use case is strideQ >= m.
+    @param[in]
+    batch_count     rocblas_int. batch_count >= 0.\n
+                    Number of matrices in the batch.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_ipiv2perm_batched(rocblas_handle handle,
+                                                   const rocblas_int m,
+                                                   const rocblas_int k,
+                                                   const rocblas_int *ipiv,
+                                                   const rocblas_stride strideP,
+                                                   rocblas_int *perm,
+                                                   const rocblas_stride strideQ,
+                                                   const rocblas_int batch_count);
+
+/*! \brief LAPMR rearranges the rows of the matrix X as specified by a permutation vector.
+
+    \details
+    If direct is forward, row PERM[i] of X is moved to row i (X is overwritten by P*X,
+    with PERM as computed by IPIV2PERM). If direct is backward, row i of X is moved to
+    row PERM[i] (X is overwritten by P'*X).
+
+    All the rows are moved at once, with a copy of X kept in the workspace.
+
+    @param[in]
+    handle          rocblas_handle
+    @param[in]
+    direct          rocblas_direct.\n
+                    Specifies whether the permutation is applied forward or backward.
+    @param[in]
+    m               rocblas_int. m >= 0.\n
+                    The number of rows of the matrix X.
+    @param[in]
+    n               rocblas_int. n >= 0.\n
+                    The number of columns of the matrix X.
+    @param[inout]
+    X               pointer to type. Array on the GPU of dimension ldx*n. \n
+                    On entry, the matrix X. On exit, the permuted matrix.
+    @param[in]
+    ldx             rocblas_int. ldx >= m.\n
+                    The leading dimension of the array X.
+    @param[in]
+    perm            pointer to rocblas_int. Array on the GPU of dimension m.\n
+                    The permutation vector. Elements of perm are considered 1-based.
+    *************************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_slapmr(rocblas_handle handle,
+                                                   const rocblas_direct direct,
+                                                   const rocblas_int m,
+                                                   const rocblas_int n,
+                                                   float *X,
+                                                   const rocblas_int ldx,
+                                                   const rocblas_int *perm);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dlapmr(rocblas_handle handle,
+                                                   const rocblas_direct direct,
+                                                   const rocblas_int m,
+                                                   const rocblas_int n,
+                                                   double *X,
+                                                   const rocblas_int ldx,
+                                                   const rocblas_int *perm);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_clapmr(rocblas_handle handle,
+                                                   const rocblas_direct direct,
+                                                   const rocblas_int m,
+                                                   const rocblas_int n,
+                                                   rocblas_float_complex *X,
+                                                   const rocblas_int ldx,
+                                                   const rocblas_int *perm);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zlapmr(rocblas_handle handle,
+                                                   const rocblas_direct direct,
+                                                   const rocblas_int m,
+                                                   const rocblas_int n,
+                                                   rocblas_double_complex *X,
+                                                   const rocblas_int ldx,
+                                                   const rocblas_int *perm);
+
 /*! \brief LARFG generates an orthogonal Householder reflector H of order n. 
 
     \details
@@ -1667,426 +2006,616 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_strided_batched(rocblas_handle
                                                    rocblas_int *info,
                                                    const rocblas_int batch_count);
 
-/*! \brief GEQR2 computes a QR factorization of a general m-by-n matrix A.
+/*! \brief GETRF_VBATCHED computes the LU factorization of a batch of general matrices of
+    different sizes using partial pivoting with row interchanges.
 
     \details
-    (This is the unblocked version of the algorithm).
-
-    The factorization has the form
-
-        A =  Q * [ R ]
-                 [ 0 ]
-
-    where R is upper triangular (upper trapezoidal if m < n), and Q is 
-    a m-by-m orthogonal matrix represented as the product of Householder matrices
+    The factorization of the m_i-by-n_i matrix A_i in the batch has the form
 
-        Q = H(1) * H(2) * ... * H(k), with k = min(m,n)
+        A_i = P_i * L_i * U_i
 
-    Each Householder matrix H(i), for i = 1,2,...,k, is given by
+    where P_i is a permutation matrix, L_i is lower triangular with unit
+    diagonal elements (lower trapezoidal if m_i > n_i), and U_i is upper
+    triangular (upper trapezoidal if m_i < n_i).
 
-        H(i) = I - ipiv[i-1] * v(i) * v(i)'
-    
-    where the first i-1 elements of the Householder vector v(i) are zero, and v(i)[i] = 1. 
+    The sizes are read from the GPU (this synchronizes the stream of the handle) and the matrices 
+    with the same sizes are factorized together, with the algorithm that
+    getrf_batched uses for that size. No matrix is padded. A batch with S distinct sizes
+    costs S calls of getrf_batched; unless the workspace was provided by the user, they are
+    spread over the stream of the handle and a secondary stream that run concurrently.
 
     @param[in]
     handle    rocblas_handle.
     @param[in]
-    m         rocblas_int. m >= 0.\n
-              The number of rows of the matrix A.
+    m         pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              The number of rows m_i >= 0 of the matrices A_i.
     @param[in]
-    n         rocblas_int. n >= 0.\n
-              The number of colums of the matrix A.
+    n         pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              The number of colums n_i >= 0 of the matrices A_i.
     @param[inout]
-    A         pointer to type. Array on the GPU of dimension lda*n.\n
-              On entry, the m-by-n matrix to be factored.
-              On exit, the elements on and above the diagonal contain the 
-              factor R; the elements below the diagonal are the m - i elements
-              of vector v(i) for i = 1,2,...,min(m,n).
+    A         array of pointers to type. Each pointer points to an array on the GPU of dimension lda_i*n_i.\n
+              On entry, the matrices A_i to be factored.
+              On exit, the factors L_i and U_i from the factorizations.
+              The unit diagonal elements of L_i are not stored.
     @param[in]
-    lda       rocblas_int. lda >= m.\n
-              Specifies the leading dimension of A. 
+    lda       pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              The leading dimensions lda_i >= m_i of the matrices A_i.
     @param[out]
-    ipiv      pointer to type. Array on the GPU of dimension min(m,n).\n
-              The scalar factors of the Householder matrices H(i).
-
+    ipiv      array of pointers to rocblas_int. Each pointer points to an array on the GPU of dimension min(m_i,n_i).\n
+              The vectors of pivot indices ipiv_i (corresponding to A_i). 
+              Elements of ipiv_i are 1-based indices.
+              For each instance A_i in the batch and for 1 <= j <= min(m_i,n_i), the row j of the
+              matrix A_i was interchanged with row ipiv_i(j).
+    @param[out]
+    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              If info_i = 0, succesful exit for factorization of A_i. 
+              If info_i = j > 0, U_i is singular. U_i(j,j) is the first zero pivot.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of matrices in the batch. 
+            
     ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqr2(rocblas_handle handle, 
-                                                 const rocblas_int m, 
-                                                 const rocblas_int n, 
-                                                 float *A,
-                                                 const rocblas_int lda, 
-                                                 float *ipiv);
-
-ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqr2(rocblas_handle handle, 
-                                                 const rocblas_int m, 
-                                                 const rocblas_int n, 
-                                                 double *A,
-                                                 const rocblas_int lda, 
-                                                 double *ipiv);
-
-/*! \brief GEQR2_BATCHED computes the QR factorization of a batch of general m-by-n matrices.
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_vbatched(rocblas_handle handle,
+                                                   const rocblas_int *m,
+                                                   const rocblas_int *n, 
+                                                   float *const A[],
+                                                   const rocblas_int *lda,
+                                                   rocblas_int *const ipiv[],
+                                                   rocblas_int *info,
+                                                   const rocblas_int batch_count);
 
-    \details
-    (This is the unblocked version of the algorithm).
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_vbatched(rocblas_handle handle,
+                                                   const rocblas_int *m,
+                                                   const rocblas_int *n, 
+                                                   double *const A[],
+                                                   const rocblas_int *lda,
+                                                   rocblas_int *const ipiv[],
+                                                   rocblas_int *info,
+                                                   const rocblas_int batch_count);
 
-    The factorization of matrix A_j in the batch has the form
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_vbatched(rocblas_handle handle,
+                                                   const rocblas_int *m,
+                                                   const rocblas_int *n, 
+                                                   rocblas_float_complex *const A[],
+                                                   const rocblas_int *lda,
+                                                   rocblas_int *const ipiv[],
+                                                   rocblas_int *info,
+                                                   const rocblas_int batch_count);
 
-        A_j =  Q_j * [ R_j ]
-                     [  0  ]
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_vbatched(rocblas_handle handle,
+                                                   const rocblas_int *m,
+                                                   const rocblas_int *n, 
+                                                   rocblas_double_complex *const A[],
+                                                   const rocblas_int *lda,
+                                                   rocblas_int *const ipiv[],
+                                                   rocblas_int *info,
+                                                   const rocblas_int batch_count);
 
-    where R_j is upper triangular (upper trapezoidal if m < n), and Q_j is 
-    a m-by-m orthogonal matrix represented as the product of Householder matrices
+/*! \brief GBTRF computes the LU factorization of a general m-by-n band matrix A
+    using partial pivoting with row interchanges.
 
-        Q_j = H_j(1) * H_j(2) * ... * H_j(k), with k = min(m,n)
+    \details
+    The factorization has the form
 
-    Each Householder matrices H_j(i), for j = 1,2,...,batch_count, and i = 1,2,...,k, is given by
+        A = P * L * U
 
-        H_j(i) = I - ipiv_j[i-1] * v_j(i) * v_j(i)'
+    where P is a permutation matrix, L is lower triangular with unit
+    diagonal elements and at most kl non-zero elements below the diagonal in each column,
+    and U is upper triangular with kl+ku super-diagonals.
 
-    where the first i-1 elements of Householder vector v_j(i) are zero, and v_j(i)[i] = 1. 
+    The matrix is given in band storage with kl sub-diagonals and ku super-diagonals: A(i,j) is stored 
+    in AB[kl+ku+i-j + j*ldab] for max(0,j-ku) <= i <= min(m-1,j+kl). The first kl rows of AB are used 
+    for the fill-in and need not be set on entry. On exit, U is stored as a band matrix with kl+ku 
+    super-diagonals in the first kl+ku+1 rows of AB, and the multipliers of L in the following kl rows.
+    The factorization works on the window of kl+1 rows below each diagonal element, so the cost is 
+    O(n*kl*(kl+ku)).
 
     @param[in]
     handle    rocblas_handle.
     @param[in]
     m         rocblas_int. m >= 0.\n
-              The number of rows of all the matrices A_j in the batch.
+              The number of rows of the matrix A.
     @param[in]
     n         rocblas_int. n >= 0.\n
-              The number of colums of all the matrices A_j in the batch.
+              The number of colums of the matrix A.
+    @param[in]
+    kl        rocblas_int. kl >= 0.\n
+              The number of sub-diagonals of the matrix A.
+    @param[in]
+    ku        rocblas_int. ku >= 0.\n
+              The number of super-diagonals of the matrix A.
     @param[inout]
-    A         Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
-              On entry, the m-by-n matrices A_j to be factored.
-              On exit, the elements on and above the diagonal contain the 
-              factor R_j. The elements below the diagonal are the m - i elements
-              of vector v_j(i) for i=1,2,...,min(m,n).
+    AB        pointer to type. Array on the GPU of dimension ldab*n.\n
+              On entry, the band matrix A in rows kl to 2*kl+ku of AB.
+              On exit, the factors L and U in band storage.
     @param[in]
-    lda       rocblas_int. lda >= m.\n
-              Specifies the leading dimension of matrices A_j. 
+    ldab      rocblas_int. ldab >= 2*kl+ku+1.\n
+              The leading dimension of AB.
     @param[out]
-    ipiv      pointer to type. Array on the GPU (the size depends on the value of strideP).\n
-              Contains the vectors ipiv_j of scalar factors of the 
-              Householder matrices H_j(i).
-    @param[in]
-    strideP   rocblas_stride.\n
-              Stride from the start of one vector ipiv_j to the next one ipiv_(j+1). 
-              There is no restriction for the value
-              of strideP. Normal use is strideP >= min(m,n).
-    @param[in]
-    batch_count  rocblas_int. batch_count >= 0.\n
-                 Number of matrices in the batch.
+    ipiv      pointer to rocblas_int. Array on the GPU of dimension min(m,n).\n
+              The vector of pivot indices. Elements of ipiv are 1-based indices.
+              For 1 <= i <= min(m,n), the row i of the
+              matrix was interchanged with row ipiv[i].
+    @param[out]
+    info      pointer to a rocblas_int on the GPU.\n
+              If info = 0, succesful exit. 
+              If info = i > 0, U is singular. U(i,i) is the first zero pivot.
 
     ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqr2_batched(rocblas_handle handle, 
-                                                         const rocblas_int m, 
-                                                         const rocblas_int n, 
-                                                         float *const A[],
-                                                         const rocblas_int lda, 
-                                                         float *ipiv, 
-                                                         const rocblas_stride strideP, 
-                                                         const rocblas_int batch_count);
-
-ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqr2_batched(rocblas_handle handle, 
-                                                         const rocblas_int m, 
-                                                         const rocblas_int n, 
-                                                         double *const A[],
-                                                         const rocblas_int lda, 
-                                                         double *ipiv, 
-                                                         const rocblas_stride strideP, 
-                                                         const rocblas_int batch_count);
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgbtrf(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n, 
+                                                 const rocblas_int kl, 
+                                                 const rocblas_int ku, 
+                                                 float *AB,
+                                                 const rocblas_int ldab,
+                                                 rocblas_int *ipiv,
+                                                 rocblas_int* info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgbtrf(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n, 
+                                                 const rocblas_int kl, 
+                                                 const rocblas_int ku, 
+                                                 double *AB,
+                                                 const rocblas_int ldab,
+                                                 rocblas_int *ipiv,
+                                                 rocblas_int* info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgbtrf(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n, 
+                                                 const rocblas_int kl, 
+                                                 const rocblas_int ku, 
+                                                 rocblas_float_complex *AB,
+                                                 const rocblas_int ldab,
+                                                 rocblas_int *ipiv,
+                                                 rocblas_int* info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgbtrf(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n, 
+                                                 const rocblas_int kl, 
+                                                 const rocblas_int ku, 
+                                                 rocblas_double_complex *AB,
+                                                 const rocblas_int ldab,
+                                                 rocblas_int *ipiv,
+                                                 rocblas_int* info);
 
-/*! \brief GEQR2_STRIDED_BATCHED computes the QR factorization of a batch of general m-by-n matrices.
+/*! \brief GBTRF_BATCHED computes the LU factorization of a batch of general m-by-n band
+    matrices using partial pivoting with row interchanges.
 
     \details
-    (This is the unblocked version of the algorithm).
-
     The factorization of matrix A_j in the batch has the form
 
-        A_j =  Q_j * [ R_j ]
-                     [  0  ] 
-
-    where R_j is upper triangular (upper trapezoidal if m < n), and Q_j is 
-    a m-by-m orthogonal matrix represented as the product of Householder matrices
-
-        Q_j = H_j(1) * H_j(2) * ... * H_j(k), with k = min(m,n)
-
-    Each Householder matrices H_j(i), for j = 1,2,...,batch_count, and i = 1,2,...,k, is given by
+        A_j = P_j * L_j * U_j
 
-        H_j(i) = I - ipiv_j[i-1] * v_j(i) * v_j(i)'
+    where P_j is a permutation matrix, L_j is lower triangular with unit
+    diagonal elements and at most kl non-zero elements below the diagonal in each column,
+    and U_j is upper triangular with kl+ku super-diagonals.
 
-    where the first i-1 elements of Householder vector v_j(i) are zero, and v_j(i)[i] = 1. 
+    The matrices are given in band storage as described in GBTRF.
 
     @param[in]
     handle    rocblas_handle.
     @param[in]
     m         rocblas_int. m >= 0.\n
-              The number of rows of all the matrices A_j in the batch.
+              The number of rows of all matrices A_j.
     @param[in]
     n         rocblas_int. n >= 0.\n
-              The number of colums of all the matrices A_j in the batch.
-    @param[inout]
-    A         pointer to type. Array on the GPU (the size depends on the value of strideA).\n
-              On entry, the m-by-n matrices A_j to be factored.
-              On exit, the elements on and above the diagonal contain the 
-              factor R_j. The elements below the diagonal are the m - i elements
-              of vector v_j(i) for i = 1,2,...,min(m,n).
+              The number of colums of all matrices A_j.
     @param[in]
-    lda       rocblas_int. lda >= m.\n
-              Specifies the leading dimension of matrices A_j. 
+    kl        rocblas_int. kl >= 0.\n
+              The number of sub-diagonals of all matrices A_j.
     @param[in]
-    strideA   rocblas_stride.\n   
-              Stride from the start of one matrix A_j and the next one A_(j+1). 
-              There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    ku        rocblas_int. ku >= 0.\n
+              The number of super-diagonals of all matrices A_j.
+    @param[inout]
+    AB        array of pointers to type. Each pointer points to an array on the GPU of dimension ldab*n.\n
+              On entry, the band matrix A_j in rows kl to 2*kl+ku of AB_j.
+              On exit, the factors L_j and U_j in band storage.
+    @param[in]
+    ldab      rocblas_int. ldab >= 2*kl+ku+1.\n
+              The leading dimension of the arrays AB_j.
     @param[out]
-    ipiv      pointer to type. Array on the GPU (the size depends on the value of strideP).\n
-              Contains the vectors ipiv_j of scalar factors of the 
-              Householder matrices H_j(i).
+    ipiv      pointer to rocblas_int. Array on the GPU (the size depends on the value of strideP).\n
+              Contains the vectors of pivots indices ipiv_j (corresponding to A_j). 
+              Dimension of ipiv_j is min(m,n).
+              Elements of ipiv_j are 1-based indices.
+              For each instance A_j in the batch and for 1 <= i <= min(m,n), the row i of the
+              matrix A_j was interchanged with row ipiv_j[i].
     @param[in]
     strideP   rocblas_stride.\n
-              Stride from the start of one vector ipiv_j to the next one ipiv_(j+1). 
-              There is no restriction for the value
-              of strideP. Normal use is strideP >= min(m,n).
+              Stride from the start of one vector ipiv_j to the next one ipiv_(j+1).
+              There is no restriction for the value of strideP. Normal use case is strideP >= min(m,n).
+    @param[out]
+    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              If info_j = 0, succesful exit for factorization of A_j. 
+              If info_j = i > 0, U_j is singular. U_j(i,i) is the first zero pivot.
     @param[in]
-    batch_count  rocblas_int. batch_count >= 0.\n
-                 Number of matrices in the batch.
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of matrices in the batch. 
 
     ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqr2_strided_batched(rocblas_handle handle, 
-                                                                 const rocblas_int m, 
-                                                                 const rocblas_int n, 
-                                                                 float *A,
-                                                                 const rocblas_int lda, 
-                                                                 const rocblas_stride strideA, 
-                                                                 float *ipiv, 
-                                                                 const rocblas_stride strideP, 
-                                                                 const rocblas_int batch_count);
-
-ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqr2_strided_batched(rocblas_handle handle, 
-                                                                 const rocblas_int m, 
-                                                                 const rocblas_int n, 
-                                                                 double *A,
-                                                                 const rocblas_int lda, 
-                                                                 const rocblas_stride strideA, 
-                                                                 double *ipiv, 
-                                                                 const rocblas_stride strideP, 
-                                                                 const rocblas_int batch_count);
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgbtrf_batched(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n, 
+                                                 const rocblas_int kl, 
+                                                 const rocblas_int ku, 
+                                                 float *const AB[],
+                                                 const rocblas_int ldab,
+                                                 rocblas_int *ipiv, const rocblas_stride strideP,
+                                                 rocblas_int* info, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgbtrf_batched(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n, 
+                                                 const rocblas_int kl, 
+                                                 const rocblas_int ku, 
+                                                 double *const AB[],
+                                                 const rocblas_int ldab,
+                                                 rocblas_int *ipiv, const rocblas_stride strideP,
+                                                 rocblas_int* info, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgbtrf_batched(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n, 
+                                                 const rocblas_int kl, 
+                                                 const rocblas_int ku, 
+                                                 rocblas_float_complex *const AB[],
+                                                 const rocblas_int ldab,
+                                                 rocblas_int *ipiv, const rocblas_stride strideP,
+                                                 rocblas_int* info, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgbtrf_batched(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n, 
+                                                 const rocblas_int kl, 
+                                                 const rocblas_int ku, 
+                                                 rocblas_double_complex *const AB[],
+                                                 const rocblas_int ldab,
+                                                 rocblas_int *ipiv, const rocblas_stride strideP,
+                                                 rocblas_int* info, const rocblas_int batch_count);
 
-/*! \brief GELQ2 computes a LQ factorization of a general m-by-n matrix A.
+/*! \brief GBTRF_STRIDED_BATCHED computes the LU factorization of a batch of general m-by-n band
+    matrices using partial pivoting with row interchanges.
 
     \details
-    (This is the unblocked version of the algorithm).
-
-    The factorization has the form
-
-        A = [ L 0 ] * Q
- 
-    where L is lower triangular (lower trapezoidal if m > n), and Q is 
-    a n-by-n orthogonal matrix represented as the product of Householder matrices
+    The factorization of matrix A_j in the batch has the form
 
-        Q = H(k) * H(k-1) * ... * H(1), with k = min(m,n)
+        A_j = P_j * L_j * U_j
 
-    Each Householder matrix H(i), for i = 1,2,...,k, is given by
+    where P_j is a permutation matrix, L_j is lower triangular with unit
+    diagonal elements and at most kl non-zero elements below the diagonal in each column,
+    and U_j is upper triangular with kl+ku super-diagonals.
 
-        H(i) = I - ipiv[i-1] * v(i)' * v(i)
-    
-    where the first i-1 elements of the Householder vector v(i) are zero, and v(i)[i] = 1. 
+    The matrices are given in band storage as described in GBTRF.
 
     @param[in]
     handle    rocblas_handle.
     @param[in]
     m         rocblas_int. m >= 0.\n
-              The number of rows of the matrix A.
+              The number of rows of all matrices A_j.
     @param[in]
     n         rocblas_int. n >= 0.\n
-              The number of colums of the matrix A.
+              The number of colums of all matrices A_j.
+    @param[in]
+    kl        rocblas_int. kl >= 0.\n
+              The number of sub-diagonals of all matrices A_j.
+    @param[in]
+    ku        rocblas_int. ku >= 0.\n
+              The number of super-diagonals of all matrices A_j.
     @param[inout]
-    A         pointer to type. Array on the GPU of dimension lda*n.\n
-              On entry, the m-by-n matrix to be factored.
-              On exit, the elements on and delow the diagonal contain the 
-              factor L; the elements above the diagonal are the n - i elements
-              of vector v(i) for i = 1,2,...,min(m,n).
+    AB        pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+              On entry, the band matrix A_j in rows kl to 2*kl+ku of AB_j.
+              On exit, the factors L_j and U_j in band storage.
     @param[in]
-    lda       rocblas_int. lda >= m.\n
-              Specifies the leading dimension of A. 
+    ldab      rocblas_int. ldab >= 2*kl+ku+1.\n
+              The leading dimension of the arrays AB_j.
+    @param[in]
+    strideA   rocblas_stride.\n
+              Stride from the start of one band matrix AB_j and the next one. 
+              There is no restriction for the value of strideA. Normal use case is strideA >= ldab*n.
     @param[out]
-    ipiv      pointer to type. Array on the GPU of dimension min(m,n).\n
-              The scalar factors of the Householder matrices H(i).
+    ipiv      pointer to rocblas_int. Array on the GPU (the size depends on the value of strideP).\n
+              Contains the vectors of pivots indices ipiv_j (corresponding to A_j). 
+              Dimension of ipiv_j is min(m,n).
+              Elements of ipiv_j are 1-based indices.
+              For each instance A_j in the batch and for 1 <= i <= min(m,n), the row i of the
+              matrix A_j was interchanged with row ipiv_j[i].
+    @param[in]
+    strideP   rocblas_stride.\n
+              Stride from the start of one vector ipiv_j to the next one ipiv_(j+1).
+              There is no restriction for the value of strideP. Normal use case is strideP >= min(m,n).
+    @param[out]
+    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              If info_j = 0, succesful exit for factorization of A_j. 
+              If info_j = i > 0, U_j is singular. U_j(i,i) is the first zero pivot.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of matrices in the batch. 
 
     ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_sgelq2(rocblas_handle handle, 
-                                                 const rocblas_int m, 
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgbtrf_strided_batched(rocblas_handle handle,
+                                                 const rocblas_int m,
                                                  const rocblas_int n, 
-                                                 float *A,
-                                                 const rocblas_int lda, 
-                                                 float *ipiv);
-
-ROCSOLVER_EXPORT rocblas_status rocsolver_dgelq2(rocblas_handle handle, 
-                                                 const rocblas_int m, 
+                                                 const rocblas_int kl, 
+                                                 const rocblas_int ku, 
+                                                 float *AB,
+                                                 const rocblas_int ldab, const rocblas_stride strideA,
+                                                 rocblas_int *ipiv, const rocblas_stride strideP,
+                                                 rocblas_int* info, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgbtrf_strided_batched(rocblas_handle handle,
+                                                 const rocblas_int m,
                                                  const rocblas_int n, 
-                                                 double *A,
-                                                 const rocblas_int lda, 
-                                                 double *ipiv);
+                                                 const rocblas_int kl, 
+                                                 const rocblas_int ku, 
+                                                 double *AB,
+                                                 const rocblas_int ldab, const rocblas_stride strideA,
+                                                 rocblas_int *ipiv, const rocblas_stride strideP,
+                                                 rocblas_int* info, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgbtrf_strided_batched(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n, 
+                                                 const rocblas_int kl, 
+                                                 const rocblas_int ku, 
+                                                 rocblas_float_complex *AB,
+                                                 const rocblas_int ldab, const rocblas_stride strideA,
+                                                 rocblas_int *ipiv, const rocblas_stride strideP,
+                                                 rocblas_int* info, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgbtrf_strided_batched(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n, 
+                                                 const rocblas_int kl, 
+                                                 const rocblas_int ku, 
+                                                 rocblas_double_complex *AB,
+                                                 const rocblas_int ldab, const rocblas_stride strideA,
+                                                 rocblas_int *ipiv, const rocblas_stride strideP,
+                                                 rocblas_int* info, const rocblas_int batch_count);
 
-/*! \brief GELQ2_BATCHED computes the LQ factorization of a batch of general m-by-n matrices.
+/*! \brief GETRF_NPVT computes the LU factorization of a general m-by-n matrix A
+    without pivoting.
 
     \details
-    (This is the unblocked version of the algorithm).
-
-    The factorization of matrix A_j in the batch has the form
-
-        A_j = [ L_j 0 ] * Q_j 
-
-    where L_j is lower triangular (lower trapezoidal if m > n), and Q_j is 
-    a n-by-n orthogonal matrix represented as the product of Householder matrices
+    (This is the right-looking Level 3 BLAS version of the algorithm).
 
-        Q_j = H_j(k) * H_j(k-1) * ... * H_j(1), with k = min(m,n)
+    The factorization has the form
 
-    Each Householder matrices H_j(i), for j = 1,2,...,batch_count, and i = 1,2,...,k, is given by
+        A = L * U
 
-        H_j(i) = I - ipiv_j[i-1] * v_j(i)' * v_j(i)
+    where L is lower triangular with unit
+    diagonal elements (lower trapezoidal if m > n), and U is upper
+    triangular (upper trapezoidal if m < n).
 
-    where the first i-1 elements of Householder vector v_j(i) are zero, and v_j(i)[i] = 1. 
+    No row interchanges are done, so the factorization is only stable for matrices such as
+    the diagonally dominant ones. A zero pivot is still reported in info.
 
     @param[in]
     handle    rocblas_handle.
     @param[in]
     m         rocblas_int. m >= 0.\n
-              The number of rows of all the matrices A_j in the batch.
+              The number of rows of the matrix A. 
     @param[in]
     n         rocblas_int. n >= 0.\n
-              The number of colums of all the matrices A_j in the batch.
+              The number of colums of the matrix A. 
     @param[inout]
-    A         Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
-              On entry, the m-by-n matrices A_j to be factored.
-              On exit, the elements on and below the diagonal contain the 
-              factor L_j. The elements above the diagonal are the n - i elements
-              of vector v_j(i) for i=1,2,...,min(m,n).
+    A         pointer to type. Array on the GPU of dimension lda*n.\n
+              On entry, the m-by-n matrix A to be factored.
+              On exit, the factors L and U from the factorization.
+              The unit diagonal elements of L are not stored.
     @param[in]
     lda       rocblas_int. lda >= m.\n
-              Specifies the leading dimension of matrices A_j. 
+              Specifies the leading dimension of A. 
     @param[out]
-    ipiv      pointer to type. Array on the GPU (the size depends on the value of strideP).\n
-              Contains the vectors ipiv_j of scalar factors of the 
-              Householder matrices H_j(i).
-    @param[in]
-    strideP   rocblas_stride.\n
-              Stride from the start of one vector ipiv_j to the next one ipiv_(j+1). 
-              There is no restriction for the value
-              of strideP. Normal use is strideP >= min(m,n).
-    @param[in]
-    batch_count  rocblas_int. batch_count >= 0.\n
-                 Number of matrices in the batch.
-
+    info      pointer to a rocblas_int on the GPU.\n
+              If info = 0, succesful exit. 
+              If info = i > 0, U is singular. U(i,i) is the first zero pivot.
+            
     ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_sgelq2_batched(rocblas_handle handle, 
-                                                         const rocblas_int m, 
-                                                         const rocblas_int n, 
-                                                         float *const A[],
-                                                         const rocblas_int lda, 
-                                                         float *ipiv, 
-                                                         const rocblas_stride strideP, 
-                                                         const rocblas_int batch_count);
-
-ROCSOLVER_EXPORT rocblas_status rocsolver_dgelq2_batched(rocblas_handle handle, 
-                                                         const rocblas_int m, 
-                                                         const rocblas_int n, 
-                                                         double *const A[],
-                                                         const rocblas_int lda, 
-                                                         double *ipiv, 
-                                                         const rocblas_stride strideP, 
-                                                         const rocblas_int batch_count);
-
-/*! \brief GELQ2_STRIDED_BATCHED computes the LQ factorization of a batch of general m-by-n matrices.
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_npvt(rocblas_handle handle,
+                                                        const rocblas_int m,
+                                                        const rocblas_int n, 
+                                                        float *A,
+                                                        const rocblas_int lda,
+                                                        rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_npvt(rocblas_handle handle,
+                                                        const rocblas_int m,
+                                                        const rocblas_int n, 
+                                                        double *A,
+                                                        const rocblas_int lda,
+                                                        rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_npvt(rocblas_handle handle,
+                                                        const rocblas_int m,
+                                                        const rocblas_int n, 
+                                                        rocblas_float_complex *A,
+                                                        const rocblas_int lda,
+                                                        rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_npvt(rocblas_handle handle,
+                                                        const rocblas_int m,
+                                                        const rocblas_int n, 
+                                                        rocblas_double_complex *A,
+                                                        const rocblas_int lda,
+                                                        rocblas_int *info);
+
+/*! \brief GETRF_NPVT_BATCHED computes the LU factorization of a batch of general m-by-n matrices
+    without pivoting.
 
     \details
-    (This is the unblocked version of the algorithm).
-
-    The factorization of matrix A_j in the batch has the form
-
-        A_j = [ L_j 0 ] * Q_j 
-
-    where L_j is lower triangular (lower trapezoidal if m > n), and Q_j is 
-    a n-by-n orthogonal matrix represented as the product of Householder matrices
+    (This is the right-looking Level 3 BLAS version of the algorithm).
 
-        Q_j = H_j(k) * H_j(k-1) * ... * H_j(1), with k = min(m,n)
+    The factorization of matrix A_i in the batch has the form
 
-    Each Householder matrices H_j(i), for j = 1,2,...,batch_count, and i = 1,2,...,k, is given by
+        A_i = L_i * U_i
 
-        H_j(i) = I - ipiv_j[i-1] * v_j(i)' * v_j(i)
+    where L_i is lower triangular with unit
+    diagonal elements (lower trapezoidal if m > n), and U_i is upper
+    triangular (upper trapezoidal if m < n).
 
-    where the first i-1 elements of vector Householder vector v_j(i) are zero, and v_j(i)[i] = 1. 
+    No row interchanges are done, so the factorization is only stable for matrices such as
+    the diagonally dominant ones. A zero pivot is still reported in info.
 
     @param[in]
     handle    rocblas_handle.
     @param[in]
     m         rocblas_int. m >= 0.\n
-              The number of rows of all the matrices A_j in the batch.
+              The number of rows of all matrices A_i in the batch.
     @param[in]
     n         rocblas_int. n >= 0.\n
-              The number of colums of all the matrices A_j in the batch.
+              The number of colums of all matrices A_i in the batch.
     @param[inout]
-    A         pointer to type. Array on the GPU (the size depends on the value of strideA).\n
-              On entry, the m-by-n matrices A_j to be factored.
-              On exit, the elements on and below the diagonal contain the 
-              factor L_j. The elements above the diagonal are the n - i elements
-              of vector v_j(i) for i = 1,2,...,min(m,n).
+    A         array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+              On entry, the m-by-n matrices A_i to be factored.
+              On exit, the factors L_i and U_i from the factorizations.
+              The unit diagonal elements of L_i are not stored.
     @param[in]
     lda       rocblas_int. lda >= m.\n
-              Specifies the leading dimension of matrices A_j. 
-    @param[in]
-    strideA   rocblas_stride.\n   
-              Stride from the start of one matrix A_j and the next one A_(j+1). 
-              There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+              Specifies the leading dimension of matrices A_i.
     @param[out]
-    ipiv      pointer to type. Array on the GPU (the size depends on the value of strideP).\n
-              Contains the vectors ipiv_j of scalar factors of the 
-              Householder matrices H_j(i).
-    @param[in]
-    strideP   rocblas_stride.\n
-              Stride from the start of one vector ipiv_j to the next one ipiv_(j+1). 
-              There is no restriction for the value
-              of strideP. Normal use is strideP >= min(m,n).
+    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              If info_i = 0, succesful exit for factorization of A_i. 
+              If info_i = j > 0, U_i is singular. U_i(j,j) is the first zero pivot.
     @param[in]
-    batch_count  rocblas_int. batch_count >= 0.\n
-                 Number of matrices in the batch.
-
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of matrices in the batch. 
+            
     ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_sgelq2_strided_batched(rocblas_handle handle, 
-                                                                 const rocblas_int m, 
-                                                                 const rocblas_int n, 
-                                                                 float *A,
-                                                                 const rocblas_int lda, 
-                                                                 const rocblas_stride strideA, 
-                                                                 float *ipiv, 
-                                                                 const rocblas_stride strideP, 
-                                                                 const rocblas_int batch_count);
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_npvt_batched(rocblas_handle handle,
+                                                        const rocblas_int m,
+                                                        const rocblas_int n, 
+                                                        float *const A[],
+                                                        const rocblas_int lda,
+                                                        rocblas_int *info,
+                                                        const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_npvt_batched(rocblas_handle handle,
+                                                        const rocblas_int m,
+                                                        const rocblas_int n, 
+                                                        double *const A[],
+                                                        const rocblas_int lda,
+                                                        rocblas_int *info,
+                                                        const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_npvt_batched(rocblas_handle handle,
+                                                        const rocblas_int m,
+                                                        const rocblas_int n, 
+                                                        rocblas_float_complex *const A[],
+                                                        const rocblas_int lda,
+                                                        rocblas_int *info,
+                                                        const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_npvt_batched(rocblas_handle handle,
+                                                        const rocblas_int m,
+                                                        const rocblas_int n, 
+                                                        rocblas_double_complex *const A[],
+                                                        const rocblas_int lda,
+                                                        rocblas_int *info,
+                                                        const rocblas_int batch_count);
+
+/*! \brief GETRF_NPVT_STRIDED_BATCHED computes the LU factorization of a batch of general m-by-n matrices
+    without pivoting.
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_dgelq2_strided_batched(rocblas_handle handle, 
-                                                                 const rocblas_int m, 
-                                                                 const rocblas_int n, 
-                                                                 double *A,
-                                                                 const rocblas_int lda, 
-                                                                 const rocblas_stride strideA, 
-                                                                 double *ipiv, 
-                                                                 const rocblas_stride strideP, 
-                                                                 const rocblas_int batch_count);
+    \details
+    (This is the right-looking Level 3 BLAS version of the algorithm).
+    
+    The factorization of matrix A_i in the batch has the form
 
+        A_i = L_i * U_i
 
-/*! \brief GEQRF computes a QR factorization of a general m-by-n matrix A.
+    where L_i is lower triangular with unit
+    diagonal elements (lower trapezoidal if m > n), and U_i is upper
+    triangular (upper trapezoidal if m < n).
+
+    No row interchanges are done, so the factorization is only stable for matrices such as
+    the diagonally dominant ones. A zero pivot is still reported in info.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    m         rocblas_int. m >= 0.\n
+              The number of rows of all matrices A_i in the batch.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The number of colums of all matrices A_i in the batch.
+    @param[inout]
+    A         pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+              On entry, in contains the m-by-n matrices A_i to be factored.
+              On exit, the factors L_i and U_i from the factorization.
+              The unit diagonal elements of L_i are not stored.
+    @param[in]
+    lda       rocblas_int. lda >= m.\n
+              Specifies the leading dimension of matrices A_i.
+    @param[in]
+    strideA   rocblas_stride.\n
+              Stride from the start of one matrix A_i and the next one A_(i+1).
+              There is no restriction for the value of strideA. Normal use case is strideA >= lda*n
+    @param[out]
+    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              If info_i = 0, succesful exit for factorization of A_i. 
+              If info_i = j > 0, U_i is singular. U_i(j,j) is the first zero pivot.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of matrices in the batch. 
+            
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_npvt_strided_batched(rocblas_handle handle,
+                                                        const rocblas_int m,
+                                                        const rocblas_int n, 
+                                                        float *A,
+                                                        const rocblas_int lda,
+                                                        const rocblas_stride strideA,
+                                                        rocblas_int *info,
+                                                        const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_npvt_strided_batched(rocblas_handle handle,
+                                                        const rocblas_int m,
+                                                        const rocblas_int n, 
+                                                        double *A,
+                                                        const rocblas_int lda,
+                                                        const rocblas_stride strideA,
+                                                        rocblas_int *info,
+                                                        const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_npvt_strided_batched(rocblas_handle handle,
+                                                        const rocblas_int m,
+                                                        const rocblas_int n, 
+                                                        rocblas_float_complex *A,
+                                                        const rocblas_int lda,
+                                                        const rocblas_stride strideA,
+                                                        rocblas_int *info,
+                                                        const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_npvt_strided_batched(rocblas_handle handle,
+                                                        const rocblas_int m,
+                                                        const rocblas_int n, 
+                                                        rocblas_double_complex *A,
+                                                        const rocblas_int lda,
+                                                        const rocblas_stride strideA,
+                                                        rocblas_int *info,
+                                                        const rocblas_int batch_count);
+
+/*! \brief GEQR2 computes a QR factorization of a general m-by-n matrix A.
 
     \details
-    (This is the blocked version of the algorithm).
+    (This is the unblocked version of the algorithm).
 
     The factorization has the form
 
         A =  Q * [ R ]
                  [ 0 ]
- 
+
     where R is upper triangular (upper trapezoidal if m < n), and Q is 
     a m-by-m orthogonal matrix represented as the product of Householder matrices
 
@@ -2121,29 +2650,29 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_dgelq2_strided_batched(rocblas_handle
 
     ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqrf(rocblas_handle handle, 
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqr2(rocblas_handle handle, 
                                                  const rocblas_int m, 
                                                  const rocblas_int n, 
                                                  float *A,
                                                  const rocblas_int lda, 
                                                  float *ipiv);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf(rocblas_handle handle, 
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqr2(rocblas_handle handle, 
                                                  const rocblas_int m, 
                                                  const rocblas_int n, 
                                                  double *A,
                                                  const rocblas_int lda, 
                                                  double *ipiv);
 
-/*! \brief GEQRF_BATCHED computes the QR factorization of a batch of general m-by-n matrices.
+/*! \brief GEQR2_BATCHED computes the QR factorization of a batch of general m-by-n matrices.
 
     \details
-    (This is the blocked version of the algorithm).
+    (This is the unblocked version of the algorithm).
 
     The factorization of matrix A_j in the batch has the form
 
         A_j =  Q_j * [ R_j ]
-                     [  0  ] 
+                     [  0  ]
 
     where R_j is upper triangular (upper trapezoidal if m < n), and Q_j is 
     a m-by-m orthogonal matrix represented as the product of Householder matrices
@@ -2154,7 +2683,7 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf(rocblas_handle handle,
 
         H_j(i) = I - ipiv_j[i-1] * v_j(i) * v_j(i)'
 
-    where the first i-1 elements of vector Householder vector v_j(i) are zero, and v_j(i)[i] = 1. 
+    where the first i-1 elements of Householder vector v_j(i) are zero, and v_j(i)[i] = 1. 
 
     @param[in]
     handle    rocblas_handle.
@@ -2188,7 +2717,7 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf(rocblas_handle handle,
 
     ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqrf_batched(rocblas_handle handle, 
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqr2_batched(rocblas_handle handle, 
                                                          const rocblas_int m, 
                                                          const rocblas_int n, 
                                                          float *const A[],
@@ -2197,7 +2726,7 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqrf_batched(rocblas_handle handle,
                                                          const rocblas_stride strideP, 
                                                          const rocblas_int batch_count);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf_batched(rocblas_handle handle, 
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqr2_batched(rocblas_handle handle, 
                                                          const rocblas_int m, 
                                                          const rocblas_int n, 
                                                          double *const A[],
@@ -2206,10 +2735,10 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf_batched(rocblas_handle handle,
                                                          const rocblas_stride strideP, 
                                                          const rocblas_int batch_count);
 
-/*! \brief GEQRF_STRIDED_BATCHED computes the QR factorization of a batch of general m-by-n matrices.
+/*! \brief GEQR2_STRIDED_BATCHED computes the QR factorization of a batch of general m-by-n matrices.
 
     \details
-    (This is the blocked version of the algorithm).
+    (This is the unblocked version of the algorithm).
 
     The factorization of matrix A_j in the batch has the form
 
@@ -2225,7 +2754,7 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf_batched(rocblas_handle handle,
 
         H_j(i) = I - ipiv_j[i-1] * v_j(i) * v_j(i)'
 
-    where the first i-1 elements of vector Householder vector v_j(i) are zero, and v_j(i)[i] = 1. 
+    where the first i-1 elements of Householder vector v_j(i) are zero, and v_j(i)[i] = 1. 
 
     @param[in]
     handle    rocblas_handle.
@@ -2263,7 +2792,7 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf_batched(rocblas_handle handle,
 
     ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqrf_strided_batched(rocblas_handle handle, 
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqr2_strided_batched(rocblas_handle handle, 
                                                                  const rocblas_int m, 
                                                                  const rocblas_int n, 
                                                                  float *A,
@@ -2273,7 +2802,7 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqrf_strided_batched(rocblas_handle
                                                                  const rocblas_stride strideP, 
                                                                  const rocblas_int batch_count);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf_strided_batched(rocblas_handle handle, 
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqr2_strided_batched(rocblas_handle handle, 
                                                                  const rocblas_int m, 
                                                                  const rocblas_int n, 
                                                                  double *A,
@@ -2283,10 +2812,10 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf_strided_batched(rocblas_handle
                                                                  const rocblas_stride strideP, 
                                                                  const rocblas_int batch_count);
 
-/*! \brief GELQF computes a LQ factorization of a general m-by-n matrix A.
+/*! \brief GELQ2 computes a LQ factorization of a general m-by-n matrix A.
 
     \details
-    (This is the blocked version of the algorithm).
+    (This is the unblocked version of the algorithm).
 
     The factorization has the form
 
@@ -2326,24 +2855,24 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf_strided_batched(rocblas_handle
 
     ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_sgelqf(rocblas_handle handle, 
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgelq2(rocblas_handle handle, 
                                                  const rocblas_int m, 
                                                  const rocblas_int n, 
                                                  float *A,
                                                  const rocblas_int lda, 
                                                  float *ipiv);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_dgelqf(rocblas_handle handle, 
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgelq2(rocblas_handle handle, 
                                                  const rocblas_int m, 
                                                  const rocblas_int n, 
                                                  double *A,
                                                  const rocblas_int lda, 
                                                  double *ipiv);
 
-/*! \brief GELQF_BATCHED computes the LQ factorization of a batch of general m-by-n matrices.
+/*! \brief GELQ2_BATCHED computes the LQ factorization of a batch of general m-by-n matrices.
 
     \details
-    (This is the blocked version of the algorithm).
+    (This is the unblocked version of the algorithm).
 
     The factorization of matrix A_j in the batch has the form
 
@@ -2392,7 +2921,7 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_dgelqf(rocblas_handle handle,
 
     ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_sgelqf_batched(rocblas_handle handle, 
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgelq2_batched(rocblas_handle handle, 
                                                          const rocblas_int m, 
                                                          const rocblas_int n, 
                                                          float *const A[],
@@ -2401,7 +2930,7 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_sgelqf_batched(rocblas_handle handle,
                                                          const rocblas_stride strideP, 
                                                          const rocblas_int batch_count);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_dgelqf_batched(rocblas_handle handle, 
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgelq2_batched(rocblas_handle handle, 
                                                          const rocblas_int m, 
                                                          const rocblas_int n, 
                                                          double *const A[],
@@ -2410,10 +2939,10 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_dgelqf_batched(rocblas_handle handle,
                                                          const rocblas_stride strideP, 
                                                          const rocblas_int batch_count);
 
-/*! \brief GELQF_STRIDED_BATCHED computes the LQ factorization of a batch of general m-by-n matrices.
+/*! \brief GELQ2_STRIDED_BATCHED computes the LQ factorization of a batch of general m-by-n matrices.
 
     \details
-    (This is the blocked version of the algorithm).
+    (This is the unblocked version of the algorithm).
 
     The factorization of matrix A_j in the batch has the form
 
@@ -2466,7 +2995,7 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_dgelqf_batched(rocblas_handle handle,
 
     ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_sgelqf_strided_batched(rocblas_handle handle, 
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgelq2_strided_batched(rocblas_handle handle, 
                                                                  const rocblas_int m, 
                                                                  const rocblas_int n, 
                                                                  float *A,
@@ -2476,7 +3005,7 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_sgelqf_strided_batched(rocblas_handle
                                                                  const rocblas_stride strideP, 
                                                                  const rocblas_int batch_count);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_dgelqf_strided_batched(rocblas_handle handle, 
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgelq2_strided_batched(rocblas_handle handle, 
                                                                  const rocblas_int m, 
                                                                  const rocblas_int n, 
                                                                  double *A,
@@ -2487,182 +3016,2656 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_dgelqf_strided_batched(rocblas_handle
                                                                  const rocblas_int batch_count);
 
 
-/*! \brief GETRS solves a system of n linear equations on n variables using the LU factorization computed by GETRF.
+/*! \brief GEQRF computes a QR factorization of a general m-by-n matrix A.
 
     \details
-    It solves one of the following systems: 
+    (This is the blocked version of the algorithm).
 
-        A  * X = B (no transpose),  
-        A' * X = B (transpose),  or  
-        A* * X = B (conjugate transpose)
+    The factorization has the form
 
-    depending on the value of trans. 
+        A =  Q * [ R ]
+                 [ 0 ]
+ 
+    where R is upper triangular (upper trapezoidal if m < n), and Q is 
+    a m-by-m orthogonal matrix represented as the product of Householder matrices
+
+        Q = H(1) * H(2) * ... * H(k), with k = min(m,n)
+
+    Each Householder matrix H(i), for i = 1,2,...,k, is given by
+
+        H(i) = I - ipiv[i-1] * v(i) * v(i)'
+    
+    where the first i-1 elements of the Householder vector v(i) are zero, and v(i)[i] = 1. 
 
     @param[in]
-    handle      rocblas_handle.
-    @param[in]
-    trans       rocblas_operation.\n
-                Specifies the form of the system of equations. 
-    @param[in]
-    n           rocblas_int. n >= 0.\n
-                The order of the system, i.e. the number of columns and rows of A.  
-    @param[in]
-    nrhs        rocblas_int. nrhs >= 0.\n
-                The number of right hand sides, i.e., the number of columns
-                of the matrix B.
-    @param[in]
-    A           pointer to type. Array on the GPU of dimension lda*n.\n
-                The factors L and U of the factorization A = P*L*U returned by GETRF.
+    handle    rocblas_handle.
     @param[in]
-    lda         rocblas_int. lda >= n.\n
-                The leading dimension of A.  
+    m         rocblas_int. m >= 0.\n
+              The number of rows of the matrix A.
     @param[in]
-    ipiv        pointer to rocblas_int. Array on the GPU of dimension n.\n
-                The pivot indices returned by GETRF.
-    @param[in,out]
-    B           pointer to type. Array on the GPU of dimension ldb*nrhs.\n
-                On entry, the right hand side matrix B.
-                On exit, the solution matrix X.
+    n         rocblas_int. n >= 0.\n
+              The number of colums of the matrix A.
+    @param[inout]
+    A         pointer to type. Array on the GPU of dimension lda*n.\n
+              On entry, the m-by-n matrix to be factored.
+              On exit, the elements on and above the diagonal contain the 
+              factor R; the elements below the diagonal are the m - i elements
+              of vector v(i) for i = 1,2,...,min(m,n).
     @param[in]
-    ldb         rocblas_int. ldb >= n.\n
-                The leading dimension of B.
+    lda       rocblas_int. lda >= m.\n
+              Specifies the leading dimension of A. 
+    @param[out]
+    ipiv      pointer to type. Array on the GPU of dimension min(m,n).\n
+              The scalar factors of the Householder matrices H(i).
 
-   ********************************************************************/
+    ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs(
-    rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
-    const rocblas_int nrhs, float *A, const rocblas_int lda,
-    const rocblas_int *ipiv, float *B, const rocblas_int ldb);
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqrf(rocblas_handle handle, 
+                                                 const rocblas_int m, 
+                                                 const rocblas_int n, 
+                                                 float *A,
+                                                 const rocblas_int lda, 
+                                                 float *ipiv);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs(
-    rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
-    const rocblas_int nrhs, double *A, const rocblas_int lda,
-    const rocblas_int *ipiv, double *B, const rocblas_int ldb);
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf(rocblas_handle handle, 
+                                                 const rocblas_int m, 
+                                                 const rocblas_int n, 
+                                                 double *A,
+                                                 const rocblas_int lda, 
+                                                 double *ipiv);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs(
-    rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
-    const rocblas_int nrhs, rocblas_float_complex *A, const rocblas_int lda,
-    const rocblas_int *ipiv, rocblas_float_complex *B, const rocblas_int ldb);
+/*! \brief GEQRF_BATCHED computes the QR factorization of a batch of general m-by-n matrices.
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs(
-    rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
-    const rocblas_int nrhs, rocblas_double_complex *A, const rocblas_int lda,
-    const rocblas_int *ipiv, rocblas_double_complex *B, const rocblas_int ldb);
+    \details
+    (This is the blocked version of the algorithm).
 
-/*! \brief GETRS_BATCHED solves a batch of systems of n linear equations on n variables 
-     using the LU factorization computed by GETRF_BATCHED.
+    The factorization of matrix A_j in the batch has the form
 
-    \details
-    For each instance j in the batch, it solves one of the following systems: 
+        A_j =  Q_j * [ R_j ]
+                     [  0  ] 
 
-        A_j  * X_j = B_j (no transpose),  
-        A_j' * X_j = B_j (transpose),  or  
-        A_j* * X_j = B_j (conjugate transpose)
+    where R_j is upper triangular (upper trapezoidal if m < n), and Q_j is 
+    a m-by-m orthogonal matrix represented as the product of Householder matrices
 
-    depending on the value of trans. 
+        Q_j = H_j(1) * H_j(2) * ... * H_j(k), with k = min(m,n)
 
-    @param[in]
+    Each Householder matrices H_j(i), for j = 1,2,...,batch_count, and i = 1,2,...,k, is given by
+
+        H_j(i) = I - ipiv_j[i-1] * v_j(i) * v_j(i)'
+
+    where the first i-1 elements of vector Householder vector v_j(i) are zero, and v_j(i)[i] = 1. 
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    m         rocblas_int. m >= 0.\n
+              The number of rows of all the matrices A_j in the batch.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The number of colums of all the matrices A_j in the batch.
+    @param[inout]
+    A         Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+              On entry, the m-by-n matrices A_j to be factored.
+              On exit, the elements on and above the diagonal contain the 
+              factor R_j. The elements below the diagonal are the m - i elements
+              of vector v_j(i) for i=1,2,...,min(m,n).
+    @param[in]
+    lda       rocblas_int. lda >= m.\n
+              Specifies the leading dimension of matrices A_j. 
+    @param[out]
+    ipiv      pointer to type. Array on the GPU (the size depends on the value of strideP).\n
+              Contains the vectors ipiv_j of scalar factors of the 
+              Householder matrices H_j(i).
+    @param[in]
+    strideP   rocblas_stride.\n
+              Stride from the start of one vector ipiv_j to the next one ipiv_(j+1). 
+              There is no restriction for the value
+              of strideP. Normal use is strideP >= min(m,n).
+    @param[in]
+    batch_count  rocblas_int. batch_count >= 0.\n
+                 Number of matrices in the batch.
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqrf_batched(rocblas_handle handle, 
+                                                         const rocblas_int m, 
+                                                         const rocblas_int n, 
+                                                         float *const A[],
+                                                         const rocblas_int lda, 
+                                                         float *ipiv, 
+                                                         const rocblas_stride strideP, 
+                                                         const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf_batched(rocblas_handle handle, 
+                                                         const rocblas_int m, 
+                                                         const rocblas_int n, 
+                                                         double *const A[],
+                                                         const rocblas_int lda, 
+                                                         double *ipiv, 
+                                                         const rocblas_stride strideP, 
+                                                         const rocblas_int batch_count);
+
+/*! \brief GEQRF_STRIDED_BATCHED computes the QR factorization of a batch of general m-by-n matrices.
+
+    \details
+    (This is the blocked version of the algorithm).
+
+    The factorization of matrix A_j in the batch has the form
+
+        A_j =  Q_j * [ R_j ]
+                     [  0  ] 
+
+    where R_j is upper triangular (upper trapezoidal if m < n), and Q_j is 
+    a m-by-m orthogonal matrix represented as the product of Householder matrices
+
+        Q_j = H_j(1) * H_j(2) * ... * H_j(k), with k = min(m,n)
+
+    Each Householder matrices H_j(i), for j = 1,2,...,batch_count, and i = 1,2,...,k, is given by
+
+        H_j(i) = I - ipiv_j[i-1] * v_j(i) * v_j(i)'
+
+    where the first i-1 elements of vector Householder vector v_j(i) are zero, and v_j(i)[i] = 1. 
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    m         rocblas_int. m >= 0.\n
+              The number of rows of all the matrices A_j in the batch.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The number of colums of all the matrices A_j in the batch.
+    @param[inout]
+    A         pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+              On entry, the m-by-n matrices A_j to be factored.
+              On exit, the elements on and above the diagonal contain the 
+              factor R_j. The elements below the diagonal are the m - i elements
+              of vector v_j(i) for i = 1,2,...,min(m,n).
+    @param[in]
+    lda       rocblas_int. lda >= m.\n
+              Specifies the leading dimension of matrices A_j. 
+    @param[in]
+    strideA   rocblas_stride.\n   
+              Stride from the start of one matrix A_j and the next one A_(j+1). 
+              There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    @param[out]
+    ipiv      pointer to type. Array on the GPU (the size depends on the value of strideP).\n
+              Contains the vectors ipiv_j of scalar factors of the 
+              Householder matrices H_j(i).
+    @param[in]
+    strideP   rocblas_stride.\n
+              Stride from the start of one vector ipiv_j to the next one ipiv_(j+1). 
+              There is no restriction for the value
+              of strideP. Normal use is strideP >= min(m,n).
+    @param[in]
+    batch_count  rocblas_int. batch_count >= 0.\n
+                 Number of matrices in the batch.
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqrf_strided_batched(rocblas_handle handle, 
+                                                                 const rocblas_int m, 
+                                                                 const rocblas_int n, 
+                                                                 float *A,
+                                                                 const rocblas_int lda, 
+                                                                 const rocblas_stride strideA, 
+                                                                 float *ipiv, 
+                                                                 const rocblas_stride strideP, 
+                                                                 const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf_strided_batched(rocblas_handle handle, 
+                                                                 const rocblas_int m, 
+                                                                 const rocblas_int n, 
+                                                                 double *A,
+                                                                 const rocblas_int lda, 
+                                                                 const rocblas_stride strideA, 
+                                                                 double *ipiv, 
+                                                                 const rocblas_stride strideP, 
+                                                                 const rocblas_int batch_count);
+
+/*! \brief GEQRF_VBATCHED computes the QR factorization of a batch of general matrices of different sizes.
+
+    \details
+    The factorization of the m_j-by-n_j matrix A_j in the batch has the form
+
+        A_j =  Q_j * [ R_j ]
+                     [  0  ] 
+
+    where R_j is upper triangular (upper trapezoidal if m_j < n_j), and Q_j is 
+    a m_j-by-m_j orthogonal matrix represented as the product of Householder matrices
+
+        Q_j = H_j(1) * H_j(2) * ... * H_j(k), with k = min(m_j,n_j)
+
+    Each Householder matrices H_j(i), for j = 1,2,...,batch_count, and i = 1,2,...,k, is given by
+
+        H_j(i) = I - ipiv_j[i-1] * v_j(i) * v_j(i)'
+
+    where the first i-1 elements of vector Householder vector v_j(i) are zero, and v_j(i)[i] = 1. 
+
+    The sizes are read from the GPU (this synchronizes the stream of the handle) and the matrices 
+    with the same sizes are factorized together, with the algorithm that
+    geqrf_batched uses for that size. No matrix is padded. A batch with S distinct sizes
+    costs S calls of geqrf_batched; unless the workspace was provided by the user, they are
+    spread over the stream of the handle and a secondary stream that run concurrently.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    m         pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              The number of rows m_j >= 0 of the matrices A_j.
+    @param[in]
+    n         pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              The number of colums n_j >= 0 of the matrices A_j.
+    @param[inout]
+    A         array of pointers to type. Each pointer points to an array on the GPU of dimension lda_j*n_j.\n
+              On entry, the matrices A_j to be factored.
+              On exit, the elements on and above the diagonal contain the 
+              factor R_j. The elements below the diagonal are the m_j - i elements
+              of vector v_j(i) for i=1,2,...,min(m_j,n_j).
+    @param[in]
+    lda       pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              The leading dimensions lda_j >= m_j of the matrices A_j.
+    @param[out]
+    ipiv      array of pointers to type. Each pointer points to an array on the GPU of dimension min(m_j,n_j).\n
+              The vectors ipiv_j of scalar factors of the 
+              Householder matrices H_j(i).
+    @param[in]
+    batch_count  rocblas_int. batch_count >= 0.\n
+                 Number of matrices in the batch.
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgeqrf_vbatched(rocblas_handle handle, 
+                                                         const rocblas_int *m, 
+                                                         const rocblas_int *n, 
+                                                         float *const A[],
+                                                         const rocblas_int *lda, 
+                                                         float *const ipiv[], 
+                                                         const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqrf_vbatched(rocblas_handle handle, 
+                                                         const rocblas_int *m, 
+                                                         const rocblas_int *n, 
+                                                         double *const A[],
+                                                         const rocblas_int *lda, 
+                                                         double *const ipiv[], 
+                                                         const rocblas_int batch_count);
+
+/*! \brief GELQF computes a LQ factorization of a general m-by-n matrix A.
+
+    \details
+    (This is the blocked version of the algorithm).
+
+    The factorization has the form
+
+        A = [ L 0 ] * Q
+ 
+    where L is lower triangular (lower trapezoidal if m > n), and Q is 
+    a n-by-n orthogonal matrix represented as the product of Householder matrices
+
+        Q = H(k) * H(k-1) * ... * H(1), with k = min(m,n)
+
+    Each Householder matrix H(i), for i = 1,2,...,k, is given by
+
+        H(i) = I - ipiv[i-1] * v(i)' * v(i)
+    
+    where the first i-1 elements of the Householder vector v(i) are zero, and v(i)[i] = 1. 
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    m         rocblas_int. m >= 0.\n
+              The number of rows of the matrix A.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The number of colums of the matrix A.
+    @param[inout]
+    A         pointer to type. Array on the GPU of dimension lda*n.\n
+              On entry, the m-by-n matrix to be factored.
+              On exit, the elements on and delow the diagonal contain the 
+              factor L; the elements above the diagonal are the n - i elements
+              of vector v(i) for i = 1,2,...,min(m,n).
+    @param[in]
+    lda       rocblas_int. lda >= m.\n
+              Specifies the leading dimension of A. 
+    @param[out]
+    ipiv      pointer to type. Array on the GPU of dimension min(m,n).\n
+              The scalar factors of the Householder matrices H(i).
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgelqf(rocblas_handle handle, 
+                                                 const rocblas_int m, 
+                                                 const rocblas_int n, 
+                                                 float *A,
+                                                 const rocblas_int lda, 
+                                                 float *ipiv);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgelqf(rocblas_handle handle, 
+                                                 const rocblas_int m, 
+                                                 const rocblas_int n, 
+                                                 double *A,
+                                                 const rocblas_int lda, 
+                                                 double *ipiv);
+
+/*! \brief GELQF_BATCHED computes the LQ factorization of a batch of general m-by-n matrices.
+
+    \details
+    (This is the blocked version of the algorithm).
+
+    The factorization of matrix A_j in the batch has the form
+
+        A_j = [ L_j 0 ] * Q_j 
+
+    where L_j is lower triangular (lower trapezoidal if m > n), and Q_j is 
+    a n-by-n orthogonal matrix represented as the product of Householder matrices
+
+        Q_j = H_j(k) * H_j(k-1) * ... * H_j(1), with k = min(m,n)
+
+    Each Householder matrices H_j(i), for j = 1,2,...,batch_count, and i = 1,2,...,k, is given by
+
+        H_j(i) = I - ipiv_j[i-1] * v_j(i)' * v_j(i)
+
+    where the first i-1 elements of Householder vector v_j(i) are zero, and v_j(i)[i] = 1. 
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    m         rocblas_int. m >= 0.\n
+              The number of rows of all the matrices A_j in the batch.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The number of colums of all the matrices A_j in the batch.
+    @param[inout]
+    A         Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+              On entry, the m-by-n matrices A_j to be factored.
+              On exit, the elements on and below the diagonal contain the 
+              factor L_j. The elements above the diagonal are the n - i elements
+              of vector v_j(i) for i=1,2,...,min(m,n).
+    @param[in]
+    lda       rocblas_int. lda >= m.\n
+              Specifies the leading dimension of matrices A_j. 
+    @param[out]
+    ipiv      pointer to type. Array on the GPU (the size depends on the value of strideP).\n
+              Contains the vectors ipiv_j of scalar factors of the 
+              Householder matrices H_j(i).
+    @param[in]
+    strideP   rocblas_stride.\n
+              Stride from the start of one vector ipiv_j to the next one ipiv_(j+1). 
+              There is no restriction for the value
+              of strideP. Normal use is strideP >= min(m,n).
+    @param[in]
+    batch_count  rocblas_int. batch_count >= 0.\n
+                 Number of matrices in the batch.
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgelqf_batched(rocblas_handle handle, 
+                                                         const rocblas_int m, 
+                                                         const rocblas_int n, 
+                                                         float *const A[],
+                                                         const rocblas_int lda, 
+                                                         float *ipiv, 
+                                                         const rocblas_stride strideP, 
+                                                         const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgelqf_batched(rocblas_handle handle, 
+                                                         const rocblas_int m, 
+                                                         const rocblas_int n, 
+                                                         double *const A[],
+                                                         const rocblas_int lda, 
+                                                         double *ipiv, 
+                                                         const rocblas_stride strideP, 
+                                                         const rocblas_int batch_count);
+
+/*! \brief GELQF_STRIDED_BATCHED computes the LQ factorization of a batch of general m-by-n matrices.
+
+    \details
+    (This is the blocked version of the algorithm).
+
+    The factorization of matrix A_j in the batch has the form
+
+        A_j = [ L_j 0 ] * Q_j 
+
+    where L_j is lower triangular (lower trapezoidal if m > n), and Q_j is 
+    a n-by-n orthogonal matrix represented as the product of Householder matrices
+
+        Q_j = H_j(k) * H_j(k-1) * ... * H_j(1), with k = min(m,n)
+
+    Each Householder matrices H_j(i), for j = 1,2,...,batch_count, and i = 1,2,...,k, is given by
+
+        H_j(i) = I - ipiv_j[i-1] * v_j(i)' * v_j(i)
+
+    where the first i-1 elements of vector Householder vector v_j(i) are zero, and v_j(i)[i] = 1. 
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    m         rocblas_int. m >= 0.\n
+              The number of rows of all the matrices A_j in the batch.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The number of colums of all the matrices A_j in the batch.
+    @param[inout]
+    A         pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+              On entry, the m-by-n matrices A_j to be factored.
+              On exit, the elements on and below the diagonal contain the 
+              factor L_j. The elements above the diagonal are the n - i elements
+              of vector v_j(i) for i = 1,2,...,min(m,n).
+    @param[in]
+    lda       rocblas_int. lda >= m.\n
+              Specifies the leading dimension of matrices A_j. 
+    @param[in]
+    strideA   rocblas_stride.\n   
+              Stride from the start of one matrix A_j and the next one A_(j+1). 
+              There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    @param[out]
+    ipiv      pointer to type. Array on the GPU (the size depends on the value of strideP).\n
+              Contains the vectors ipiv_j of scalar factors of the 
+              Householder matrices H_j(i).
+    @param[in]
+    strideP   rocblas_stride.\n
+              Stride from the start of one vector ipiv_j to the next one ipiv_(j+1). 
+              There is no restriction for the value
+              of strideP. Normal use is strideP >= min(m,n).
+    @param[in]
+    batch_count  rocblas_int. batch_count >= 0.\n
+                 Number of matrices in the batch.
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgelqf_strided_batched(rocblas_handle handle, 
+                                                                 const rocblas_int m, 
+                                                                 const rocblas_int n, 
+                                                                 float *A,
+                                                                 const rocblas_int lda, 
+                                                                 const rocblas_stride strideA, 
+                                                                 float *ipiv, 
+                                                                 const rocblas_stride strideP, 
+                                                                 const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgelqf_strided_batched(rocblas_handle handle, 
+                                                                 const rocblas_int m, 
+                                                                 const rocblas_int n, 
+                                                                 double *A,
+                                                                 const rocblas_int lda, 
+                                                                 const rocblas_stride strideA, 
+                                                                 double *ipiv, 
+                                                                 const rocblas_stride strideP, 
+                                                                 const rocblas_int batch_count);
+
+
+/*! \brief GETRS solves a system of n linear equations on n variables using the LU factorization computed by GETRF.
+
+    \details
+    It solves one of the following systems: 
+
+        A  * X = B (no transpose),  
+        A' * X = B (transpose),  or  
+        A* * X = B (conjugate transpose)
+
+    depending on the value of trans. 
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    trans       rocblas_operation.\n
+                Specifies the form of the system of equations. 
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of A.  
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of the matrix B.
+    @param[in]
+    A           pointer to type. Array on the GPU of dimension lda*n.\n
+                The factors L and U of the factorization A = P*L*U returned by GETRF.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of A.  
+    @param[in]
+    ipiv        pointer to rocblas_int. Array on the GPU of dimension n.\n
+                The pivot indices returned by GETRF.
+    @param[in,out]
+    B           pointer to type. Array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrix B.
+                On exit, the solution matrix X.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of B.
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs(
+    rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+    const rocblas_int nrhs, float *A, const rocblas_int lda,
+    const rocblas_int *ipiv, float *B, const rocblas_int ldb);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs(
+    rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+    const rocblas_int nrhs, double *A, const rocblas_int lda,
+    const rocblas_int *ipiv, double *B, const rocblas_int ldb);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs(
+    rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+    const rocblas_int nrhs, rocblas_float_complex *A, const rocblas_int lda,
+    const rocblas_int *ipiv, rocblas_float_complex *B, const rocblas_int ldb);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs(
+    rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+    const rocblas_int nrhs, rocblas_double_complex *A, const rocblas_int lda,
+    const rocblas_int *ipiv, rocblas_double_complex *B, const rocblas_int ldb);
+
+/*! \brief GETRS_BATCHED solves a batch of systems of n linear equations on n variables 
+     using the LU factorization computed by GETRF_BATCHED.
+
+    \details
+    For each instance j in the batch, it solves one of the following systems: 
+
+        A_j  * X_j = B_j (no transpose),  
+        A_j' * X_j = B_j (transpose),  or  
+        A_j* * X_j = B_j (conjugate transpose)
+
+    depending on the value of trans. 
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    trans       rocblas_operation.\n
+                Specifies the form of the system of equations of each instance in the batch. 
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of all A_j matrices.  
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_j.
+    @param[in]
+    A           Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+                The factors L_j and U_j of the factorization A_j = P_j*L_j*U_j returned by GETRF_BATCHED.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of matrices A_j.
+    @param[in]
+    ipiv        pointer to rocblas_int. Array on the GPU (the size depends on the value of strideP).\n
+                Contains the vectors ipiv_j of pivot indices returned by GETRF_BATCHED.
+    @param[in]
+    strideP     rocblas_stride.\n
+                Stride from the start of one vector ipiv_j to the next one ipiv_(j+1).
+                There is no restriction for the value of strideP. Normal use case is strideP >= min(m,n).
+    @param[in,out]
+    B           Array of pointers to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n 
+                On entry, the right hand side matrices B_j.
+                On exit, the solution matrix X_j of each system in the batch.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of matrices B_j.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of instances (systems) in the batch. 
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs_batched(
+                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, float *const A[], const rocblas_int lda,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, float *const B[], const rocblas_int ldb, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs_batched(
+                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, double *const A[], const rocblas_int lda,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, double *const B[], const rocblas_int ldb, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs_batched(
+                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, rocblas_float_complex *const A[], const rocblas_int lda,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, rocblas_float_complex *const B[], 
+                 const rocblas_int ldb, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_batched(
+                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, rocblas_double_complex *const A[], const rocblas_int lda,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, rocblas_double_complex *const B[], 
+                 const rocblas_int ldb, const rocblas_int batch_count);
+
+/*! \brief GETRS_STRIDED_BATCHED solves a batch of systems of n linear equations on n variables 
+     using the LU factorization computed by GETRF_STRIDED_BATCHED.
+
+    \details
+    For each instance j in the batch, it solves one of the following systems: 
+
+        A_j  * X_j = B_j (no transpose),  
+        A_j' * X_j = B_j (transpose),  or  
+        A_j* * X_j = B_j (conjugate transpose)
+
+    depending on the value of trans. 
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    trans       rocblas_operation.\n
+                Specifies the form of the system of equations of each instance in the batch. 
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of all A_j matrices.  
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_j.
+    @param[in]
+    A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                The factors L_j and U_j of the factorization A_j = P_j*L_j*U_j returned by GETRF_STRIDED_BATCHED.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of matrices A_j.
+    @param[in]
+    strideA     rocblas_stride.\n
+                Stride from the start of one matrix A_j and the next one A_(j+1). 
+                There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    @param[in]
+    ipiv        pointer to rocblas_int. Array on the GPU (the size depends on the value of strideP).\n
+                Contains the vectors ipiv_j of pivot indices returned by GETRF_STRIDED_BATCHED.
+    @param[in]
+    strideP     rocblas_stride.\n
+                Stride from the start of one vector ipiv_j to the next one ipiv_(j+1).
+                There is no restriction for the value of strideP. Normal use case is strideP >= min(m,n).
+    @param[in,out]
+    B           pointer to type. Array on the GPU (size depends on the value of strideB).\n
+                On entry, the right hand side matrices B_j.
+                On exit, the solution matrix X_j of each system in the batch.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of matrices B_j.
+    @param[in]
+    strideB     rocblas_stride.\n
+                Stride from the start of one matrix B_j and the next one B_(j+1). 
+                There is no restriction for the value of strideB. Normal use case is strideB >= ldb*nrhs.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of instances (systems) in the batch. 
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs_strided_batched(
+                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, float *A, const rocblas_int lda, const rocblas_stride strideA,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, float *B, const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs_strided_batched(
+                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, double *A, const rocblas_int lda, const rocblas_stride strideA,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, double *B, const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs_strided_batched(
+                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, rocblas_float_complex *A, const rocblas_int lda, const rocblas_stride strideA,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, rocblas_float_complex *B, const rocblas_int ldb, 
+                 const rocblas_stride strideB, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_strided_batched(
+                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int nrhs, rocblas_double_complex *A, const rocblas_int lda, const rocblas_stride strideA,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, rocblas_double_complex *B, const rocblas_int ldb, 
+                 const rocblas_stride strideB, const rocblas_int batch_count);
+
+/*! \brief GBTRS solves a system of n linear equations on n variables using the
+    band LU factorization computed by GBTRF.
+
+    \details
+    It solves one of the following systems: 
+
+        A  * X = B (no transpose),  
+        A' * X = B (transpose),  or  
+        A* * X = B (conjugate transpose)
+
+    depending on the value of trans. Each right hand side is solved by forward and backward 
+    substitution, with kl+ku entries per row.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    trans       rocblas_operation.\n
+                Specifies the form of the system of equations. 
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of A.  
+    @param[in]
+    kl          rocblas_int. kl >= 0.\n
+                The number of sub-diagonals of A.
+    @param[in]
+    ku          rocblas_int. ku >= 0.\n
+                The number of super-diagonals of A.
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of the matrix B.
+    @param[in]
+    AB          pointer to type. Array on the GPU of dimension ldab*n.\n
+                The factors L and U of the factorization A = P*L*U returned by GBTRF.
+    @param[in]
+    ldab        rocblas_int. ldab >= 2*kl+ku+1.\n
+                The leading dimension of AB.
+    @param[in]
+    ipiv        pointer to rocblas_int. Array on the GPU of dimension n.\n
+                The pivot indices returned by GBTRF.
+    @param[in,out]
+    B           pointer to type. Array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrix B.
+                On exit, the solution matrix X.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of B.
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgbtrs(
+                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int kl, const rocblas_int ku, const rocblas_int nrhs, float *AB, const rocblas_int ldab,
+                 const rocblas_int *ipiv, float *B, const rocblas_int ldb);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgbtrs(
+                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int kl, const rocblas_int ku, const rocblas_int nrhs, double *AB, const rocblas_int ldab,
+                 const rocblas_int *ipiv, double *B, const rocblas_int ldb);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgbtrs(
+                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int kl, const rocblas_int ku, const rocblas_int nrhs, rocblas_float_complex *AB, const rocblas_int ldab,
+                 const rocblas_int *ipiv, rocblas_float_complex *B, const rocblas_int ldb);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgbtrs(
+                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int kl, const rocblas_int ku, const rocblas_int nrhs, rocblas_double_complex *AB, const rocblas_int ldab,
+                 const rocblas_int *ipiv, rocblas_double_complex *B, const rocblas_int ldb);
+
+/*! \brief GBTRS_BATCHED solves a batch of systems of n linear equations on n variables using the
+    band LU factorizations computed by GBTRF_BATCHED.
+
+    \details
+    For each instance j in the batch, it solves one of the following systems: 
+
+        A_j  * X_j = B_j (no transpose),  
+        A_j' * X_j = B_j (transpose),  or  
+        A_j* * X_j = B_j (conjugate transpose)
+
+    depending on the value of trans. Each right hand side is solved by forward and backward 
+    substitution, with kl+ku entries per row.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    trans       rocblas_operation.\n
+                Specifies the form of the system of equations. 
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the systems, i.e. the number of columns and rows of all A_j matrices.  
+    @param[in]
+    kl          rocblas_int. kl >= 0.\n
+                The number of sub-diagonals of all A_j matrices.
+    @param[in]
+    ku          rocblas_int. ku >= 0.\n
+                The number of super-diagonals of all A_j matrices.
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_j.
+    @param[in]
+    AB          Array of pointers to type. Each pointer points to an array on the GPU of dimension ldab*n.\n
+                The factors L_j and U_j returned by GBTRF_BATCHED.
+    @param[in]
+    ldab        rocblas_int. ldab >= 2*kl+ku+1.\n
+                The leading dimension of the arrays AB_j.
+    @param[in]
+    ipiv        pointer to rocblas_int. Array on the GPU (the size depends on the value of strideP).\n
+                Contains the vectors ipiv_j of pivot indices returned by GBTRF_BATCHED.
+    @param[in]
+    strideP     rocblas_stride.\n
+                Stride from the start of one vector ipiv_j to the next one ipiv_(j+1). 
+                There is no restriction for the value of strideP. Normal use case is strideP >= n.
+    @param[in,out]
+    B           Array of pointers to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrices B_j.
+                On exit, the solution matrix X_j of each system in the batch.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of matrices B_j.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of instances (systems) in the batch. 
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgbtrs_batched(
+                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int kl, const rocblas_int ku, const rocblas_int nrhs, float *const AB[], const rocblas_int ldab,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, float *const B[], const rocblas_int ldb, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgbtrs_batched(
+                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int kl, const rocblas_int ku, const rocblas_int nrhs, double *const AB[], const rocblas_int ldab,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, double *const B[], const rocblas_int ldb, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgbtrs_batched(
+                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int kl, const rocblas_int ku, const rocblas_int nrhs, rocblas_float_complex *const AB[], const rocblas_int ldab,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, rocblas_float_complex *const B[], const rocblas_int ldb, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgbtrs_batched(
+                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int kl, const rocblas_int ku, const rocblas_int nrhs, rocblas_double_complex *const AB[], const rocblas_int ldab,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, rocblas_double_complex *const B[], const rocblas_int ldb, const rocblas_int batch_count);
+
+/*! \brief GBTRS_STRIDED_BATCHED solves a batch of systems of n linear equations on n variables using the
+    band LU factorizations computed by GBTRF_STRIDED_BATCHED.
+
+    \details
+    For each instance j in the batch, it solves one of the following systems: 
+
+        A_j  * X_j = B_j (no transpose),  
+        A_j' * X_j = B_j (transpose),  or  
+        A_j* * X_j = B_j (conjugate transpose)
+
+    depending on the value of trans. Each right hand side is solved by forward and backward 
+    substitution, with kl+ku entries per row.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    trans       rocblas_operation.\n
+                Specifies the form of the system of equations. 
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the systems, i.e. the number of columns and rows of all A_j matrices.  
+    @param[in]
+    kl          rocblas_int. kl >= 0.\n
+                The number of sub-diagonals of all A_j matrices.
+    @param[in]
+    ku          rocblas_int. ku >= 0.\n
+                The number of super-diagonals of all A_j matrices.
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_j.
+    @param[in]
+    AB          pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                The factors L_j and U_j returned by GBTRF_STRIDED_BATCHED.
+    @param[in]
+    ldab        rocblas_int. ldab >= 2*kl+ku+1.\n
+                The leading dimension of the arrays AB_j.
+    @param[in]
+    strideA     rocblas_stride.\n
+                Stride from the start of one band matrix AB_j and the next one AB_(j+1). 
+                There is no restriction for the value of strideA. Normal use case is strideA >= ldab*n.
+    @param[in]
+    ipiv        pointer to rocblas_int. Array on the GPU (the size depends on the value of strideP).\n
+                Contains the vectors ipiv_j of pivot indices returned by GBTRF_STRIDED_BATCHED.
+    @param[in]
+    strideP     rocblas_stride.\n
+                Stride from the start of one vector ipiv_j to the next one ipiv_(j+1). 
+                There is no restriction for the value of strideP. Normal use case is strideP >= n.
+    @param[in,out]
+    B           pointer to type. Array on the GPU (size depends on the value of strideB).\n
+                On entry, the right hand side matrices B_j.
+                On exit, the solution matrix X_j of each system in the batch.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of matrices B_j.
+    @param[in]
+    strideB     rocblas_stride.\n
+                Stride from the start of one matrix B_j and the next one B_(j+1). 
+                There is no restriction for the value of strideB. Normal use case is strideB >= ldb*nrhs.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of instances (systems) in the batch. 
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgbtrs_strided_batched(
+                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int kl, const rocblas_int ku, const rocblas_int nrhs, float *AB, const rocblas_int ldab, const rocblas_stride strideA,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, float *B, const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgbtrs_strided_batched(
+                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int kl, const rocblas_int ku, const rocblas_int nrhs, double *AB, const rocblas_int ldab, const rocblas_stride strideA,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, double *B, const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgbtrs_strided_batched(
+                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int kl, const rocblas_int ku, const rocblas_int nrhs, rocblas_float_complex *AB, const rocblas_int ldab, const rocblas_stride strideA,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, rocblas_float_complex *B, const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgbtrs_strided_batched(
+                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int kl, const rocblas_int ku, const rocblas_int nrhs, rocblas_double_complex *AB, const rocblas_int ldab, const rocblas_stride strideA,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, rocblas_double_complex *B, const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count);
+
+/*! \brief GESV solves a general system of n linear equations on n variables.
+
+    \details
+    The linear system
+
+        A * X = B
+
+    is solved by computing the LU factorization A = P*L*U with GETRF and then solving 
+    with GETRS. Both steps run on the device one after the other, sharing the workspace
+    and without synchronizing with the host.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of A.  
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of the matrix B.
+    @param[inout]
+    A           pointer to type. Array on the GPU of dimension lda*n.\n
+                On entry, the matrix A. On exit, the factors L and U of the factorization A = P*L*U.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of A.  
+    @param[out]
+    ipiv        pointer to rocblas_int. Array on the GPU of dimension n.\n
+                The pivot indices; row i of the matrix was interchanged with row ipiv[i].
+    @param[inout]
+    B           pointer to type. Array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrix B.
+                On exit, the solution matrix X.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of B.
+    @param[out]
+    info        pointer to a rocblas_int on the GPU.\n
+                If info = 0, successful exit.
+                If info = i > 0, U(i,i) is exactly zero. The factorization has been completed, 
+                but the solution could not be computed and B is not modified.
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgesv(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    float *A, const rocblas_int lda, rocblas_int *ipiv, float *B, const rocblas_int ldb,
+    rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgesv(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    double *A, const rocblas_int lda, rocblas_int *ipiv, double *B, const rocblas_int ldb,
+    rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgesv(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    rocblas_float_complex *A, const rocblas_int lda, rocblas_int *ipiv, rocblas_float_complex *B, const rocblas_int ldb,
+    rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgesv(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    rocblas_double_complex *A, const rocblas_int lda, rocblas_int *ipiv, rocblas_double_complex *B, const rocblas_int ldb,
+    rocblas_int *info);
+
+/*! \brief GESV_BATCHED solves a batch of general systems of n linear equations on n variables.
+
+    \details
+    For each instance j in the batch, the linear system
+
+        A_j * X_j = B_j
+
+    is solved by computing the LU factorization A_j = P_j*L_j*U_j with GETRF_BATCHED and then solving 
+    with GETRS_BATCHED. Both steps run on the device one after the other, sharing the workspace
+    and without synchronizing with the host.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the systems, i.e. the number of columns and rows of all A_j matrices.  
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_j.
+    @param[inout]
+    A           Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+                On entry, the matrices A_j. On exit, the factors L_j and U_j of the factorizations.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of matrices A_j.  
+    @param[out]
+    ipiv        pointer to rocblas_int. Array on the GPU (the size depends on the value of strideP).\n
+                Contains the vectors ipiv_j of pivot indices.
+    @param[in]
+    strideP     rocblas_stride.\n
+                Stride from the start of one vector ipiv_j to the next one ipiv_(j+1).
+                There is no restriction for the value of strideP. Normal use case is strideP >= n.
+    @param[inout]
+    B           Array of pointers to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrices B_j.
+                On exit, the solution matrix X_j of each system in the batch.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of matrices B_j.
+    @param[out]
+    info        pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+                If info_j = 0, successful exit.
+                If info_j = i > 0, U_j(i,i) is exactly zero. The factorization has been completed, 
+                but the solution could not be computed and B_j is not modified.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of instances (systems) in the batch. 
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgesv_batched(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    float *const A[], const rocblas_int lda, rocblas_int *ipiv, const rocblas_stride strideP,
+    float *const B[], const rocblas_int ldb, rocblas_int *info, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgesv_batched(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    double *const A[], const rocblas_int lda, rocblas_int *ipiv, const rocblas_stride strideP,
+    double *const B[], const rocblas_int ldb, rocblas_int *info, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgesv_batched(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    rocblas_float_complex *const A[], const rocblas_int lda, rocblas_int *ipiv, const rocblas_stride strideP,
+    rocblas_float_complex *const B[], const rocblas_int ldb, rocblas_int *info, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgesv_batched(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    rocblas_double_complex *const A[], const rocblas_int lda, rocblas_int *ipiv, const rocblas_stride strideP,
+    rocblas_double_complex *const B[], const rocblas_int ldb, rocblas_int *info, const rocblas_int batch_count);
+
+/*! \brief GESV_STRIDED_BATCHED solves a batch of general systems of n linear equations on n variables.
+
+    \details
+    For each instance j in the batch, the linear system
+
+        A_j * X_j = B_j
+
+    is solved by computing the LU factorization A_j = P_j*L_j*U_j with GETRF_STRIDED_BATCHED and then solving 
+    with GETRS_STRIDED_BATCHED. Both steps run on the device one after the other, sharing the workspace
+    and without synchronizing with the host.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the systems, i.e. the number of columns and rows of all A_j matrices.  
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_j.
+    @param[inout]
+    A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                On entry, the matrices A_j. On exit, the factors L_j and U_j of the factorizations.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of matrices A_j.  
+    @param[in]
+    strideA     rocblas_stride.\n
+                Stride from the start of one matrix A_j and the next one A_(j+1). 
+                There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    @param[out]
+    ipiv        pointer to rocblas_int. Array on the GPU (the size depends on the value of strideP).\n
+                Contains the vectors ipiv_j of pivot indices.
+    @param[in]
+    strideP     rocblas_stride.\n
+                Stride from the start of one vector ipiv_j to the next one ipiv_(j+1).
+                There is no restriction for the value of strideP. Normal use case is strideP >= n.
+    @param[inout]
+    B           pointer to type. Array on the GPU (size depends on the value of strideB).\n
+                On entry, the right hand side matrices B_j.
+                On exit, the solution matrix X_j of each system in the batch.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of matrices B_j.
+    @param[in]
+    strideB     rocblas_stride.\n
+                Stride from the start of one matrix B_j and the next one B_(j+1). 
+                There is no restriction for the value of strideB. Normal use case is strideB >= ldb*nrhs.
+    @param[out]
+    info        pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+                If info_j = 0, successful exit.
+                If info_j = i > 0, U_j(i,i) is exactly zero. The factorization has been completed, 
+                but the solution could not be computed and B_j is not modified.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of instances (systems) in the batch. 
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgesv_strided_batched(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    float *A, const rocblas_int lda, const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_stride strideP,
+    float *B, const rocblas_int ldb, const rocblas_stride strideB, rocblas_int *info, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgesv_strided_batched(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    double *A, const rocblas_int lda, const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_stride strideP,
+    double *B, const rocblas_int ldb, const rocblas_stride strideB, rocblas_int *info, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgesv_strided_batched(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    rocblas_float_complex *A, const rocblas_int lda, const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_stride strideP,
+    rocblas_float_complex *B, const rocblas_int ldb, const rocblas_stride strideB, rocblas_int *info, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgesv_strided_batched(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    rocblas_double_complex *A, const rocblas_int lda, const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_stride strideP,
+    rocblas_double_complex *B, const rocblas_int ldb, const rocblas_stride strideB, rocblas_int *info, const rocblas_int batch_count);
+
+/*! \brief DSGESV (ZCGESV) solves a system of n linear equations on n variables using 
+    a single precision LU factorization with iterative refinement in double precision.
+
+    \details
+    The system A * X = B is solved by factorizing A in single precision with GETRF and
+    refining the single precision solution with residuals R = B - A*X computed in double precision.
+    The refinement stops when, for every column i, 
+
+        max|R(:,i)| <= max|X(:,i)| * ||A|| * eps * sqrt(n),
+
+    where eps is the double precision relative machine precision and ||A|| is the infinity norm 
+    of A (computed with |real part| + |imaginary part| for complex entries). If the refinement does not 
+    converge after 30 iterations, or the single precision factorization is not possible, A is factorized 
+    in double precision and the system is solved with GETRS.
+    
+    Convergence is checked on the host, so the stream is synchronized after every refinement step.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of A.  
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of the matrices B and X.
+    @param[inout]
+    A           pointer to type. Array on the GPU of dimension lda*n.\n
+                On entry, the matrix A. On exit, if iter >= 0, A is unchanged; 
+                if iter < 0, the factors L and U of the factorization A = P*L*U in double precision.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of A.  
+    @param[out]
+    ipiv        pointer to rocblas_int. Array on the GPU of dimension n.\n
+                The pivot indices of the factorization that was used (in single precision if 
+                iter >= 0, in double precision if iter < 0).
+    @param[in]
+    B           pointer to type. Array on the GPU of dimension ldb*nrhs.\n
+                The right hand side matrix B.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of B.
+    @param[out]
+    X           pointer to type. Array on the GPU of dimension ldx*nrhs.\n
+                If info = 0, the solution matrix X.
+    @param[in]
+    ldx         rocblas_int. ldx >= n.\n
+                The leading dimension of X.
+    @param[out]
+    iter        pointer to a rocblas_int on the GPU.\n
+                If iter >= 0, the number of refinement steps that were needed.
+                If iter < 0, the double precision factorization was used:
+                -2 if an entry of A, B or a residual overflowed in single precision,
+                -3 if the single precision factorization failed,
+                -31 if the refinement did not converge.
+    @param[out]
+    info        pointer to a rocblas_int on the GPU.\n
+                If info = 0, successful exit.
+                If info = i > 0, U(i,i) of the double precision factorization is exactly zero;
+                the solution could not be computed.
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dsgesv(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    double *A, const rocblas_int lda, rocblas_int *ipiv, double *B, const rocblas_int ldb,
+    double *X, const rocblas_int ldx, rocblas_int *iter, rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zcgesv(
+    rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+    rocblas_double_complex *A, const rocblas_int lda, rocblas_int *ipiv, rocblas_double_complex *B, const rocblas_int ldb,
+    rocblas_double_complex *X, const rocblas_int ldx, rocblas_int *iter, rocblas_int *info);
+
+/*! \brief GETRI inverts a general n-by-n matrix A using the LU factorization computed by GETRF.
+
+    \details
+    The inverse is computed by solving the linear system
+
+        inv(A) * L = inv(U)
+
+    where L and U are the factors of A = P*L*U, and applying the column interchanges given by P.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The number of rows and columns of the matrix A.
+    @param[inout]
+    A           pointer to type. Array on the GPU of dimension lda*n.\n
+                On entry, the factors L and U of the factorization A = P*L*U returned by GETRF.
+                On exit, the inverse of A if info = 0.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of A.
+    @param[in]
+    ipiv        pointer to rocblas_int. Array on the GPU of dimension n.\n
+                The pivot indices returned by GETRF.
+    @param[out]
+    info        pointer to a rocblas_int on the GPU.\n
+                If info = 0, successful exit.
+                If info = i > 0, U is singular. U(i,i) is the first zero pivot and 
+                the inverse could not be computed.
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetri(
+    rocblas_handle handle, const rocblas_int n, float *A, const rocblas_int lda,
+    const rocblas_int *ipiv, rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetri(
+    rocblas_handle handle, const rocblas_int n, double *A, const rocblas_int lda,
+    const rocblas_int *ipiv, rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetri(
+    rocblas_handle handle, const rocblas_int n, rocblas_float_complex *A, const rocblas_int lda,
+    const rocblas_int *ipiv, rocblas_int *info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetri(
+    rocblas_handle handle, const rocblas_int n, rocblas_double_complex *A, const rocblas_int lda,
+    const rocblas_int *ipiv, rocblas_int *info);
+
+/*! \brief GETRI_OUTOFPLACE_BATCHED computes the inverse C_j of every general n-by-n matrix A_j in a batch, 
+    using the LU factorization computed by GETRF_BATCHED.
+
+    \details
+    For each instance j in the batch, the inverse is computed by solving the linear system
+
+        C_j * L_j = inv(U_j)
+
+    where L_j and U_j are the factors of A_j = P_j*L_j*U_j, and applying the column interchanges given by P_j.
+    The factors A_j are not modified.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The number of rows and columns of all matrices A_j in the batch.
+    @param[in]
+    A           Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+                The factors L_j and U_j of the factorization A_j = P_j*L_j*U_j returned by GETRF_BATCHED.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of matrices A_j.
+    @param[in]
+    ipiv        pointer to rocblas_int. Array on the GPU (the size depends on the value of strideP).\n
+                Contains the vectors ipiv_j of pivot indices returned by GETRF_BATCHED.
+    @param[in]
+    strideP     rocblas_stride.\n
+                Stride from the start of one vector ipiv_j to the next one ipiv_(j+1).
+                There is no restriction for the value of strideP. Normal use case is strideP >= n.
+    @param[out]
+    C           Array of pointers to type. Each pointer points to an array on the GPU of dimension ldc*n.\n
+                The inverse of each matrix A_j with info_j = 0.
+    @param[in]
+    ldc         rocblas_int. ldc >= n.\n
+                The leading dimension of matrices C_j.
+    @param[out]
+    info        pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+                If info_j = 0, successful exit for inversion of A_j.
+                If info_j = i > 0, U_j is singular. U_j(i,i) is the first zero pivot and 
+                the inverse could not be computed.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of matrices in the batch.
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetri_outofplace_batched(
+                 rocblas_handle handle, const rocblas_int n, float *const A[], const rocblas_int lda,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, float *const C[], const rocblas_int ldc,
+                 rocblas_int *info, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetri_outofplace_batched(
+                 rocblas_handle handle, const rocblas_int n, double *const A[], const rocblas_int lda,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, double *const C[], const rocblas_int ldc,
+                 rocblas_int *info, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetri_outofplace_batched(
+                 rocblas_handle handle, const rocblas_int n, rocblas_float_complex *const A[], const rocblas_int lda,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, rocblas_float_complex *const C[], const rocblas_int ldc,
+                 rocblas_int *info, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetri_outofplace_batched(
+                 rocblas_handle handle, const rocblas_int n, rocblas_double_complex *const A[], const rocblas_int lda,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, rocblas_double_complex *const C[], const rocblas_int ldc,
+                 rocblas_int *info, const rocblas_int batch_count);
+
+
+/*! \brief GECON estimates the reciprocal of the condition number (in the 1-norm)
+    of a general n-by-n matrix A,
+    using the LU factorization computed by GETRF.
+
+    \details
+    The reciprocal of the condition number is
+
+        rcond = 1 / (norm(A) * norm(inv(A)))
+
+    where norm(inv(A)) is estimated with the method of Hager and Higham (as in LAPACK's LACN2). The estimate
+    is computed entirely on the GPU from the factors of A, and anorm = norm(A) must be provided in device
+    memory (it has to be computed before the matrix is overwritten by the factorization).
+    As norm(inv(A)) is never overestimated, rcond is never underestimated (up to rounding errors);
+    in practice it is usually within a factor of 3 of the true value.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The number of rows and columns of the matrix A.
+    @param[in]
+    A           pointer to type. Array on the GPU of dimension lda*n.\n
+                The factors L and U of the factorization A = P*L*U returned by GETRF.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of A.
+    @param[in]
+    anorm       pointer to real type on the GPU.\n
+                The 1-norm of the original matrix A.
+    @param[out]
+    rcond       pointer to real type on the GPU.\n
+                The reciprocal of the condition number of A. rcond = 0 if anorm = 0 or if 
+                a diagonal element of the factor U is zero (A is singular).
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgecon(
+    rocblas_handle handle, const rocblas_int n, float *A, const rocblas_int lda,
+    const float *anorm, float *rcond);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgecon(
+    rocblas_handle handle, const rocblas_int n, double *A, const rocblas_int lda,
+    const double *anorm, double *rcond);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgecon(
+    rocblas_handle handle, const rocblas_int n, rocblas_float_complex *A, const rocblas_int lda,
+    const float *anorm, float *rcond);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgecon(
+    rocblas_handle handle, const rocblas_int n, rocblas_double_complex *A, const rocblas_int lda,
+    const double *anorm, double *rcond);
+
+/*! \brief GECON_BATCHED estimates the reciprocal of the condition number (in the 1-norm)
+    of every general n-by-n matrix A_j in a batch,
+    using the LU factorizations computed by GETRF_BATCHED.
+
+    \details
+    The reciprocal of the condition number is
+
+        rcond_j = 1 / (norm(A_j) * norm(inv(A_j)))
+
+    where norm(inv(A_j)) is estimated with the method of Hager and Higham (as in LAPACK's LACN2). The estimate
+    is computed entirely on the GPU from the factors of A_j, and anorm_j = norm(A_j) must be provided in device
+    memory (it has to be computed before the matrix is overwritten by the factorization).
+    As norm(inv(A_j)) is never overestimated, rcond_j is never underestimated (up to rounding errors);
+    in practice it is usually within a factor of 3 of the true value.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The number of rows and columns of all matrices A_j in the batch.
+    @param[in]
+    A           Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+                The factors L_j and U_j of the factorization A_j = P_j*L_j*U_j returned by GETRF_BATCHED.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of matrices A_j.
+    @param[in]
+    anorm       pointer to real type. Array of batch_count values on the GPU.\n
+                The 1-norm of each original matrix A_j.
+    @param[out]
+    rcond       pointer to real type. Array of batch_count values on the GPU.\n
+                The reciprocal of the condition number of each A_j. rcond_j = 0 if anorm_j = 0 or if 
+                a diagonal element of the factor U_j is zero (A_j is singular).
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of matrices in the batch.
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgecon_batched(
+    rocblas_handle handle, const rocblas_int n, float *const A[], const rocblas_int lda,
+    const float *anorm, float *rcond, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgecon_batched(
+    rocblas_handle handle, const rocblas_int n, double *const A[], const rocblas_int lda,
+    const double *anorm, double *rcond, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgecon_batched(
+    rocblas_handle handle, const rocblas_int n, rocblas_float_complex *const A[], const rocblas_int lda,
+    const float *anorm, float *rcond, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgecon_batched(
+    rocblas_handle handle, const rocblas_int n, rocblas_double_complex *const A[], const rocblas_int lda,
+    const double *anorm, double *rcond, const rocblas_int batch_count);
+
+/*! \brief GECON_STRIDED_BATCHED estimates the reciprocal of the condition number (in the 1-norm)
+    of every general n-by-n matrix A_j in a batch,
+    using the LU factorizations computed by GETRF_STRIDED_BATCHED.
+
+    \details
+    The reciprocal of the condition number is
+
+        rcond_j = 1 / (norm(A_j) * norm(inv(A_j)))
+
+    where norm(inv(A_j)) is estimated with the method of Hager and Higham (as in LAPACK's LACN2). The estimate
+    is computed entirely on the GPU from the factors of A_j, and anorm_j = norm(A_j) must be provided in device
+    memory (it has to be computed before the matrix is overwritten by the factorization).
+    As norm(inv(A_j)) is never overestimated, rcond_j is never underestimated (up to rounding errors);
+    in practice it is usually within a factor of 3 of the true value.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The number of rows and columns of all matrices A_j in the batch.
+    @param[in]
+    A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                The factors L_j and U_j of the factorization A_j = P_j*L_j*U_j returned by GETRF_STRIDED_BATCHED.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of matrices A_j.
+    @param[in]
+    strideA     rocblas_stride.\n
+                Stride from the start of one matrix A_j to the next one A_(j+1).
+                There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    @param[in]
+    anorm       pointer to real type. Array of batch_count values on the GPU.\n
+                The 1-norm of each original matrix A_j.
+    @param[out]
+    rcond       pointer to real type. Array of batch_count values on the GPU.\n
+                The reciprocal of the condition number of each A_j. rcond_j = 0 if anorm_j = 0 or if 
+                a diagonal element of the factor U_j is zero (A_j is singular).
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of matrices in the batch.
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgecon_strided_batched(
+    rocblas_handle handle, const rocblas_int n, float *A, const rocblas_int lda, const rocblas_stride strideA,
+    const float *anorm, float *rcond, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgecon_strided_batched(
+    rocblas_handle handle, const rocblas_int n, double *A, const rocblas_int lda, const rocblas_stride strideA,
+    const double *anorm, double *rcond, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgecon_strided_batched(
+    rocblas_handle handle, const rocblas_int n, rocblas_float_complex *A, const rocblas_int lda, const rocblas_stride strideA,
+    const float *anorm, float *rcond, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgecon_strided_batched(
+    rocblas_handle handle, const rocblas_int n, rocblas_double_complex *A, const rocblas_int lda, const rocblas_stride strideA,
+    const double *anorm, double *rcond, const rocblas_int batch_count);
+
+/*! \brief POTF2 computes the Cholesky factorization of a real symmetric
+    positive definite matrix A.
+
+    \details
+    (This is the unblocked version of the algorithm). 
+
+    The factorization has the form:
+
+        A = U' * U, or
+        A = L  * L'
+
+    depending on the value of uplo. U is an upper triangular matrix and L is lower triangular.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    uplo      rocblas_fill.\n
+              Specifies whether the factorization is upper or lower triangular.
+              If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The matrix dimensions.
+    @param[inout]
+    A         pointer to type. Array on the GPU of dimension lda*n.\n
+              On entry, the matrix A to be factored. On exit, the lower or upper triangular factor.
+    @param[in]
+    lda       rocblas_int. lda >= n.\n
+              specifies the leading dimension of A.
+    @param[out]
+    info      pointer to a rocblas_int on the GPU.\n
+              If info = 0, succesful factorization of matrix A. 
+              If info = i > 0, the leading minor of order i of A is not positive definite. 
+              The factorization stopped at this point.
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotf2(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const rocblas_int n, float *A,
+                                                   const rocblas_int lda,
+                                                   rocblas_int* info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotf2(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const rocblas_int n, double *A,
+                                                   const rocblas_int lda,
+                                                   rocblas_int* info);
+
+
+/*! \brief POTF2_BATCHED computes the Cholesky factorization of a 
+    batch of real symmetric positive definite matrices.
+
+    \details
+    (This is the unblocked version of the algorithm). 
+
+    The factorization of matrix A_i in the batch has the form:
+
+        A_i = U_i' * U_i, or
+        A_i = L_i  * L_i'
+
+    depending on the value of uplo. U_i is an upper triangular matrix and L_i is lower triangular.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    uplo      rocblas_fill.\n
+              Specifies whether the factorization is upper or lower triangular.
+              If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The dimension of matrix A_i.
+    @param[inout]
+    A         array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+              On entry, the matrices A_i to be factored. On exit, the upper or lower triangular factors. 
+    @param[in]
+    lda       rocblas_int. lda >= n.\n
+              specifies the leading dimension of A_i.
+    @param[out]
+    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              If info_i = 0, succesful factorization of matrix A_i. 
+              If info_i = j > 0, the leading minor of order j of A_i is not positive definite. 
+              The i-th factorization stopped at this point.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of matrices in the batch. 
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotf2_batched(rocblas_handle handle,
+                                                           const rocblas_fill uplo,
+                                                           const rocblas_int n, 
+                                                           float *const A[],
+                                                           const rocblas_int lda,
+                                                           rocblas_int* info,
+                                                           const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotf2_batched(rocblas_handle handle,
+                                                           const rocblas_fill uplo,
+                                                           const rocblas_int n, 
+                                                           double *const A[],
+                                                           const rocblas_int lda,
+                                                           rocblas_int* info,
+                                                           const rocblas_int batch_count);
+
+/*! \brief POTF2_STRIDED_BATCHED computes the Cholesky factorization of a 
+    batch of real symmetric positive definite matrices.
+
+    \details
+    (This is the unblocked version of the algorithm). 
+
+    The factorization of matrix A_i in the batch has the form:
+
+        A_i = U_i' * U_i, or
+        A_i = L_i  * L_i'
+
+    depending on the value of uplo. U_i is an upper triangular matrix and L_i is lower triangular.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    uplo      rocblas_fill.\n
+              Specifies whether the factorization is upper or lower triangular.
+              If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The dimension of matrix A_i.
+    @param[inout]
+    A         pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+              On entry, the matrices A_i to be factored. On exit, the upper or lower triangular factors. 
+    @param[in]
+    lda       rocblas_int. lda >= n.\n
+              specifies the leading dimension of A_i.
+    @param[in]
+    strideA   rocblas_stride.\n
+              Stride from the start of one matrix A_i and the next one A_(i+1). 
+              There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    @param[out]
+    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              If info_i = 0, succesful factorization of matrix A_i. 
+              If info_i = j > 0, the leading minor of order j of A_i is not positive definite. 
+              The i-th factorization stopped at this point.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of matrices in the batch. 
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotf2_strided_batched(rocblas_handle handle,
+                                                                   const rocblas_fill uplo,
+                                                                   const rocblas_int n, 
+                                                                   float *A,
+                                                                   const rocblas_int lda,
+                                                                   const rocblas_stride strideA,
+                                                                   rocblas_int* info,
+                                                                   const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotf2_strided_batched(rocblas_handle handle,
+                                                                   const rocblas_fill uplo,
+                                                                   const rocblas_int n, 
+                                                                   double *A,
+                                                                   const rocblas_int lda,
+                                                                   const rocblas_stride strideA,
+                                                                   rocblas_int* info,
+                                                                   const rocblas_int batch_count);
+
+/*! \brief POTRF computes the Cholesky factorization of a real symmetric
+    positive definite matrix A.
+
+    \details
+    (This is the blocked version of the algorithm). 
+
+    The factorization has the form:
+
+        A = U' * U, or
+        A = L  * L'
+
+    depending on the value of uplo. U is an upper triangular matrix and L is lower triangular.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    uplo      rocblas_fill.\n
+              Specifies whether the factorization is upper or lower triangular.
+              If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The matrix dimensions.
+    @param[inout]
+    A         pointer to type. Array on the GPU of dimension lda*n.\n
+              On entry, the matrix A to be factored. On exit, the lower or upper triangular factor.
+    @param[in]
+    lda       rocblas_int. lda >= n.\n
+              specifies the leading dimension of A.
+    @param[out]
+    info      pointer to a rocblas_int on the GPU.\n
+              If info = 0, succesful factorization of matrix A. 
+              If info = i > 0, the leading minor of order i of A is not positive definite. 
+              The factorization stopped at this point.
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const rocblas_int n, float *A,
+                                                   const rocblas_int lda,
+                                                   rocblas_int* info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const rocblas_int n, double *A,
+                                                   const rocblas_int lda,
+                                                   rocblas_int* info);
+
+
+/*! \brief POTRF_BATCHED computes the Cholesky factorization of a 
+    batch of real symmetric positive definite matrices.
+
+    \details
+    (This is the blocked version of the algorithm). 
+
+    The factorization of matrix A_i in the batch has the form:
+
+        A_i = U_i' * U_i, or
+        A_i = L_i  * L_i'
+
+    depending on the value of uplo. U_i is an upper triangular matrix and L_i is lower triangular.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    uplo      rocblas_fill.\n
+              Specifies whether the factorization is upper or lower triangular.
+              If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The dimension of matrix A_i.
+    @param[inout]
+    A         array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+              On entry, the matrices A_i to be factored. On exit, the upper or lower triangular factors. 
+    @param[in]
+    lda       rocblas_int. lda >= n.\n
+              specifies the leading dimension of A_i.
+    @param[out]
+    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              If info_i = 0, succesful factorization of matrix A_i. 
+              If info_i = j > 0, the leading minor of order j of A_i is not positive definite. 
+              The i-th factorization stopped at this point.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of matrices in the batch. 
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_batched(rocblas_handle handle,
+                                                           const rocblas_fill uplo,
+                                                           const rocblas_int n, 
+                                                           float *const A[],
+                                                           const rocblas_int lda,
+                                                           rocblas_int* info,
+                                                           const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_batched(rocblas_handle handle,
+                                                           const rocblas_fill uplo,
+                                                           const rocblas_int n, 
+                                                           double *const A[],
+                                                           const rocblas_int lda,
+                                                           rocblas_int* info,
+                                                           const rocblas_int batch_count);
+
+/*! \brief POTRF_STRIDED_BATCHED computes the Cholesky factorization of a 
+    batch of real symmetric positive definite matrices.
+
+    \details
+    (This is the blocked version of the algorithm). 
+
+    The factorization of matrix A_i in the batch has the form:
+
+        A_i = U_i' * U_i, or
+        A_i = L_i  * L_i'
+
+    depending on the value of uplo. U_i is an upper triangular matrix and L_i is lower triangular.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    uplo      rocblas_fill.\n
+              Specifies whether the factorization is upper or lower triangular.
+              If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The dimension of matrix A_i.
+    @param[inout]
+    A         pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+              On entry, the matrices A_i to be factored. On exit, the upper or lower triangular factors. 
+    @param[in]
+    lda       rocblas_int. lda >= n.\n
+              specifies the leading dimension of A_i.
+    @param[in]
+    strideA   rocblas_stride.\n
+              Stride from the start of one matrix A_i and the next one A_(i+1). 
+              There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    @param[out]
+    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              If info_i = 0, succesful factorization of matrix A_i. 
+              If info_i = j > 0, the leading minor of order j of A_i is not positive definite. 
+              The i-th factorization stopped at this point.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of matrices in the batch. 
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_strided_batched(rocblas_handle handle,
+                                                                   const rocblas_fill uplo,
+                                                                   const rocblas_int n, 
+                                                                   float *A,
+                                                                   const rocblas_int lda,
+                                                                   const rocblas_stride strideA,
+                                                                   rocblas_int* info,
+                                                                   const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_strided_batched(rocblas_handle handle,
+                                                                   const rocblas_fill uplo,
+                                                                   const rocblas_int n, 
+                                                                   double *A,
+                                                                   const rocblas_int lda,
+                                                                   const rocblas_stride strideA,
+                                                                   rocblas_int* info,
+                                                                   const rocblas_int batch_count);
+
+/*! \brief POTRF_VBATCHED computes the Cholesky factorization of a 
+    batch of real symmetric positive definite matrices of different sizes.
+
+    \details
+    The factorization of the n_i-by-n_i matrix A_i in the batch has the form:
+
+        A_i = U_i' * U_i, or
+        A_i = L_i  * L_i'
+
+    depending on the value of uplo. U_i is an upper triangular matrix and L_i is lower triangular.
+
+    The sizes are read from the GPU (this synchronizes the stream of the handle) and the matrices 
+    with the same size are factorized together, with the algorithm that
+    potrf_batched uses for that size. No matrix is padded. A batch with S distinct sizes
+    costs S calls of potrf_batched; unless the workspace was provided by the user, they are
+    spread over the stream of the handle and a secondary stream that run concurrently.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    uplo      rocblas_fill.\n
+              Specifies whether the factorization is upper or lower triangular.
+              If uplo indicates lower (or upper), then the upper (or lower) part of A_i is not used.
+    @param[in]
+    n         pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              The dimensions n_i >= 0 of the matrices A_i.
+    @param[inout]
+    A         array of pointers to type. Each pointer points to an array on the GPU of dimension lda_i*n_i.\n
+              On entry, the matrices A_i to be factored. On exit, the upper or lower triangular factors. 
+    @param[in]
+    lda       pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              The leading dimensions lda_i >= n_i of the matrices A_i.
+    @param[out]
+    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              If info_i = 0, succesful factorization of matrix A_i. 
+              If info_i = j > 0, the leading minor of order j of A_i is not positive definite. 
+              The i-th factorization stopped at this point.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of matrices in the batch. 
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_vbatched(rocblas_handle handle,
+                                                           const rocblas_fill uplo,
+                                                           const rocblas_int *n, 
+                                                           float *const A[],
+                                                           const rocblas_int *lda,
+                                                           rocblas_int* info,
+                                                           const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_vbatched(rocblas_handle handle,
+                                                           const rocblas_fill uplo,
+                                                           const rocblas_int *n, 
+                                                           double *const A[],
+                                                           const rocblas_int *lda,
+                                                           rocblas_int* info,
+                                                           const rocblas_int batch_count);
+
+/*! \brief PPTRF computes the Cholesky factorization of a real symmetric
+    positive definite matrix A stored in packed format.
+
+    \details
+    The factorization has the form:
+
+        A = U' * U, or
+        A = L  * L'
+
+    depending on the value of uplo. U is an upper triangular matrix and L is lower triangular.
+
+    The matrix is given in packed format: the upper (or lower) triangle is stored column by column 
+    in an array of dimension n*(n+1)/2. If uplo is upper, A(i,j) is stored in AP[i + j*(j+1)/2] for 
+    0 <= i <= j; if uplo is lower, A(i,j) is stored in AP[i + (2*n-j-1)*j/2] for j <= i < n.
+    The factor is returned in packed format, overwriting A. As in LAPACK, the factorization 
+    stops at the first non-positive pivot.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    uplo      rocblas_fill.\n
+              Specifies whether the upper or lower triangle of A is stored.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The matrix dimensions.
+    @param[inout]
+    AP        pointer to type. Array on the GPU of dimension n*(n+1)/2.\n
+              On entry, the triangle of the matrix A in packed format. 
+              On exit, the triangular factor U or L in packed format.
+    @param[out]
+    info      pointer to a rocblas_int on the GPU.\n
+              If info = 0, succesful factorization of matrix A. 
+              If info = i > 0, the leading minor of order i of A is not positive definite. 
+              The factorization stopped at this point.
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spptrf(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int n, 
+                                                 float *AP,
+                                                 rocblas_int* info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpptrf(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int n, 
+                                                 double *AP,
+                                                 rocblas_int* info);
+
+/*! \brief PPTRF_BATCHED computes the Cholesky factorization of a 
+    batch of real symmetric positive definite matrices stored in packed format.
+
+    \details
+    The factorization of matrix A_i in the batch has the form:
+
+        A_i = U_i' * U_i, or
+        A_i = L_i  * L_i'
+
+    depending on the value of uplo. U_i is an upper triangular matrix and L_i is lower triangular.
+
+    The matrices are given in packed format as described in PPTRF.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    uplo      rocblas_fill.\n
+              Specifies whether the upper or lower triangles of the matrices A_i are stored.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The matrix dimensions.
+    @param[inout]
+    AP        array of pointers to type. Each pointer points to an array on the GPU of dimension n*(n+1)/2.\n
+              On entry, the triangles of the matrices A_i in packed format. 
+              On exit, the triangular factors in packed format.
+    @param[out]
+    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              If info_i = 0, succesful factorization of matrix A_i. 
+              If info_i = j > 0, the leading minor of order j of A_i is not positive definite. 
+              The i-th factorization stopped at this point.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of matrices in the batch. 
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spptrf_batched(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int n, 
+                                                 float *const AP[],
+                                                 rocblas_int* info, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpptrf_batched(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int n, 
+                                                 double *const AP[],
+                                                 rocblas_int* info, const rocblas_int batch_count);
+
+/*! \brief PPTRF_STRIDED_BATCHED computes the Cholesky factorization of a 
+    batch of real symmetric positive definite matrices stored in packed format.
+
+    \details
+    The factorization of matrix A_i in the batch has the form:
+
+        A_i = U_i' * U_i, or
+        A_i = L_i  * L_i'
+
+    depending on the value of uplo. U_i is an upper triangular matrix and L_i is lower triangular.
+
+    The matrices are given in packed format as described in PPTRF.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    uplo      rocblas_fill.\n
+              Specifies whether the upper or lower triangles of the matrices A_i are stored.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The matrix dimensions.
+    @param[inout]
+    AP        pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+              On entry, the triangles of the matrices A_i in packed format. 
+              On exit, the triangular factors in packed format.
+    @param[in]
+    strideA   rocblas_stride.\n
+              Stride from the start of one packed matrix A_i and the next one A_(i+1). 
+              There is no restriction for the value of strideA. Normal use case is strideA >= n*(n+1)/2.
+    @param[out]
+    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              If info_i = 0, succesful factorization of matrix A_i. 
+              If info_i = j > 0, the leading minor of order j of A_i is not positive definite. 
+              The i-th factorization stopped at this point.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of matrices in the batch. 
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spptrf_strided_batched(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int n, 
+                                                 float *AP, const rocblas_stride strideA,
+                                                 rocblas_int* info, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpptrf_strided_batched(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int n, 
+                                                 double *AP, const rocblas_stride strideA,
+                                                 rocblas_int* info, const rocblas_int batch_count);
+
+/*! \brief PBTRF computes the Cholesky factorization of a real symmetric
+    positive definite band matrix A.
+
+    \details
+    The factorization of matrix A has the form:
+
+        A = U' * U, or
+        A = L  * L'
+
+    depending on the value of uplo. U is an upper triangular matrix and L is lower triangular.
+
+    The matrix is given in band storage with kd super (or sub) diagonals: if uplo is upper, A(i,j) 
+    is stored in AB[kd+i-j + j*ldab] for max(0,j-kd) <= i <= j; if uplo is lower, A(i,j) is stored in 
+    AB[i-j + j*ldab] for j <= i <= min(n-1,j+kd). The factorization works on the kd-by-kd window below 
+    each diagonal element, so the cost is O(n*kd^2). As in LAPACK, the factorization stops at the first 
+    non-positive pivot.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    uplo      rocblas_fill.\n
+              Specifies whether the upper or lower triangle of A is stored.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The matrix dimensions.
+    @param[in]
+    kd        rocblas_int. kd >= 0.\n
+              The number of super-diagonals (if uplo is upper) or sub-diagonals (if uplo is lower).
+    @param[inout]
+    AB        pointer to type. Array on the GPU of dimension ldab*n.\n
+              On entry, the triangle of the band matrix A.
+              On exit, the triangular factor U or L in band storage.
+    @param[in]
+    ldab      rocblas_int. ldab >= kd+1.\n
+              The leading dimension of AB.
+    @param[out]
+    info      pointer to a rocblas_int on the GPU.\n
+              If info = 0, succesful factorization of matrix A. 
+              If info = i > 0, the leading minor of order i of A is not positive definite. 
+              The factorization stopped at this point.
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spbtrf(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int n, 
+                                                 const rocblas_int kd, 
+                                                 float *AB,
+                                                 const rocblas_int ldab,
+                                                 rocblas_int* info);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpbtrf(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int n, 
+                                                 const rocblas_int kd, 
+                                                 double *AB,
+                                                 const rocblas_int ldab,
+                                                 rocblas_int* info);
+
+/*! \brief PBTRF_BATCHED computes the Cholesky factorization of a
+    batch of real symmetric positive definite band matrices.
+
+    \details
+    The factorization of matrix A_i in the batch has the form:
+
+        A_i = U_i' * U_i, or
+        A_i = L_i  * L_i'
+
+    depending on the value of uplo. U_i is an upper triangular matrix and L_i is lower triangular.
+
+    The matrices are given in band storage as described in PBTRF.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    uplo      rocblas_fill.\n
+              Specifies whether the upper or lower triangle of the matrices A_i is stored.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The matrix dimensions.
+    @param[in]
+    kd        rocblas_int. kd >= 0.\n
+              The number of super-diagonals (if uplo is upper) or sub-diagonals (if uplo is lower).
+    @param[inout]
+    AB        array of pointers to type. Each pointer points to an array on the GPU of dimension ldab*n.\n
+              On entry, the triangle of the band matrix A_i.
+              On exit, the triangular factors in band storage.
+    @param[in]
+    ldab      rocblas_int. ldab >= kd+1.\n
+              The leading dimension of the arrays AB_i.
+    @param[out]
+    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              If info_i = 0, succesful factorization of matrix A_i. 
+              If info_i = j > 0, the leading minor of order j of A_i is not positive definite. 
+              The i-th factorization stopped at this point.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of matrices in the batch. 
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spbtrf_batched(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int n, 
+                                                 const rocblas_int kd, 
+                                                 float *const AB[],
+                                                 const rocblas_int ldab,
+                                                 rocblas_int* info, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpbtrf_batched(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int n, 
+                                                 const rocblas_int kd, 
+                                                 double *const AB[],
+                                                 const rocblas_int ldab,
+                                                 rocblas_int* info, const rocblas_int batch_count);
+
+/*! \brief PBTRF_STRIDED_BATCHED computes the Cholesky factorization of a
+    batch of real symmetric positive definite band matrices.
+
+    \details
+    The factorization of matrix A_i in the batch has the form:
+
+        A_i = U_i' * U_i, or
+        A_i = L_i  * L_i'
+
+    depending on the value of uplo. U_i is an upper triangular matrix and L_i is lower triangular.
+
+    The matrices are given in band storage as described in PBTRF.
+
+    @param[in]
+    handle    rocblas_handle.
+    @param[in]
+    uplo      rocblas_fill.\n
+              Specifies whether the upper or lower triangle of the matrices A_i is stored.
+    @param[in]
+    n         rocblas_int. n >= 0.\n
+              The matrix dimensions.
+    @param[in]
+    kd        rocblas_int. kd >= 0.\n
+              The number of super-diagonals (if uplo is upper) or sub-diagonals (if uplo is lower).
+    @param[inout]
+    AB        pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+              On entry, the triangle of the band matrix A_i.
+              On exit, the triangular factors in band storage.
+    @param[in]
+    ldab      rocblas_int. ldab >= kd+1.\n
+              The leading dimension of the arrays AB_i.
+    @param[in]
+    strideA   rocblas_stride.\n
+              Stride from the start of one band matrix AB_i and the next one. 
+              There is no restriction for the value of strideA. Normal use case is strideA >= ldab*n.
+    @param[out]
+    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+              If info_i = 0, succesful factorization of matrix A_i. 
+              If info_i = j > 0, the leading minor of order j of A_i is not positive definite. 
+              The i-th factorization stopped at this point.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of matrices in the batch. 
+
+    ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spbtrf_strided_batched(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int n, 
+                                                 const rocblas_int kd, 
+                                                 float *AB,
+                                                 const rocblas_int ldab, const rocblas_stride strideA,
+                                                 rocblas_int* info, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpbtrf_strided_batched(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int n, 
+                                                 const rocblas_int kd, 
+                                                 double *AB,
+                                                 const rocblas_int ldab, const rocblas_stride strideA,
+                                                 rocblas_int* info, const rocblas_int batch_count);
+
+/*! \brief POTRS solves a system of n linear equations on n variables using the
+    Cholesky factorization computed by POTRF.
+
+    \details
+    It solves the system 
+
+        A * X = B
+
+    where A = U'*U or A = L*L' as returned by POTRF, with two triangular solves.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    uplo        rocblas_fill.\n
+                Specifies whether the factor stored in A is upper or lower triangular.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of A.  
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of the matrix B.
+    @param[in]
+    A           pointer to type. Array on the GPU of dimension lda*n.\n
+                The factor U or L of the Cholesky factorization of A returned by POTRF.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of A.  
+    @param[inout]
+    B           pointer to type. Array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrix B.
+                On exit, the solution matrix X.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of B.
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrs(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int nrhs,
+    float *A, const rocblas_int lda, float *B, const rocblas_int ldb);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrs(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int nrhs,
+    double *A, const rocblas_int lda, double *B, const rocblas_int ldb);
+
+/*! \brief POTRS_BATCHED solves a batch of systems of n linear equations on n variables using the
+    Cholesky factorizations computed by POTRF_BATCHED.
+
+    \details
+    For each instance j in the batch, it solves the system 
+
+        A_j * X_j = B_j
+
+    where A_j = U_j'*U_j or A_j = L_j*L_j' as returned by POTRF_BATCHED, with two batched
+    triangular solves.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    uplo        rocblas_fill.\n
+                Specifies whether the factor stored in A is upper or lower triangular.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the systems, i.e. the number of columns and rows of all A_j matrices.  
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_j.
+    @param[in]
+    A           Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+                The factors U_j or L_j returned by POTRF_BATCHED.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of matrices A_j.  
+    @param[inout]
+    B           Array of pointers to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrices B_j.
+                On exit, the solution matrix X_j of each system in the batch.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of matrices B_j.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of instances (systems) in the batch. 
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrs_batched(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int nrhs,
+    float *const A[], const rocblas_int lda, float *const B[], const rocblas_int ldb, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrs_batched(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int nrhs,
+    double *const A[], const rocblas_int lda, double *const B[], const rocblas_int ldb, const rocblas_int batch_count);
+
+/*! \brief POTRS_STRIDED_BATCHED solves a batch of systems of n linear equations on n variables using the
+    Cholesky factorizations computed by POTRF_STRIDED_BATCHED.
+
+    \details
+    For each instance j in the batch, it solves the system 
+
+        A_j * X_j = B_j
+
+    where A_j = U_j'*U_j or A_j = L_j*L_j' as returned by POTRF_STRIDED_BATCHED, with two batched
+    triangular solves.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    uplo        rocblas_fill.\n
+                Specifies whether the factor stored in A is upper or lower triangular.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the systems, i.e. the number of columns and rows of all A_j matrices.  
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_j.
+    @param[in]
+    A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                The factors U_j or L_j returned by POTRF_STRIDED_BATCHED.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of matrices A_j.  
+    @param[in]
+    strideA     rocblas_stride.\n
+                Stride from the start of one matrix A_j and the next one A_(j+1). 
+                There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    @param[inout]
+    B           pointer to type. Array on the GPU (size depends on the value of strideB).\n
+                On entry, the right hand side matrices B_j.
+                On exit, the solution matrix X_j of each system in the batch.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of matrices B_j.
+    @param[in]
+    strideB     rocblas_stride.\n
+                Stride from the start of one matrix B_j and the next one B_(j+1). 
+                There is no restriction for the value of strideB. Normal use case is strideB >= ldb*nrhs.
+    @param[in]
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of instances (systems) in the batch. 
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrs_strided_batched(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int nrhs,
+    float *A, const rocblas_int lda, const rocblas_stride strideA,
+    float *B, const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrs_strided_batched(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int nrhs,
+    double *A, const rocblas_int lda, const rocblas_stride strideA,
+    double *B, const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count);
+
+/*! \brief PPTRS solves a system of n linear equations on n variables using the
+    packed Cholesky factorization computed by PPTRF.
+
+    \details
+    It solves the system 
+
+        A * X = B
+
+    where A = U'*U or A = L*L' as returned by PPTRF in packed format. Each right hand side is 
+    solved by forward and backward substitution reading the packed factor directly.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    uplo        rocblas_fill.\n
+                Specifies whether the factor stored in AP is upper or lower triangular.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of A.  
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of the matrix B.
+    @param[in]
+    AP          pointer to type. Array on the GPU of dimension n*(n+1)/2.\n
+                The factor U or L of the Cholesky factorization of A returned by PPTRF.
+    @param[inout]
+    B           pointer to type. Array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrix B.
+                On exit, the solution matrix X.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of B.
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spptrs(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int nrhs,
+    float *AP, float *B, const rocblas_int ldb);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpptrs(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int nrhs,
+    double *AP, double *B, const rocblas_int ldb);
+
+/*! \brief PPTRS_BATCHED solves a batch of systems of n linear equations on n variables using the
+    packed Cholesky factorizations computed by PPTRF_BATCHED.
+
+    \details
+    For each instance j in the batch, it solves the system 
+
+        A_j * X_j = B_j
+
+    where A_j = U_j'*U_j or A_j = L_j*L_j' as returned by PPTRF_BATCHED in packed format.
+
+    @param[in]
     handle      rocblas_handle.
     @param[in]
-    trans       rocblas_operation.\n
-                Specifies the form of the system of equations of each instance in the batch. 
+    uplo        rocblas_fill.\n
+                Specifies whether the factors stored in AP are upper or lower triangular.
     @param[in]
     n           rocblas_int. n >= 0.\n
-                The order of the system, i.e. the number of columns and rows of all A_j matrices.  
+                The order of the systems, i.e. the number of columns and rows of all A_j matrices.  
     @param[in]
     nrhs        rocblas_int. nrhs >= 0.\n
                 The number of right hand sides, i.e., the number of columns
                 of all the matrices B_j.
     @param[in]
-    A           Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
-                The factors L_j and U_j of the factorization A_j = P_j*L_j*U_j returned by GETRF_BATCHED.
+    AP          Array of pointers to type. Each pointer points to an array on the GPU of dimension n*(n+1)/2.\n
+                The factors U_j or L_j returned by PPTRF_BATCHED.
+    @param[inout]
+    B           Array of pointers to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrices B_j.
+                On exit, the solution matrix X_j of each system in the batch.
     @param[in]
-    lda         rocblas_int. lda >= n.\n
-                The leading dimension of matrices A_j.
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of matrices B_j.
     @param[in]
-    ipiv        pointer to rocblas_int. Array on the GPU (the size depends on the value of strideP).\n
-                Contains the vectors ipiv_j of pivot indices returned by GETRF_BATCHED.
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of instances (systems) in the batch. 
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spptrs_batched(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int nrhs,
+    float *const AP[], float *const B[], const rocblas_int ldb, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpptrs_batched(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int nrhs,
+    double *const AP[], double *const B[], const rocblas_int ldb, const rocblas_int batch_count);
+
+/*! \brief PPTRS_STRIDED_BATCHED solves a batch of systems of n linear equations on n variables using the
+    packed Cholesky factorizations computed by PPTRF_STRIDED_BATCHED.
+
+    \details
+    For each instance j in the batch, it solves the system 
+
+        A_j * X_j = B_j
+
+    where A_j = U_j'*U_j or A_j = L_j*L_j' as returned by PPTRF_STRIDED_BATCHED in packed format.
+
     @param[in]
-    strideP     rocblas_stride.\n
-                Stride from the start of one vector ipiv_j to the next one ipiv_(j+1).
-                There is no restriction for the value of strideP. Normal use case is strideP >= min(m,n).
-    @param[in,out]
-    B           Array of pointers to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n 
+    handle      rocblas_handle.
+    @param[in]
+    uplo        rocblas_fill.\n
+                Specifies whether the factors stored in AP are upper or lower triangular.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the systems, i.e. the number of columns and rows of all A_j matrices.  
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_j.
+    @param[in]
+    AP          pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                The factors U_j or L_j returned by PPTRF_STRIDED_BATCHED.
+    @param[in]
+    strideA     rocblas_stride.\n
+                Stride from the start of one packed matrix A_j and the next one A_(j+1). 
+                There is no restriction for the value of strideA. Normal use case is strideA >= n*(n+1)/2.
+    @param[inout]
+    B           pointer to type. Array on the GPU (size depends on the value of strideB).\n
                 On entry, the right hand side matrices B_j.
                 On exit, the solution matrix X_j of each system in the batch.
     @param[in]
     ldb         rocblas_int. ldb >= n.\n
                 The leading dimension of matrices B_j.
     @param[in]
+    strideB     rocblas_stride.\n
+                Stride from the start of one matrix B_j and the next one B_(j+1). 
+                There is no restriction for the value of strideB. Normal use case is strideB >= ldb*nrhs.
+    @param[in]
     batch_count rocblas_int. batch_count >= 0.\n
                 Number of instances (systems) in the batch. 
 
    ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs_batched(
-                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
-                 const rocblas_int nrhs, float *const A[], const rocblas_int lda,
-                 const rocblas_int *ipiv, const rocblas_stride strideP, float *const B[], const rocblas_int ldb, const rocblas_int batch_count);
+ROCSOLVER_EXPORT rocblas_status rocsolver_spptrs_strided_batched(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int nrhs,
+    float *AP, const rocblas_stride strideA, float *B, const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs_batched(
-                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
-                 const rocblas_int nrhs, double *const A[], const rocblas_int lda,
-                 const rocblas_int *ipiv, const rocblas_stride strideP, double *const B[], const rocblas_int ldb, const rocblas_int batch_count);
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpptrs_strided_batched(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int nrhs,
+    double *AP, const rocblas_stride strideA, double *B, const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs_batched(
-                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
-                 const rocblas_int nrhs, rocblas_float_complex *const A[], const rocblas_int lda,
-                 const rocblas_int *ipiv, const rocblas_stride strideP, rocblas_float_complex *const B[], 
-                 const rocblas_int ldb, const rocblas_int batch_count);
+/*! \brief PBTRS solves a system of n linear equations on n variables using the
+    band Cholesky factorization computed by PBTRF.
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_batched(
-                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
-                 const rocblas_int nrhs, rocblas_double_complex *const A[], const rocblas_int lda,
-                 const rocblas_int *ipiv, const rocblas_stride strideP, rocblas_double_complex *const B[], 
-                 const rocblas_int ldb, const rocblas_int batch_count);
+    \details
+    It solves the system 
 
-/*! \brief GETRS_STRIDED_BATCHED solves a batch of systems of n linear equations on n variables 
-     using the LU factorization computed by GETRF_STRIDED_BATCHED.
+        A * X = B
+
+    where A = U'*U or A = L*L' as returned by PBTRF in band storage. Each right hand side 
+    is solved by forward and backward substitution, with kd entries per row.
+
+    @param[in]
+    handle      rocblas_handle.
+    @param[in]
+    uplo        rocblas_fill.\n
+                Specifies whether the factor stored in AB is upper or lower triangular.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of A.  
+    @param[in]
+    kd          rocblas_int. kd >= 0.\n
+                The number of super-diagonals (if uplo is upper) or sub-diagonals (if uplo is lower).
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of the matrix B.
+    @param[in]
+    AB          pointer to type. Array on the GPU of dimension ldab*n.\n
+                The factor U or L of the Cholesky factorization of A returned by PBTRF.
+    @param[in]
+    ldab        rocblas_int. ldab >= kd+1.\n
+                The leading dimension of AB.
+    @param[inout]
+    B           pointer to type. Array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrix B.
+                On exit, the solution matrix X.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of B.
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spbtrs(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int kd, const rocblas_int nrhs,
+    float *AB, const rocblas_int ldab, float *B, const rocblas_int ldb);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpbtrs(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int kd, const rocblas_int nrhs,
+    double *AB, const rocblas_int ldab, double *B, const rocblas_int ldb);
+
+/*! \brief PBTRS_BATCHED solves a batch of systems of n linear equations on n variables using the
+    band Cholesky factorizations computed by PBTRF_BATCHED.
 
     \details
-    For each instance j in the batch, it solves one of the following systems: 
+    For each instance j in the batch, it solves the system 
 
-        A_j  * X_j = B_j (no transpose),  
-        A_j' * X_j = B_j (transpose),  or  
-        A_j* * X_j = B_j (conjugate transpose)
+        A_j * X_j = B_j
 
-    depending on the value of trans. 
+    where A_j = U_j'*U_j or A_j = L_j*L_j' as returned by PBTRF_BATCHED in band storage. Each right hand side 
+    is solved by forward and backward substitution, with kd entries per row.
 
     @param[in]
     handle      rocblas_handle.
     @param[in]
-    trans       rocblas_operation.\n
-                Specifies the form of the system of equations of each instance in the batch. 
+    uplo        rocblas_fill.\n
+                Specifies whether the factors stored in AB are upper or lower triangular.
     @param[in]
     n           rocblas_int. n >= 0.\n
-                The order of the system, i.e. the number of columns and rows of all A_j matrices.  
+                The order of the systems, i.e. the number of columns and rows of all A_j matrices.  
+    @param[in]
+    kd          rocblas_int. kd >= 0.\n
+                The number of super-diagonals (if uplo is upper) or sub-diagonals (if uplo is lower).
     @param[in]
     nrhs        rocblas_int. nrhs >= 0.\n
                 The number of right hand sides, i.e., the number of columns
                 of all the matrices B_j.
     @param[in]
-    A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
-                The factors L_j and U_j of the factorization A_j = P_j*L_j*U_j returned by GETRF_STRIDED_BATCHED.
+    AB          Array of pointers to type. Each pointer points to an array on the GPU of dimension ldab*n.\n
+                The factors U_j or L_j returned by PBTRF_BATCHED.
     @param[in]
-    lda         rocblas_int. lda >= n.\n
-                The leading dimension of matrices A_j.
+    ldab        rocblas_int. ldab >= kd+1.\n
+                The leading dimension of the arrays AB_j.
+    @param[inout]
+    B           Array of pointers to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrices B_j.
+                On exit, the solution matrix X_j of each system in the batch.
     @param[in]
-    strideA     rocblas_stride.\n
-                Stride from the start of one matrix A_j and the next one A_(j+1). 
-                There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of matrices B_j.
     @param[in]
-    ipiv        pointer to rocblas_int. Array on the GPU (the size depends on the value of strideP).\n
-                Contains the vectors ipiv_j of pivot indices returned by GETRF_STRIDED_BATCHED.
+    batch_count rocblas_int. batch_count >= 0.\n
+                Number of instances (systems) in the batch. 
+
+   ********************************************************************/
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spbtrs_batched(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int kd, const rocblas_int nrhs,
+    float *const AB[], const rocblas_int ldab, float *const B[], const rocblas_int ldb, const rocblas_int batch_count);
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpbtrs_batched(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int kd, const rocblas_int nrhs,
+    double *const AB[], const rocblas_int ldab, double *const B[], const rocblas_int ldb, const rocblas_int batch_count);
+
+/*! \brief PBTRS_STRIDED_BATCHED solves a batch of systems of n linear equations on n variables using the
+    band Cholesky factorizations computed by PBTRF_STRIDED_BATCHED.
+
+    \details
+    For each instance j in the batch, it solves the system 
+
+        A_j * X_j = B_j
+
+    where A_j = U_j'*U_j or A_j = L_j*L_j' as returned by PBTRF_STRIDED_BATCHED in band storage. Each right hand side 
+    is solved by forward and backward substitution, with kd entries per row.
+
     @param[in]
-    strideP     rocblas_stride.\n
-                Stride from the start of one vector ipiv_j to the next one ipiv_(j+1).
-                There is no restriction for the value of strideP. Normal use case is strideP >= min(m,n).
-    @param[in,out]
+    handle      rocblas_handle.
+    @param[in]
+    uplo        rocblas_fill.\n
+                Specifies whether the factors stored in AB are upper or lower triangular.
+    @param[in]
+    n           rocblas_int. n >= 0.\n
+                The order of the systems, i.e. the number of columns and rows of all A_j matrices.  
+    @param[in]
+    kd          rocblas_int. kd >= 0.\n
+                The number of super-diagonals (if uplo is upper) or sub-diagonals (if uplo is lower).
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_j.
+    @param[in]
+    AB          pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                The factors U_j or L_j returned by PBTRF_STRIDED_BATCHED.
+    @param[in]
+    ldab        rocblas_int. ldab >= kd+1.\n
+                The leading dimension of the arrays AB_j.
+    @param[in]
+    strideA     rocblas_stride.\n
+                Stride from the start of one band matrix AB_j and the next one AB_(j+1). 
+                There is no restriction for the value of strideA. Normal use case is strideA >= ldab*n.
+    @param[inout]
     B           pointer to type. Array on the GPU (size depends on the value of strideB).\n
                 On entry, the right hand side matrices B_j.
                 On exit, the solution matrix X_j of each system in the batch.
@@ -2679,358 +5682,343 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_batched(
 
    ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrs_strided_batched(
-                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
-                 const rocblas_int nrhs, float *A, const rocblas_int lda, const rocblas_stride strideA,
-                 const rocblas_int *ipiv, const rocblas_stride strideP, float *B, const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count);
-
-ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrs_strided_batched(
-                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
-                 const rocblas_int nrhs, double *A, const rocblas_int lda, const rocblas_stride strideA,
-                 const rocblas_int *ipiv, const rocblas_stride strideP, double *B, const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count);
-
-ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrs_strided_batched(
-                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
-                 const rocblas_int nrhs, rocblas_float_complex *A, const rocblas_int lda, const rocblas_stride strideA,
-                 const rocblas_int *ipiv, const rocblas_stride strideP, rocblas_float_complex *B, const rocblas_int ldb, 
-                 const rocblas_stride strideB, const rocblas_int batch_count);
-
-ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrs_strided_batched(
-                 rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
-                 const rocblas_int nrhs, rocblas_double_complex *A, const rocblas_int lda, const rocblas_stride strideA,
-                 const rocblas_int *ipiv, const rocblas_stride strideP, rocblas_double_complex *B, const rocblas_int ldb, 
-                 const rocblas_stride strideB, const rocblas_int batch_count);
+ROCSOLVER_EXPORT rocblas_status rocsolver_spbtrs_strided_batched(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int kd, const rocblas_int nrhs,
+    float *AB, const rocblas_int ldab, const rocblas_stride strideA, float *B, const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count);
 
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpbtrs_strided_batched(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int kd, const rocblas_int nrhs,
+    double *AB, const rocblas_int ldab, const rocblas_stride strideA, double *B, const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count);
 
-/*! \brief POTF2 computes the Cholesky factorization of a real symmetric
-    positive definite matrix A.
+/*! \brief POSV solves a symmetric positive definite system of n linear equations on n variables.
 
     \details
-    (This is the unblocked version of the algorithm). 
-
-    The factorization has the form:
+    The linear system
 
-        A = U' * U, or
-        A = L  * L'
+        A * X = B
 
-    depending on the value of uplo. U is an upper triangular matrix and L is lower triangular.
+    is solved by computing the Cholesky factorization of A with POTRF and then solving 
+    with POTRS. Both steps run on the device one after the other, sharing the workspace
+    and without synchronizing with the host.
 
     @param[in]
-    handle    rocblas_handle.
+    handle      rocblas_handle.
     @param[in]
-    uplo      rocblas_fill.\n
-              Specifies whether the factorization is upper or lower triangular.
-              If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    uplo        rocblas_fill.\n
+                Specifies whether the upper or lower triangular part of A is used (and
+                whether the factorization is A = U'*U or A = L*L').
     @param[in]
-    n         rocblas_int. n >= 0.\n
-              The matrix dimensions.
+    n           rocblas_int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of A.  
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of the matrix B.
     @param[inout]
-    A         pointer to type. Array on the GPU of dimension lda*n.\n
-              On entry, the matrix A to be factored. On exit, the lower or upper triangular factor.
+    A           pointer to type. Array on the GPU of dimension lda*n.\n
+                On entry, the symmetric matrix A. On exit, the factor U or L of the factorization.
     @param[in]
-    lda       rocblas_int. lda >= n.\n
-              specifies the leading dimension of A.
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of A.  
+    @param[inout]
+    B           pointer to type. Array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrix B.
+                On exit, the solution matrix X.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of B.
     @param[out]
-    info      pointer to a rocblas_int on the GPU.\n
-              If info = 0, succesful factorization of matrix A. 
-              If info = i > 0, the leading minor of order i of A is not positive definite. 
-              The factorization stopped at this point.
-
-    ********************************************************************/
+    info        pointer to a rocblas_int on the GPU.\n
+                If info = 0, successful exit.
+                If info = i > 0, the leading minor of order i of A is not positive definite.
+                The solution could not be computed and B is not modified.
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_spotf2(rocblas_handle handle,
-                                                   const rocblas_fill uplo,
-                                                   const rocblas_int n, float *A,
-                                                   const rocblas_int lda,
-                                                   rocblas_int* info);
+   ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_dpotf2(rocblas_handle handle,
-                                                   const rocblas_fill uplo,
-                                                   const rocblas_int n, double *A,
-                                                   const rocblas_int lda,
-                                                   rocblas_int* info);
+ROCSOLVER_EXPORT rocblas_status rocsolver_sposv(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int nrhs,
+    float *A, const rocblas_int lda, float *B, const rocblas_int ldb, rocblas_int *info);
 
+ROCSOLVER_EXPORT rocblas_status rocsolver_dposv(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int nrhs,
+    double *A, const rocblas_int lda, double *B, const rocblas_int ldb, rocblas_int *info);
 
-/*! \brief POTF2_BATCHED computes the Cholesky factorization of a 
-    batch of real symmetric positive definite matrices.
+/*! \brief POSV_BATCHED solves a batch of symmetric positive definite systems of n linear equations on n variables.
 
     \details
-    (This is the unblocked version of the algorithm). 
-
-    The factorization of matrix A_i in the batch has the form:
+    For each instance j in the batch, the linear system
 
-        A_i = U_i' * U_i, or
-        A_i = L_i  * L_i'
+        A_j * X_j = B_j
 
-    depending on the value of uplo. U_i is an upper triangular matrix and L_i is lower triangular.
+    is solved by computing the Cholesky factorization of A_j with POTRF_BATCHED and then solving 
+    with POTRS_BATCHED. Both steps run on the device one after the other, sharing the workspace
+    and without synchronizing with the host. The systems whose matrix is not positive definite
+    are skipped by the solve.
 
     @param[in]
-    handle    rocblas_handle.
+    handle      rocblas_handle.
     @param[in]
-    uplo      rocblas_fill.\n
-              Specifies whether the factorization is upper or lower triangular.
-              If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    uplo        rocblas_fill.\n
+                Specifies whether the upper or lower triangular part of A is used (and
+                whether the factorization is A = U'*U or A = L*L').
     @param[in]
-    n         rocblas_int. n >= 0.\n
-              The dimension of matrix A_i.
+    n           rocblas_int. n >= 0.\n
+                The order of the systems, i.e. the number of columns and rows of all A_j matrices.  
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_j.
     @param[inout]
-    A         array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
-              On entry, the matrices A_i to be factored. On exit, the upper or lower triangular factors. 
+    A           Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+                On entry, the matrices A_j. On exit, the factors U_j or L_j of the factorizations.
     @param[in]
-    lda       rocblas_int. lda >= n.\n
-              specifies the leading dimension of A_i.
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of matrices A_j.  
+    @param[inout]
+    B           Array of pointers to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrices B_j.
+                On exit, the solution matrix X_j of each system in the batch.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of matrices B_j.
     @param[out]
-    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
-              If info_i = 0, succesful factorization of matrix A_i. 
-              If info_i = j > 0, the leading minor of order j of A_i is not positive definite. 
-              The i-th factorization stopped at this point.
+    info        pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+                If info_j = 0, successful exit.
+                If info_j = i > 0, the leading minor of order i of A_j is not positive definite.
+                The solution could not be computed and B_j is not modified.
     @param[in]
     batch_count rocblas_int. batch_count >= 0.\n
-                Number of matrices in the batch. 
+                Number of instances (systems) in the batch. 
 
-    ********************************************************************/
+   ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_spotf2_batched(rocblas_handle handle,
-                                                           const rocblas_fill uplo,
-                                                           const rocblas_int n, 
-                                                           float *const A[],
-                                                           const rocblas_int lda,
-                                                           rocblas_int* info,
-                                                           const rocblas_int batch_count);
+ROCSOLVER_EXPORT rocblas_status rocsolver_sposv_batched(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int nrhs,
+    float *const A[], const rocblas_int lda, float *const B[], const rocblas_int ldb,
+    rocblas_int *info, const rocblas_int batch_count);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_dpotf2_batched(rocblas_handle handle,
-                                                           const rocblas_fill uplo,
-                                                           const rocblas_int n, 
-                                                           double *const A[],
-                                                           const rocblas_int lda,
-                                                           rocblas_int* info,
-                                                           const rocblas_int batch_count);
+ROCSOLVER_EXPORT rocblas_status rocsolver_dposv_batched(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int nrhs,
+    double *const A[], const rocblas_int lda, double *const B[], const rocblas_int ldb,
+    rocblas_int *info, const rocblas_int batch_count);
 
-/*! \brief POTF2_STRIDED_BATCHED computes the Cholesky factorization of a 
-    batch of real symmetric positive definite matrices.
+/*! \brief POSV_STRIDED_BATCHED solves a batch of symmetric positive definite systems of n linear equations on n variables.
 
     \details
-    (This is the unblocked version of the algorithm). 
-
-    The factorization of matrix A_i in the batch has the form:
+    For each instance j in the batch, the linear system
 
-        A_i = U_i' * U_i, or
-        A_i = L_i  * L_i'
+        A_j * X_j = B_j
 
-    depending on the value of uplo. U_i is an upper triangular matrix and L_i is lower triangular.
+    is solved by computing the Cholesky factorization of A_j with POTRF_STRIDED_BATCHED and then solving 
+    with POTRS_STRIDED_BATCHED. Both steps run on the device one after the other, sharing the workspace
+    and without synchronizing with the host. The systems whose matrix is not positive definite
+    are skipped by the solve.
 
     @param[in]
-    handle    rocblas_handle.
+    handle      rocblas_handle.
     @param[in]
-    uplo      rocblas_fill.\n
-              Specifies whether the factorization is upper or lower triangular.
-              If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    uplo        rocblas_fill.\n
+                Specifies whether the upper or lower triangular part of A is used (and
+                whether the factorization is A = U'*U or A = L*L').
     @param[in]
-    n         rocblas_int. n >= 0.\n
-              The dimension of matrix A_i.
+    n           rocblas_int. n >= 0.\n
+                The order of the systems, i.e. the number of columns and rows of all A_j matrices.  
+    @param[in]
+    nrhs        rocblas_int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_j.
     @param[inout]
-    A         pointer to type. Array on the GPU (the size depends on the value of strideA).\n
-              On entry, the matrices A_i to be factored. On exit, the upper or lower triangular factors. 
+    A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                On entry, the matrices A_j. On exit, the factors U_j or L_j of the factorizations.
     @param[in]
-    lda       rocblas_int. lda >= n.\n
-              specifies the leading dimension of A_i.
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of matrices A_j.  
     @param[in]
-    strideA   rocblas_stride.\n
-              Stride from the start of one matrix A_i and the next one A_(i+1). 
-              There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    strideA     rocblas_stride.\n
+                Stride from the start of one matrix A_j and the next one A_(j+1). 
+                There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    @param[inout]
+    B           pointer to type. Array on the GPU (size depends on the value of strideB).\n
+                On entry, the right hand side matrices B_j.
+                On exit, the solution matrix X_j of each system in the batch.
+    @param[in]
+    ldb         rocblas_int. ldb >= n.\n
+                The leading dimension of matrices B_j.
+    @param[in]
+    strideB     rocblas_stride.\n
+                Stride from the start of one matrix B_j and the next one B_(j+1). 
+                There is no restriction for the value of strideB. Normal use case is strideB >= ldb*nrhs.
     @param[out]
-    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
-              If info_i = 0, succesful factorization of matrix A_i. 
-              If info_i = j > 0, the leading minor of order j of A_i is not positive definite. 
-              The i-th factorization stopped at this point.
+    info        pointer to rocblas_int. Array of batch_count integers on the GPU.\n
+                If info_j = 0, successful exit.
+                If info_j = i > 0, the leading minor of order i of A_j is not positive definite.
+                The solution could not be computed and B_j is not modified.
     @param[in]
     batch_count rocblas_int. batch_count >= 0.\n
-                Number of matrices in the batch. 
+                Number of instances (systems) in the batch. 
 
-    ********************************************************************/
+   ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_spotf2_strided_batched(rocblas_handle handle,
-                                                                   const rocblas_fill uplo,
-                                                                   const rocblas_int n, 
-                                                                   float *A,
-                                                                   const rocblas_int lda,
-                                                                   const rocblas_stride strideA,
-                                                                   rocblas_int* info,
-                                                                   const rocblas_int batch_count);
+ROCSOLVER_EXPORT rocblas_status rocsolver_sposv_strided_batched(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int nrhs,
+    float *A, const rocblas_int lda, const rocblas_stride strideA,
+    float *B, const rocblas_int ldb, const rocblas_stride strideB, rocblas_int *info, const rocblas_int batch_count);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_dpotf2_strided_batched(rocblas_handle handle,
-                                                                   const rocblas_fill uplo,
-                                                                   const rocblas_int n, 
-                                                                   double *A,
-                                                                   const rocblas_int lda,
-                                                                   const rocblas_stride strideA,
-                                                                   rocblas_int* info,
-                                                                   const rocblas_int batch_count);
+ROCSOLVER_EXPORT rocblas_status rocsolver_dposv_strided_batched(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int nrhs,
+    double *A, const rocblas_int lda, const rocblas_stride strideA,
+    double *B, const rocblas_int ldb, const rocblas_stride strideB, rocblas_int *info, const rocblas_int batch_count);
 
-/*! \brief POTRF computes the Cholesky factorization of a real symmetric
-    positive definite matrix A.
+/*! \brief POCON estimates the reciprocal of the condition number (in the 1-norm)
+    of a symmetric positive definite n-by-n matrix A,
+    using the Cholesky factorization computed by POTRF.
 
     \details
-    (This is the blocked version of the algorithm). 
+    The reciprocal of the condition number is
 
-    The factorization has the form:
-
-        A = U' * U, or
-        A = L  * L'
+        rcond = 1 / (norm(A) * norm(inv(A)))
 
-    depending on the value of uplo. U is an upper triangular matrix and L is lower triangular.
+    where norm(inv(A)) is estimated with the method of Hager and Higham (as in LAPACK's LACN2). The estimate
+    is computed entirely on the GPU from the factors of A, and anorm = norm(A) must be provided in device
+    memory (it has to be computed before the matrix is overwritten by the factorization).
+    As norm(inv(A)) is never overestimated, rcond is never underestimated (up to rounding errors);
+    in practice it is usually within a factor of 3 of the true value.
 
     @param[in]
-    handle    rocblas_handle.
+    handle      rocblas_handle.
     @param[in]
-    uplo      rocblas_fill.\n
-              Specifies whether the factorization is upper or lower triangular.
-              If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    uplo        rocblas_fill.\n
+                Specifies whether the factorization is upper or lower triangular (A = U'*U or A = L*L').
     @param[in]
-    n         rocblas_int. n >= 0.\n
-              The matrix dimensions.
-    @param[inout]
-    A         pointer to type. Array on the GPU of dimension lda*n.\n
-              On entry, the matrix A to be factored. On exit, the lower or upper triangular factor.
+    n           rocblas_int. n >= 0.\n
+                The number of rows and columns of the matrix A.
     @param[in]
-    lda       rocblas_int. lda >= n.\n
-              specifies the leading dimension of A.
+    A           pointer to type. Array on the GPU of dimension lda*n.\n
+                The factor U or L returned by POTRF.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of A.
+    @param[in]
+    anorm       pointer to real type on the GPU.\n
+                The 1-norm of the original matrix A.
     @param[out]
-    info      pointer to a rocblas_int on the GPU.\n
-              If info = 0, succesful factorization of matrix A. 
-              If info = i > 0, the leading minor of order i of A is not positive definite. 
-              The factorization stopped at this point.
-
-    ********************************************************************/
+    rcond       pointer to real type on the GPU.\n
+                The reciprocal of the condition number of A. rcond = 0 if anorm = 0 or if 
+                a diagonal element of the factor is zero (A is singular).
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf(rocblas_handle handle,
-                                                   const rocblas_fill uplo,
-                                                   const rocblas_int n, float *A,
-                                                   const rocblas_int lda,
-                                                   rocblas_int* info);
+   ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf(rocblas_handle handle,
-                                                   const rocblas_fill uplo,
-                                                   const rocblas_int n, double *A,
-                                                   const rocblas_int lda,
-                                                   rocblas_int* info);
+ROCSOLVER_EXPORT rocblas_status rocsolver_spocon(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, float *A, const rocblas_int lda,
+    const float *anorm, float *rcond);
 
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpocon(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, double *A, const rocblas_int lda,
+    const double *anorm, double *rcond);
 
-/*! \brief POTRF_BATCHED computes the Cholesky factorization of a 
-    batch of real symmetric positive definite matrices.
+/*! \brief POCON_BATCHED estimates the reciprocal of the condition number (in the 1-norm)
+    of every symmetric positive definite n-by-n matrix A_j in a batch,
+    using the Cholesky factorizations computed by POTRF_BATCHED.
 
     \details
-    (This is the blocked version of the algorithm). 
-
-    The factorization of matrix A_i in the batch has the form:
+    The reciprocal of the condition number is
 
-        A_i = U_i' * U_i, or
-        A_i = L_i  * L_i'
+        rcond_j = 1 / (norm(A_j) * norm(inv(A_j)))
 
-    depending on the value of uplo. U_i is an upper triangular matrix and L_i is lower triangular.
+    where norm(inv(A_j)) is estimated with the method of Hager and Higham (as in LAPACK's LACN2). The estimate
+    is computed entirely on the GPU from the factors of A_j, and anorm_j = norm(A_j) must be provided in device
+    memory (it has to be computed before the matrix is overwritten by the factorization).
+    As norm(inv(A_j)) is never overestimated, rcond_j is never underestimated (up to rounding errors);
+    in practice it is usually within a factor of 3 of the true value.
 
     @param[in]
-    handle    rocblas_handle.
+    handle      rocblas_handle.
     @param[in]
-    uplo      rocblas_fill.\n
-              Specifies whether the factorization is upper or lower triangular.
-              If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    uplo        rocblas_fill.\n
+                Specifies whether the factorization is upper or lower triangular (A_j = U_j'*U_j or A_j = L_j*L_j').
     @param[in]
-    n         rocblas_int. n >= 0.\n
-              The dimension of matrix A_i.
-    @param[inout]
-    A         array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
-              On entry, the matrices A_i to be factored. On exit, the upper or lower triangular factors. 
+    n           rocblas_int. n >= 0.\n
+                The number of rows and columns of all matrices A_j in the batch.
     @param[in]
-    lda       rocblas_int. lda >= n.\n
-              specifies the leading dimension of A_i.
+    A           Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+                The factor U_j or L_j returned by POTRF_BATCHED.
+    @param[in]
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of matrices A_j.
+    @param[in]
+    anorm       pointer to real type. Array of batch_count values on the GPU.\n
+                The 1-norm of each original matrix A_j.
     @param[out]
-    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
-              If info_i = 0, succesful factorization of matrix A_i. 
-              If info_i = j > 0, the leading minor of order j of A_i is not positive definite. 
-              The i-th factorization stopped at this point.
+    rcond       pointer to real type. Array of batch_count values on the GPU.\n
+                The reciprocal of the condition number of each A_j. rcond_j = 0 if anorm_j = 0 or if 
+                a diagonal element of the factor is zero (A_j is singular).
     @param[in]
     batch_count rocblas_int. batch_count >= 0.\n
-                Number of matrices in the batch. 
+                Number of matrices in the batch.
 
-    ********************************************************************/
+   ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_batched(rocblas_handle handle,
-                                                           const rocblas_fill uplo,
-                                                           const rocblas_int n, 
-                                                           float *const A[],
-                                                           const rocblas_int lda,
-                                                           rocblas_int* info,
-                                                           const rocblas_int batch_count);
+ROCSOLVER_EXPORT rocblas_status rocsolver_spocon_batched(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, float *const A[], const rocblas_int lda,
+    const float *anorm, float *rcond, const rocblas_int batch_count);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_batched(rocblas_handle handle,
-                                                           const rocblas_fill uplo,
-                                                           const rocblas_int n, 
-                                                           double *const A[],
-                                                           const rocblas_int lda,
-                                                           rocblas_int* info,
-                                                           const rocblas_int batch_count);
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpocon_batched(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, double *const A[], const rocblas_int lda,
+    const double *anorm, double *rcond, const rocblas_int batch_count);
 
-/*! \brief POTRF_STRIDED_BATCHED computes the Cholesky factorization of a 
-    batch of real symmetric positive definite matrices.
+/*! \brief POCON_STRIDED_BATCHED estimates the reciprocal of the condition number (in the 1-norm)
+    of every symmetric positive definite n-by-n matrix A_j in a batch,
+    using the Cholesky factorizations computed by POTRF_STRIDED_BATCHED.
 
     \details
-    (This is the blocked version of the algorithm). 
-
-    The factorization of matrix A_i in the batch has the form:
+    The reciprocal of the condition number is
 
-        A_i = U_i' * U_i, or
-        A_i = L_i  * L_i'
+        rcond_j = 1 / (norm(A_j) * norm(inv(A_j)))
 
-    depending on the value of uplo. U_i is an upper triangular matrix and L_i is lower triangular.
+    where norm(inv(A_j)) is estimated with the method of Hager and Higham (as in LAPACK's LACN2). The estimate
+    is computed entirely on the GPU from the factors of A_j, and anorm_j = norm(A_j) must be provided in device
+    memory (it has to be computed before the matrix is overwritten by the factorization).
+    As norm(inv(A_j)) is never overestimated, rcond_j is never underestimated (up to rounding errors);
+    in practice it is usually within a factor of 3 of the true value.
 
     @param[in]
-    handle    rocblas_handle.
+    handle      rocblas_handle.
     @param[in]
-    uplo      rocblas_fill.\n
-              Specifies whether the factorization is upper or lower triangular.
-              If uplo indicates lower (or upper), then the upper (or lower) part of A is not used.
+    uplo        rocblas_fill.\n
+                Specifies whether the factorization is upper or lower triangular (A_j = U_j'*U_j or A_j = L_j*L_j').
     @param[in]
-    n         rocblas_int. n >= 0.\n
-              The dimension of matrix A_i.
-    @param[inout]
-    A         pointer to type. Array on the GPU (the size depends on the value of strideA).\n
-              On entry, the matrices A_i to be factored. On exit, the upper or lower triangular factors. 
+    n           rocblas_int. n >= 0.\n
+                The number of rows and columns of all matrices A_j in the batch.
     @param[in]
-    lda       rocblas_int. lda >= n.\n
-              specifies the leading dimension of A_i.
+    A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                The factor U_j or L_j returned by POTRF_STRIDED_BATCHED.
     @param[in]
-    strideA   rocblas_stride.\n
-              Stride from the start of one matrix A_i and the next one A_(i+1). 
-              There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    lda         rocblas_int. lda >= n.\n
+                The leading dimension of matrices A_j.
+    @param[in]
+    strideA     rocblas_stride.\n
+                Stride from the start of one matrix A_j to the next one A_(j+1).
+                There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    @param[in]
+    anorm       pointer to real type. Array of batch_count values on the GPU.\n
+                The 1-norm of each original matrix A_j.
     @param[out]
-    info      pointer to rocblas_int. Array of batch_count integers on the GPU.\n
-              If info_i = 0, succesful factorization of matrix A_i. 
-              If info_i = j > 0, the leading minor of order j of A_i is not positive definite. 
-              The i-th factorization stopped at this point.
+    rcond       pointer to real type. Array of batch_count values on the GPU.\n
+                The reciprocal of the condition number of each A_j. rcond_j = 0 if anorm_j = 0 or if 
+                a diagonal element of the factor is zero (A_j is singular).
     @param[in]
     batch_count rocblas_int. batch_count >= 0.\n
-                Number of matrices in the batch. 
+                Number of matrices in the batch.
 
-    ********************************************************************/
+   ********************************************************************/
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_strided_batched(rocblas_handle handle,
-                                                                   const rocblas_fill uplo,
-                                                                   const rocblas_int n, 
-                                                                   float *A,
-                                                                   const rocblas_int lda,
-                                                                   const rocblas_stride strideA,
-                                                                   rocblas_int* info,
-                                                                   const rocblas_int batch_count);
+ROCSOLVER_EXPORT rocblas_status rocsolver_spocon_strided_batched(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, float *A, const rocblas_int lda, const rocblas_stride strideA,
+    const float *anorm, float *rcond, const rocblas_int batch_count);
 
-ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_strided_batched(rocblas_handle handle,
-                                                                   const rocblas_fill uplo,
-                                                                   const rocblas_int n, 
-                                                                   double *A,
-                                                                   const rocblas_int lda,
-                                                                   const rocblas_stride strideA,
-                                                                   rocblas_int* info,
-                                                                   const rocblas_int batch_count);
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpocon_strided_batched(
+    rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, double *A, const rocblas_int lda, const rocblas_stride strideA,
+    const double *anorm, double *rcond, const rocblas_int batch_count);
 
 
 #ifdef __cplusplus
@@ -0,0 +1,56 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocauxiliary_lapmr.hpp"
+
+rocblas_status rocsolver_ipiv2perm_impl(rocblas_handle handle, const rocblas_int m, const rocblas_int k,
+                                        const rocblas_int *ipiv, const rocblas_stride strideP,
+                                        rocblas_int *perm, const rocblas_stride strideQ, const rocblas_int batch_count) {
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    //logging is missing ???
+
+    if (m < 0 || k < 0 || k > m || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if (!ipiv || !perm)
+        return rocblas_status_invalid_pointer;
+
+    // no workspace needed
+    if (rocsolver_workspace_query(handle,0))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,0);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_ipiv2perm_template(handle,m,k,
+                                        ipiv,0,    //the vector is shifted 0 entries (will work on the entire vector)
+                                        strideP,
+                                        perm,strideQ,
+                                        batch_count);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_ipiv2perm(rocblas_handle handle, const rocblas_int m, const rocblas_int k,
+                 const rocblas_int *ipiv, rocblas_int *perm)
+{
+    return rocsolver_ipiv2perm_impl(handle, m, k, ipiv, 0, perm, 0, 1);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_ipiv2perm_batched(rocblas_handle handle, const rocblas_int m, const rocblas_int k,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, rocblas_int *perm, const rocblas_stride strideQ,
+                 const rocblas_int batch_count)
+{
+    return rocsolver_ipiv2perm_impl(handle, m, k, ipiv, strideP, perm, strideQ, batch_count);
+}
+
+} //extern C
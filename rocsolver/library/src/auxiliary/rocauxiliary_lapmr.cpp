@@ -0,0 +1,75 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocauxiliary_lapmr.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_lapmr_impl(rocblas_handle handle, const rocblas_direct direct, const rocblas_int m, const rocblas_int n,
+                                    U X, const rocblas_int ldx, const rocblas_int *perm) {
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    //logging is missing ???
+
+    if (direct != rocblas_forward_direction && direct != rocblas_backward_direction)
+        return rocblas_status_not_implemented;
+    if (m < 0 || n < 0 || ldx < m || ldx < 1)
+        return rocblas_status_invalid_size;
+    if (!X || !perm)
+        return rocblas_status_invalid_pointer;
+
+    rocblas_stride strideX = 0;
+    rocblas_stride strideQ = 0;
+    rocblas_int batch_count=1;
+
+    // memory management
+    size_t size;
+    rocsolver_lapmr_getMemorySize<T>(m,n,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_lapmr_template<T>(handle,direct,m,n,
+                                        X,0,    //The matrix is shifted 0 entries (will work on the entire matrix)
+                                        ldx,strideX,
+                                        perm,strideQ,
+                                        batch_count);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_slapmr(rocblas_handle handle, const rocblas_direct direct, const rocblas_int m,
+                 const rocblas_int n, float *X, const rocblas_int ldx, const rocblas_int *perm)
+{
+    return rocsolver_lapmr_impl<float>(handle, direct, m, n, X, ldx, perm);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dlapmr(rocblas_handle handle, const rocblas_direct direct, const rocblas_int m,
+                 const rocblas_int n, double *X, const rocblas_int ldx, const rocblas_int *perm)
+{
+    return rocsolver_lapmr_impl<double>(handle, direct, m, n, X, ldx, perm);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_clapmr(rocblas_handle handle, const rocblas_direct direct, const rocblas_int m,
+                 const rocblas_int n, rocblas_float_complex *X, const rocblas_int ldx, const rocblas_int *perm)
+{
+    return rocsolver_lapmr_impl<rocblas_float_complex>(handle, direct, m, n, X, ldx, perm);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zlapmr(rocblas_handle handle, const rocblas_direct direct, const rocblas_int m,
+                 const rocblas_int n, rocblas_double_complex *X, const rocblas_int ldx, const rocblas_int *perm)
+{
+    return rocsolver_lapmr_impl<rocblas_double_complex>(handle, direct, m, n, X, ldx, perm);
+}
+
+} //extern C
@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     June 2017
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCLAPACK_LAPMR_HPP
+#define ROCLAPACK_LAPMR_HPP
+
+#include <hip/hip_runtime.h>
+#include "rocblas.hpp"
+#include "rocsolver.h"
+#include "ideal_sizes.hpp"
+#include "common_device.hpp"
+#include "rocsolver_handle.hpp"
+
+// Final permutation perm (1-based, m entries) that results from applying the k interchanges
+// of ipiv to the identity, i.e. row i of P*A is row perm[i] of A. One block per matrix; the
+// interchanges depend on each other and are applied by a single thread.
+template <rocblas_int DIM>
+__global__ void ipiv2perm_kernel(const rocblas_int m, const rocblas_int k,
+                                 const rocblas_int *ipivA, const rocblas_int shiftP, const rocblas_stride strideP,
+                                 rocblas_int *permA, const rocblas_stride strideQ)
+{
+    int id = hipBlockIdx_x;
+    int tid = hipThreadIdx_x;
+
+    const rocblas_int *ipiv = ipivA + id*strideP + shiftP;
+    rocblas_int *perm = permA + id*strideQ;
+
+    for (rocblas_int i = tid; i < m; i += DIM)
+        perm[i] = i + 1;
+    __syncthreads();
+
+    if (tid == 0) {
+        for (rocblas_int i = 0; i < k; ++i) {
+            rocblas_int exch = ipiv[i] - 1;
+            if (exch != i) {
+                rocblas_int orig = perm[i];
+                perm[i] = perm[exch];
+                perm[exch] = orig;
+            }
+        }
+    }
+}
+
+// W = P*X, with W(i,:) = X(perm[i],:) if forward, or W(perm[i],:) = X(i,:) otherwise.
+// W is m-by-n with leading dimension m for each matrix of the batch. Each thread moves one entry,
+// so the whole permutation is applied in a single pass: W is written (forward) or X is read (backward)
+// contiguously, only the other side is indexed through perm.
+template <typename T, typename U>
+__global__ void lapmr_gather(const bool forward, const rocblas_int m, const rocblas_int n,
+                             U XX, const rocblas_int shiftX, const rocblas_int ldx, const rocblas_stride strideX,
+                             const rocblas_int *permA, const rocblas_stride strideQ, T *WW)
+{
+    int id = hipBlockIdx_z;
+    rocblas_int j = hipBlockIdx_y;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (i < m) {
+        T* X = load_ptr_batch<T>(XX,id,shiftX,strideX);
+        T* W = WW + size_t(id)*m*n;
+        rocblas_int p = permA[id*strideQ + i] - 1;
+
+        if (forward)
+            W[i + j*m] = X[p + j*ldx];
+        else
+            W[p + j*m] = X[i + j*ldx];
+    }
+}
+
+// X = W
+template <typename T, typename U>
+__global__ void lapmr_copy(const rocblas_int m, const rocblas_int n,
+                           U XX, const rocblas_int shiftX, const rocblas_int ldx, const rocblas_stride strideX,
+                           const T *WW)
+{
+    int id = hipBlockIdx_z;
+    rocblas_int j = hipBlockIdx_y;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (i < m) {
+        T* X = load_ptr_batch<T>(XX,id,shiftX,strideX);
+        X[i + j*ldx] = WW[size_t(id)*m*n + i + j*m];
+    }
+}
+
+
+template <typename T>
+void rocsolver_lapmr_getMemorySize(const rocblas_int m, const rocblas_int n, const rocblas_int batch_count, size_t *size)
+{
+    // permuted copy of the matrices
+    *size = rocsolver_workspace_size<T>(size_t(m)*n*batch_count);
+}
+
+inline rocblas_status rocsolver_ipiv2perm_template(rocblas_handle handle, const rocblas_int m, const rocblas_int k,
+                                                   const rocblas_int *ipiv, const rocblas_int shiftP, const rocblas_stride strideP,
+                                                   rocblas_int *perm, const rocblas_stride strideQ, const rocblas_int batch_count)
+{
+    // quick return
+    if (m == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    hipLaunchKernelGGL(ipiv2perm_kernel<LAPMR_BLOCKSIZE>,dim3(batch_count),dim3(LAPMR_BLOCKSIZE),0,stream,
+                       m,k,ipiv,shiftP,strideP,perm,strideQ);
+
+    return rocblas_status_success;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_lapmr_template(rocblas_handle handle, const rocblas_direct direct, const rocblas_int m, const rocblas_int n,
+                                        U X, const rocblas_int shiftX, const rocblas_int ldx, const rocblas_stride strideX,
+                                        const rocblas_int *perm, const rocblas_stride strideQ, const rocblas_int batch_count)
+{
+    // quick return
+    if (m == 0 || n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocsolver_workspace_frame frame(handle);
+    T *work = frame.alloc<T>(size_t(m)*n*batch_count);
+    if (!work)
+        return rocblas_status_memory_error;
+
+    rocblas_int blocks = (m - 1) / LAPMR_BLOCKSIZE + 1;
+    dim3 grid(blocks, n, batch_count);
+    dim3 threads(LAPMR_BLOCKSIZE, 1, 1);
+
+    hipLaunchKernelGGL(lapmr_gather<T>,grid,threads,0,stream,
+                       direct == rocblas_forward_direction,m,n,X,shiftX,ldx,strideX,perm,strideQ,work);
+    hipLaunchKernelGGL(lapmr_copy<T>,grid,threads,0,stream,
+                       m,n,X,shiftX,ldx,strideX,(const T*)work);
+
+    return rocblas_status_success;
+}
+
+#endif /* ROCLAPACK_LAPMR_HPP */
@@ -24,6 +24,15 @@ rocblas_status rocsolver_larf_impl(rocblas_handle handle, const rocblas_side sid
     rocblas_stride stridep = 0;
     rocblas_int batch_count=1;
 
+    // memory management
+    size_t size;
+    rocsolver_larf_getMemorySize<T>(side,m,n,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
     return rocsolver_larf_template<T>(handle,side, 
                                       m,n,
                                       x,0,    //vector shifted 0 entries
@@ -14,6 +14,23 @@
 #include "rocblas.hpp"
 #include "rocsolver.h"
 #include "common_device.hpp"
+#include "rocsolver_handle.hpp"
+
+template <typename T>
+void rocsolver_larf_getMemorySize(const rocblas_side side, const rocblas_int m, const rocblas_int n, 
+                                  const rocblas_int batch_count, size_t *size)
+{
+    // quick return
+    if (n == 0 || m == 0) {
+        *size = 0;
+        return;
+    }
+
+    // work + pointers to work for gemv and ger
+    rocblas_int order = (side == rocblas_side_left) ? n : m;
+    *size = rocsolver_workspace_size<T>(size_t(order)*batch_count);
+    *size += rocblasCall_strided_array_memsize<T>(batch_count);
+}
 
 template <typename T, typename U>
 rocblas_status rocsolver_larf_template(rocblas_handle handle, const rocblas_side side, const rocblas_int m,
@@ -29,14 +46,11 @@ rocblas_status rocsolver_larf_template(rocblas_handle handle, const rocblas_side
     rocblas_get_stream(handle, &stream);
 
     //constants to use when calling rocablas functions
-    T minone = -1;                //constant -1 in host
-    T* minoneInt;                 //constant -1 in device
-    hipMalloc(&minoneInt, sizeof(T));
-    hipMemcpy(minoneInt, &minone, sizeof(T), hipMemcpyHostToDevice);
-    T zero = 0;                 //constant 0 in host
-    T* zeroInt;                 //constant 0 in device
-    hipMalloc(&zeroInt, sizeof(T));
-    hipMemcpy(zeroInt, &zero, sizeof(T), hipMemcpyHostToDevice);
+    T* constants = rocsolver_constants<T>(handle);
+    if (!constants)
+        return rocblas_status_memory_error;
+    T* minoneInt = constants;     //constant -1 in device
+    T* zeroInt = constants + 1;   //constant 0 in device
     
     //determine side and order of H
     bool leftside = (side == rocblas_side_left);
@@ -47,10 +61,11 @@ rocblas_status rocsolver_larf_template(rocblas_handle handle, const rocblas_side
         order = n;
     }
     
-    // (TODO) THIS SHOULD BE DONE WITH THE HANDLE MEMORY ALLOCATOR
     //memory in GPU (workspace)
-    T *work;
-    hipMalloc(&work, sizeof(T)*order*batch_count);
+    rocsolver_workspace_frame frame(handle);
+    T *work = frame.alloc<T>(order*batch_count);
+    if (!work)
+        return rocblas_status_memory_error;
 
     // **** FOR NOW, IT DOES NOT DETERMINE "NON-ZERO" DIMENSIONS
     //      OF A AND X, AS THIS WOULD REQUIRE SYNCHRONIZATION WITH GPU.
@@ -71,10 +86,6 @@ rocblas_status rocsolver_larf_template(rocblas_handle handle, const rocblas_side
                              x, shiftx, incx, stridex, A, shiftA, lda, stridea, batch_count);
     }
 
-    hipFree(minoneInt);
-    hipFree(zeroInt);
-    hipFree(work);
-
     return rocblas_status_success;
 }
 
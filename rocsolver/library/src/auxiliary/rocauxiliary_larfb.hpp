@@ -13,7 +13,9 @@
 #include <hip/hip_runtime.h>
 #include "rocblas.hpp"
 #include "rocsolver.h"
+#include "ideal_sizes.hpp"
 #include "common_device.hpp"
+#include "rocsolver_handle.hpp"
 
 template <typename T, typename U>
 __global__ void copymatA1(const rocblas_int ldw, const rocblas_int order, U A, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA, T* work) 
@@ -53,6 +55,126 @@ __global__ void addmatA1(const rocblas_int ldw, const rocblas_int order, U A, co
     }
 }
 
+// Computes B = op(M)*B (left side) or B = B*op(M) (right side) in place, where M is
+// triangular. Each thread works on one column (left side) or row (right side) of B,
+// so that all the matrices of the batch are processed with a single launch.
+// If lds is true, each block first copies its M (k x k) to the dynamic shared memory.
+template <typename T, typename U>
+__global__ void larfb_trmm(const rocblas_side side, const rocblas_fill uplo, const rocblas_operation trans,
+                           const rocblas_diagonal diag, const rocblas_int m, const rocblas_int n, 
+                           U MM, const rocblas_int shiftM, const rocblas_int ldm, const rocblas_stride strideM,
+                           T* BB, const rocblas_int ldb, const rocblas_stride strideB, const bool lds)
+{
+    extern __shared__ double lmem[];
+
+    int b = hipBlockIdx_y;
+    int v = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    bool leftside = (side == rocblas_side_left);
+    rocblas_int k = leftside ? m : n;       //order of M
+    rocblas_int nv = leftside ? n : m;      //number of vectors
+
+    T* M = load_ptr_batch<T>(MM,b,shiftM,strideM);
+    rocblas_int ld = ldm;
+    if (lds) {
+        T* sM = reinterpret_cast<T*>(lmem);
+        for (rocblas_int t = hipThreadIdx_x; t < k*k; t += hipBlockDim_x)
+            sM[t] = M[t % k + (t / k)*ldm];
+        __syncthreads();
+        M = sM;
+        ld = k;
+    }
+
+    if (v < nv) {
+        T* x = BB + b*strideB + (leftside ? v*ldb : v);
+        rocblas_int inc = leftside ? 1 : ldb;
+
+        // x = op(M)*x for the left side, x = op(M)'*x for the right side
+        bool tr = (trans != rocblas_operation_none) != !leftside;
+        bool lower = (uplo == rocblas_fill_lower) != tr;
+        bool unit = (diag == rocblas_diagonal_unit);
+        T s;
+
+        // process x from the end (lower) or the beginning (upper) so that
+        // the entries still needed are not overwritten yet
+        for (rocblas_int ii = 0; ii < k; ++ii) {
+            rocblas_int i = lower ? k - 1 - ii : ii;
+            s = unit ? x[i*inc] : M[i + i*ld] * x[i*inc];
+            rocblas_int l0 = lower ? 0 : i + 1;
+            rocblas_int l1 = lower ? i : k;
+            for (rocblas_int l = l0; l < l1; ++l)
+                s += (tr ? M[l + i*ld] : M[i + l*ld]) * x[l*inc];
+            x[i*inc] = s;
+        }
+    }
+}
+
+// B = op(M)*B or B*op(M) for all the matrices of a batch given by an array of pointers:
+// there is no batched trmm in rocBLAS, so the kernel above is used
+template <typename T, typename U>
+rocblas_status larfb_trmm_batch(rocblas_handle handle, const rocblas_side side, const rocblas_fill uplo,
+                                const rocblas_operation trans, const rocblas_diagonal diag,
+                                const rocblas_int m, const rocblas_int n,
+                                U M, const rocblas_int shiftM, const rocblas_int ldm, const rocblas_stride strideM,
+                                T* B, const rocblas_int ldb, const rocblas_stride strideB,
+                                const rocblas_int batch_count, T* oneInt)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    bool leftside = (side == rocblas_side_left);
+    rocblas_int k = leftside ? m : n;
+    rocblas_int blocks = ((leftside ? n : m) - 1)/LARFB_BLOCKSIZE + 1;
+    size_t lmemsize = sizeof(T)*k*k;
+    bool lds = (lmemsize <= LARFB_TRMM_LDS);
+
+    hipLaunchKernelGGL(larfb_trmm<T>,dim3(blocks,batch_count),dim3(LARFB_BLOCKSIZE),lds ? lmemsize : 0,stream,
+                       side,uplo,trans,diag,m,n,M,shiftM,ldm,strideM,B,ldb,strideB,lds);
+
+    return rocblas_status_success;
+}
+
+// overload for a single M or a strided batch: a single matrix, or a batch of large
+// triangular factors, is multiplied by rocBLAS trmm (one call per matrix); the kernel
+// is only used for a batch of small factors, where it saves batch_count launches
+template <typename T>
+rocblas_status larfb_trmm_batch(rocblas_handle handle, const rocblas_side side, const rocblas_fill uplo,
+                                const rocblas_operation trans, const rocblas_diagonal diag,
+                                const rocblas_int m, const rocblas_int n,
+                                T* M, const rocblas_int shiftM, const rocblas_int ldm, const rocblas_stride strideM,
+                                T* B, const rocblas_int ldb, const rocblas_stride strideB,
+                                const rocblas_int batch_count, T* oneInt)
+{
+    rocblas_int k = (side == rocblas_side_left) ? m : n;
+    if (batch_count > 1 && k < LARFB_TRMM_SWITCHSIZE)
+        return larfb_trmm_batch<T,T*>(handle,side,uplo,trans,diag,m,n,M,shiftM,ldm,strideM,B,ldb,strideB,batch_count,oneInt);
+
+    rocblas_status status;
+    for (rocblas_int b = 0; b < batch_count; ++b) {
+        status = rocblas_trmm<T>(handle,side,uplo,trans,diag,m,n,oneInt,M + shiftM + b*strideM,ldm,B + b*strideB,ldb);
+        if (status != rocblas_status_success)
+            return status;
+    }
+
+    return rocblas_status_success;
+}
+
+template <typename T>
+void rocsolver_larfb_getMemorySize(const rocblas_side side, const rocblas_int m, const rocblas_int n, const rocblas_int k, 
+                                   const rocblas_int batch_count, size_t *size)
+{
+    // quick return
+    if (!m || !n) {
+        *size = 0;
+        return;
+    }
+
+    // work (ldw x order) + pointers to work for gemm
+    size_t sizeW = (side == rocblas_side_left) ? size_t(k)*n : size_t(m)*k;
+    *size = rocsolver_workspace_size<T>(sizeW*batch_count);
+    *size += rocblasCall_strided_array_memsize<T>(batch_count);
+}
+
 template <bool BATCHED, bool STRIDED, typename T, typename U>
 rocblas_status rocsolver_larfb_template(rocblas_handle handle, const rocblas_side side, 
                                         const rocblas_operation trans, const rocblas_direct direct, 
@@ -70,26 +192,13 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle, const rocblas_sid
 
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
-    T *Vp, *Fp;
 
     //constants to use when calling rocablas functions
-    T minone = -1;                //constant -1 in host
-    T* minoneInt;                 //constant -1 in device
-    hipMalloc(&minoneInt, sizeof(T));
-    hipMemcpy(minoneInt, &minone, sizeof(T), hipMemcpyHostToDevice);
-    T one = 1;                 //constant 1 in host
-    T* oneInt;                 //constant 1 in device
-    hipMalloc(&oneInt, sizeof(T));
-    hipMemcpy(oneInt, &one, sizeof(T), hipMemcpyHostToDevice);
-
-    // **** THIS SYNCHRONIZATION WILL BE REQUIRED UNTIL
-    //      TRMM_BATCH FUNCTIONALITY IS ENABLED. ****
-    #ifdef batched
-        T* VV[batch_count];
-        hipMemcpy(VV, V, batch_count*sizeof(T*), hipMemcpyDeviceToHost);
-    #else
-        T* VV = V;
-    #endif
+    T* constants = rocsolver_constants<T>(handle);
+    if (!constants)
+        return rocblas_status_memory_error;
+    T* minoneInt = constants;     //constant -1 in device
+    T* oneInt = constants + 2;    //constant 1 in device
 
     //determine the side, size of workspace
     //and whether V is trapezoidal
@@ -126,21 +235,19 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle, const rocblas_sid
             transp = rocblas_operation_transpose;
     }
 
-    // (TODO) THIS SHOULD BE DONE WITH THE HANDLE MEMORY ALLOCATOR
     //memory in GPU (workspace)
     rocblas_stride strideW = rocblas_stride(ldw)*order;
-    T *work;
-    hipMalloc(&work, sizeof(T)*strideW*batch_count);
-
+    rocsolver_workspace_frame frame(handle);
+    T *work = frame.alloc<T>(strideW*batch_count);
+    if (!work)
+        return rocblas_status_memory_error;
 
-    // **** TRMM_BATCH IS EXECUTED IN A FOR-LOOP UNTIL 
-    //      FUNCITONALITY IS ENABLED ****
 
     //copy A1 to work
     rocblas_int blocksx = (order - 1)/32 + 1;
     rocblas_int blocksy = (ldw - 1)/32 + 1;
     hipLaunchKernelGGL(copymatA1,dim3(blocksx,blocksy,batch_count),dim3(32,32),0,stream,ldw,order,A,shiftA,lda,strideA,work);
-    
+
     // BACKWARD DIRECTION TO BE IMPLEMENTED...
     rocblas_fill uploT = rocblas_fill_upper;
     if (direct == rocblas_backward_direction)
@@ -150,10 +257,11 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle, const rocblas_sid
     // V1' * A1, or
     //   or 
     // A1 * V1
-    for (int b=0;b<batch_count;++b) {
-        Vp = load_ptr_batch<T>(VV,b,shiftV,strideV);
-        rocblas_trmm(handle,side,uploV,transp,rocblas_diagonal_unit,ldw,order,oneInt,Vp,ldv,(work + b*strideW),ldw);
-    }
+    rocblas_status status;
+    status = larfb_trmm_batch<T>(handle,side,uploV,transp,rocblas_diagonal_unit,
+                                 ldw,order,V,shiftV,ldv,strideV,work,ldw,strideW,batch_count,oneInt);
+    if (status != rocblas_status_success)
+        return status;
 
     // compute:
     // V1' * A1 + V2' * A2 
@@ -179,10 +287,10 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle, const rocblas_sid
     // trans(T) * (V1' * A1 + V2' * A2)
     //              or
     // (A1 * V1 + A2 * V2) * trans(T)    
-    for (int b=0;b<batch_count;++b) {
-        Fp = load_ptr_batch<T>(F,b,shiftF,strideF);
-        rocblas_trmm(handle,side,uploT,trans,rocblas_diagonal_non_unit,ldw,order,oneInt,Fp,ldf,(work + b*strideW),ldw);
-    }
+    status = larfb_trmm_batch<T>(handle,side,uploT,trans,rocblas_diagonal_non_unit,
+                                 ldw,order,F,shiftF,ldf,strideF,work,ldw,strideW,batch_count,oneInt);
+    if (status != rocblas_status_success)
+        return status;
 
     // compute:
     // A2 - V2 * trans(T) * (V1' * A1 + V2' * A2)
@@ -213,20 +321,16 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle, const rocblas_sid
     // V1 * trans(T) * (V1' * A1 + V2' * A2)
     //              or
     // (A1 * V1 + A2 * V2) * trans(T) * V1'    
-    for (int b=0;b<batch_count;++b) {
-        Vp = load_ptr_batch<T>(VV,b,shiftV,strideV);
-        rocblas_trmm(handle,side,uploV,transp,rocblas_diagonal_unit,ldw,order,oneInt,Vp,ldv,(work + b*strideW),ldw);
-    }
+    status = larfb_trmm_batch<T>(handle,side,uploV,transp,rocblas_diagonal_unit,
+                                 ldw,order,V,shiftV,ldv,strideV,work,ldw,strideW,batch_count,oneInt);
+    if (status != rocblas_status_success)
+        return status;
     
     // compute:
     // A1 - V1 * trans(T) * (V1' * A1 + V2' * A2)
     //              or
     // A1 - (A1 * V1 + A2 * V2) * trans(T) * V1'
     hipLaunchKernelGGL(addmatA1,dim3(blocksx,blocksy,batch_count),dim3(32,32),0,stream,ldw,order,A,shiftA,lda,strideA,work);
-    
-    hipFree(minoneInt);
-    hipFree(oneInt);
-    hipFree(work);
 
     return rocblas_status_success;
 }
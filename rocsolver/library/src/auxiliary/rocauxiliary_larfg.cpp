@@ -20,6 +20,15 @@ rocblas_status rocsolver_larfg_impl(rocblas_handle handle, const rocblas_int n,
     rocblas_stride strideP = 0;
     rocblas_int batch_count=1;
 
+    // memory management
+    size_t size;
+    rocsolver_larfg_getMemorySize<T>(n,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
     return rocsolver_larfg_template<T>(handle,n,
                                         alpha,0,    //The pivot is the first pointed element
                                         x,0,        //the vector is shifted 0 entries,
@@ -13,7 +13,9 @@
 #include <hip/hip_runtime.h>
 #include "rocblas.hpp"
 #include "rocsolver.h"
+#include "ideal_sizes.hpp"
 #include "common_device.hpp"
+#include "rocsolver_handle.hpp"
 
 template <typename T, typename U>
 __global__ void set_taubeta(T *tau, const rocblas_stride strideP, T *norms, U alpha, const rocblas_int shifta, const rocblas_stride stride)
@@ -24,7 +26,9 @@ __global__ void set_taubeta(T *tau, const rocblas_stride strideP, T *norms, U al
     T* t = tau + b*strideP;
 
     if(norms[b] > 0) {
-        T n = T(sqrt(norms[b]*norms[b] + a[0]*a[0]));
+        // sqrt(norm^2 + alpha^2) without overflow or underflow
+        T m = max(norms[b], aabs(a[0]));
+        T n = m * T(sqrt((norms[b]/m)*(norms[b]/m) + (a[0]/m)*(a[0]/m)));
         n = a[0] > 0 ? -n : n;
 
         //scalling factor:
@@ -40,6 +44,13 @@ __global__ void set_taubeta(T *tau, const rocblas_stride strideP, T *norms, U al
 }
 
 
+template <typename T>
+void rocsolver_larfg_getMemorySize(const rocblas_int n, const rocblas_int batch_count, size_t *size)
+{
+    // norms
+    *size = (n > 1) ? rocsolver_workspace_size<T>(batch_count) : 0;
+}
+
 template <typename T, typename U>
 rocblas_status rocsolver_larfg_template(rocblas_handle handle, const rocblas_int n, U alpha, const rocblas_int shifta, 
                                         U x, const rocblas_int shiftx, const rocblas_int incx, const rocblas_stride stridex,
@@ -59,29 +70,15 @@ rocblas_status rocsolver_larfg_template(rocblas_handle handle, const rocblas_int
         return rocblas_status_success;    
     } 
 
-    // **** THIS SYNCHRONIZATION WILL BE REQUIRED UNTIL
-    //      NRM2_BATCH FUNCTIONALITY IS ENABLED. ****
-    #ifdef batched
-        T* xx[batch_count];
-        hipMemcpy(xx, x, batch_count*sizeof(T*), hipMemcpyDeviceToHost);
-    #else
-        T* xx = x;
-    #endif
-    T *xp;
-
-    // (TODO) THIS SHOULD BE DONE WITH THE HANDLE MEMORY ALLOCATOR
     //memory in GPU (workspace)
-    T *norms;
-    hipMalloc(&norms, sizeof(T)*batch_count);    
+    rocsolver_workspace_frame frame(handle);
+    T *norms = frame.alloc<T>(batch_count);
+    if (!norms)
+        return rocblas_status_memory_error;
 
-    // **** NRM2_BATCH IS EXECUTED IN A FOR-LOOP UNTIL 
-    //      FUNCITONALITY IS ENABLED ****
-    
     //compute norm of x
-    for (int b=0;b<batch_count;++b) {
-        xp = load_ptr_batch<T>(xx,b,shiftx,stridex);
-        rocblas_nrm2(handle, n - 1, xp, incx, (norms + b));
-    }
+    hipLaunchKernelGGL((nrm2_batched<LARFG_BLOCKSIZE,T>),dim3(batch_count),dim3(LARFG_BLOCKSIZE),0,stream,
+                       n-1,x,shiftx,incx,stridex,norms);
 
     //set value of tau and beta and scalling factor for vector x
     //alpha <- beta
@@ -91,8 +88,6 @@ rocblas_status rocsolver_larfg_template(rocblas_handle handle, const rocblas_int
     //compute vector v=x*norms
     rocblasCall_scal<T>(handle, n-1, norms, 1, x, shiftx, incx, stridex, batch_count);
 
-    hipFree(norms);
-
     return rocblas_status_success;
 }
 
@@ -29,6 +29,15 @@ rocblas_status rocsolver_larft_impl(rocblas_handle handle, const rocblas_direct
     rocblas_stride stridef = 0;
     rocblas_int batch_count=1;
 
+    // memory management
+    size_t size;
+    rocsolver_larft_getMemorySize<T>(n,k,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
     return rocsolver_larft_template<T>(handle,direct,storev,
                                       n,k,
                                       V,0,    //shifted 0 entries
@@ -14,6 +14,7 @@
 #include "rocblas.hpp"
 #include "rocsolver.h"
 #include "common_device.hpp"
+#include "rocsolver_handle.hpp"
 
 template <typename T, typename U>
 __global__ void set_triangular(const rocblas_int k, U V, const rocblas_int shiftV, const rocblas_int ldv, const rocblas_stride strideV, 
@@ -59,6 +60,13 @@ __global__ void set_tau(const rocblas_int k, T* tau, const rocblas_stride stride
 }
          
 
+template <typename T>
+void rocsolver_larft_getMemorySize(const rocblas_int n, const rocblas_int k, const rocblas_int batch_count, size_t *size)
+{
+    // work + pointers to F for gemv
+    *size = n ? rocsolver_workspace_size<T>(size_t(k)*batch_count) + rocblasCall_strided_array_memsize<T>(batch_count) : 0;
+}
+
 template <typename T, typename U>
 rocblas_status rocsolver_larft_template(rocblas_handle handle, const rocblas_direct direct, 
                                    const rocblas_storev storev, const rocblas_int n,
@@ -74,20 +82,18 @@ rocblas_status rocsolver_larft_template(rocblas_handle handle, const rocblas_dir
     rocblas_get_stream(handle, &stream);
 
     //constants to use when calling rocablas functions
-    T one = 1;                //constant 1 in host
-    T zero = 0;               //constant 0 in host
-    T* oneInt;                //constant 1 in device
-    T* zeroInt;               //constant 0 in device
-    hipMalloc(&oneInt, sizeof(T));
-    hipMemcpy(oneInt, &one, sizeof(T), hipMemcpyHostToDevice);
-    hipMalloc(&zeroInt, sizeof(T));
-    hipMemcpy(zeroInt, &zero, sizeof(T), hipMemcpyHostToDevice);
-
-    // (TODO) THIS SHOULD BE DONE WITH THE HANDLE MEMORY ALLOCATOR
+    T* constants = rocsolver_constants<T>(handle);
+    if (!constants)
+        return rocblas_status_memory_error;
+    T* oneInt = constants + 2;    //constant 1 in device
+    T* zeroInt = constants + 1;   //constant 0 in device
+
     //memory in GPU (workspace)
-    T *work;
     rocblas_stride stridew = k;
-    hipMalloc(&work, sizeof(T)*stridew*batch_count);
+    rocsolver_workspace_frame frame(handle);
+    T *work = frame.alloc<T>(stridew*batch_count);
+    if (!work)
+        return rocblas_status_memory_error;
 
     rocblas_diagonal diag = rocblas_diagonal_non_unit;
     rocblas_fill uplo;
@@ -138,9 +144,6 @@ rocblas_status rocsolver_larft_template(rocblas_handle handle, const rocblas_dir
     //restore tau
     hipLaunchKernelGGL(set_tau,dim3(batch_count,blocks),dim3(32,1),0,stream,k,tau,strideT);
 
-    hipFree(oneInt);
-    hipFree(zeroInt);
-    hipFree(work);   
  
     return rocblas_status_success;
 }
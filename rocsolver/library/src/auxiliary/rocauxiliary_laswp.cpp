@@ -23,6 +23,15 @@ rocblas_status rocsolver_laswp_impl(rocblas_handle handle, const rocblas_int n,
     rocblas_stride strideP = 0;
     rocblas_int batch_count=1;
 
+    // memory management
+    size_t size;
+    rocsolver_laswp_getMemorySize<T>(&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
     return rocsolver_laswp_template<T>(handle,n,
                                         A,0,    //The matrix is shifted 0 entries (will work on the entire matrix)
                                         lda,strideA,
@@ -15,39 +15,59 @@
 #include "rocsolver.h"
 #include "ideal_sizes.hpp"
 #include "common_device.hpp"
+#include "rocsolver_handle.hpp"
 
-template <typename T>
-__device__ void swap(const rocblas_int n, T *a, const rocblas_int lda,
-                               const rocblas_int i,
-                               const rocblas_int exch) {
-
-    int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-    if (tid < n) {
-        T orig = a[i + lda * tid];
-        a[i + lda * tid] = a[exch + lda * tid];
-        a[exch + lda * tid] = orig;
-    }
-}
-
-template <typename T, typename U>
+// Applies all the interchanges from start to end (with increment inc) in a single launch.
+// Each thread owns a column of the matrix and does the swaps on it sequentially; the 
+// pivot indices are staged DIM at a time in shared memory.
+template <rocblas_int DIM, typename T, typename U>
 __global__ void laswp_kernel(const rocblas_int n, U AA, const rocblas_int shiftA,
-                            const rocblas_int lda, const rocblas_stride stride, const rocblas_int i, const rocblas_int k1,
+                            const rocblas_int lda, const rocblas_stride stride, const rocblas_int k1,
+                            const rocblas_int start, const rocblas_int end, const rocblas_int inc,
                             const rocblas_int *ipivA, const rocblas_int shiftP, const rocblas_stride strideP, const rocblas_int incx) {
+    __shared__ rocblas_int sexch[DIM];
 
     int id = hipBlockIdx_y;
+    int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
 
     //shiftP must be used so that ipiv[k1] is the desired first index of ipiv
     const rocblas_int *ipiv = ipivA + id*strideP + shiftP;
-    rocblas_int exch = ipiv[k1 + (i - k1) * incx - 1];
-
-    //will exchange rows i and exch if they are not the same
-    if (exch != i) {
-        T* A = load_ptr_batch(AA,id,shiftA,stride);
-        swap(n,A,lda,i-1,exch-1);  //row indices are base-1 from the API
+    T* A = load_ptr_batch(AA,id,shiftA,stride);
+    rocblas_int count = (end - start) * inc;    //number of interchanges
+
+    for (rocblas_int c = 0; c < count; c += DIM) {
+        rocblas_int nc = min(DIM, count - c);
+        if (hipThreadIdx_x < nc) {
+            rocblas_int i = start + (c + hipThreadIdx_x) * inc;
+            sexch[hipThreadIdx_x] = ipiv[k1 + (i - k1) * incx - 1];
+        }
+        __syncthreads();
+
+        //will exchange rows i and exch if they are not the same
+        if (tid < n) {
+            for (rocblas_int k = 0; k < nc; ++k) {
+                rocblas_int i = start + (c + k) * inc;
+                rocblas_int exch = sexch[k];
+                if (exch != i) {
+                    //row indices are base-1 from the API
+                    T orig = A[i - 1 + lda * tid];
+                    A[i - 1 + lda * tid] = A[exch - 1 + lda * tid];
+                    A[exch - 1 + lda * tid] = orig;
+                }
+            }
+        }
+        __syncthreads();
     }
 }
 
 
+template <typename T>
+void rocsolver_laswp_getMemorySize(size_t *size)
+{
+    // no workspace needed
+    *size = 0;
+}
+
 template <typename T, typename U>
 rocblas_status rocsolver_laswp_template(rocblas_handle handle, const rocblas_int n, U A, const rocblas_int shiftA,
                               const rocblas_int lda, const rocblas_stride strideA, const rocblas_int k1, const rocblas_int k2,
@@ -77,10 +97,8 @@ rocblas_status rocsolver_laswp_template(rocblas_handle handle, const rocblas_int
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    for (rocblas_int i = start; i != end; i += inc) {
-        hipLaunchKernelGGL(laswp_kernel<T>, gridPivot, threads, 0, stream, n, A, shiftA,
-                           lda, strideA, i, k1, ipiv, shiftP, strideP, incx);
-    }
+    hipLaunchKernelGGL((laswp_kernel<LASWP_BLOCKSIZE,T>), gridPivot, threads, 0, stream, n, A, shiftA,
+                       lda, strideA, k1, start, end, inc, ipiv, shiftP, strideP, incx);
 
     return rocblas_status_success;
 
@@ -38,6 +38,12 @@ __global__ void init_ident_col(const rocblas_int m, const rocblas_int n, const r
     }
 }
 
+template <typename T>
+void rocsolver_org2r_getMemorySize(const rocblas_int m, const rocblas_int n, const rocblas_int batch_count, size_t *size)
+{
+    rocsolver_larf_getMemorySize<T>(rocblas_side_left,m,n,batch_count,size);
+}
+
 template <typename T, typename U>
 rocblas_status rocsolver_org2r_template(rocblas_handle handle, const rocblas_int m, 
                                    const rocblas_int n, const rocblas_int k, U A, const rocblas_int shiftA, 
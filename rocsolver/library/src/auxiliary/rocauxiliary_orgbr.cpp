@@ -28,6 +28,15 @@ rocblas_status rocsolver_orgbr_impl(rocblas_handle handle, const rocblas_storev
     rocblas_stride strideP = 0;
     rocblas_int batch_count=1;
 
+    // memory management
+    size_t size;
+    rocsolver_orgbr_getMemorySize<T>(storev,m,n,k,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
     return rocsolver_orgbr_template<false,false,T>(handle,storev,
                                                   m,n,k,
                                                   A,0,    //shifted 0 entries
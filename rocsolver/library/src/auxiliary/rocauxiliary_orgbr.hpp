@@ -15,6 +15,7 @@
 #include "rocsolver.h"
 #include "helpers.h"
 #include "common_device.hpp"
+#include "rocsolver_handle.hpp"
 #include "ideal_sizes.hpp"
 #include "../auxiliary/rocauxiliary_orgqr.hpp"
 #include "../auxiliary/rocauxiliary_orglq.hpp"
@@ -86,6 +87,35 @@ __global__ void copyshift_row(const bool copy, const rocblas_int dim, U A, const
     }
 }
 
+template <typename T>
+void rocsolver_orgbr_getMemorySize(const rocblas_storev storev, const rocblas_int m, const rocblas_int n, const rocblas_int k, 
+                                   const rocblas_int batch_count, size_t *size)
+{
+    // quick return
+    if (!n || !m) {
+        *size = 0;
+        return;
+    }
+
+    if (storev == rocblas_column_wise) {
+        if (m >= k) {
+            rocsolver_orgqr_getMemorySize<T>(m,n,k,batch_count,size);
+        } else {
+            // W + orgqr
+            rocsolver_orgqr_getMemorySize<T>(m-1,m-1,m-1,batch_count,size);
+            *size += rocsolver_workspace_size<T>(size_t(m-1)*m/2*batch_count);
+        }
+    } else {
+        if (n > k) {
+            rocsolver_orglq_getMemorySize<T>(m,n,k,batch_count,size);
+        } else {
+            // W + orglq
+            rocsolver_orglq_getMemorySize<T>(n-1,n-1,n-1,batch_count,size);
+            *size += rocsolver_workspace_size<T>(size_t(n-1)*n/2*batch_count);
+        }
+    }
+}
+
 template <bool BATCHED, bool STRIDED, typename T, typename U>
 rocblas_status rocsolver_orgbr_template(rocblas_handle handle, const rocblas_storev storev, const rocblas_int m, 
                                    const rocblas_int n, const rocblas_int k, U A, const rocblas_int shiftA, 
@@ -107,12 +137,13 @@ rocblas_status rocsolver_orgbr_template(rocblas_handle handle, const rocblas_sto
         } else {
             // shift the householder vectors provided by gebrd as they come below the first subdiagonal
             // workspace
-            // (TODO) THIS SHOULD BE DONE WITH THE HANDLE MEMORY ALLOCATOR
-            T *W;
             rocblas_stride strideW = rocblas_stride(m - 1)*m/2;  //number of elements to copy
             size_t sizeW = size_t(strideW)*batch_count;
             rocblas_int ldw = m - 1;
-            hipMalloc(&W, sizeof(T)*sizeW);
+            rocsolver_workspace_frame frame(handle);
+            T *W = frame.alloc<T>(sizeW);
+            if (!W)
+                return rocblas_status_memory_error;
             rocblas_int blocks = (m - 2)/BS + 1;
 
             // copy
@@ -125,8 +156,6 @@ rocblas_status rocsolver_orgbr_template(rocblas_handle handle, const rocblas_sto
             
             // result
             rocsolver_orgqr_template<BATCHED,STRIDED,T>(handle, m-1, m-1, m-1, A, shiftA + idx2D(1,1,lda), lda, strideA, ipiv, strideP, batch_count);    
-        
-            hipFree(W);
         }   
     }
     
@@ -138,12 +167,13 @@ rocblas_status rocsolver_orgbr_template(rocblas_handle handle, const rocblas_sto
         } else {
             // shift the householder vectors provided by gebrd as they come above the first superdiagonal
             // workspace
-            // (TODO) THIS SHOULD BE DONE WITH THE HANDLE MEMORY ALLOCATOR
-            T *W;
             rocblas_stride strideW = rocblas_stride(n - 1)*n/2;  //number of elements to copy
             size_t sizeW = size_t(strideW)*batch_count;
             rocblas_int ldw = n - 1;
-            hipMalloc(&W, sizeof(T)*sizeW);
+            rocsolver_workspace_frame frame(handle);
+            T *W = frame.alloc<T>(sizeW);
+            if (!W)
+                return rocblas_status_memory_error;
             rocblas_int blocks = (n - 2)/BS + 1;
 
             // copy
@@ -156,8 +186,6 @@ rocblas_status rocsolver_orgbr_template(rocblas_handle handle, const rocblas_sto
 
             // result
             rocsolver_orglq_template<BATCHED,STRIDED,T>(handle, n-1, n-1, n-1, A, shiftA + idx2D(1,1,lda), lda, strideA, ipiv, strideP, batch_count);
-                
-            hipFree(W);
         }
     }    
 
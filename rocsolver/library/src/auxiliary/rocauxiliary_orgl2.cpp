@@ -22,6 +22,15 @@ rocblas_status rocsolver_orgl2_impl(rocblas_handle handle, const rocblas_int m,
     rocblas_stride strideP = 0;
     rocblas_int batch_count=1;
 
+    // memory management
+    size_t size;
+    rocsolver_orgl2_getMemorySize<T>(m,n,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
     return rocsolver_orgl2_template<T>(handle,
                                       m,n,k,
                                       A,0,    //shifted 0 entries
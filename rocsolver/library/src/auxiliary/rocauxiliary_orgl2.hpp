@@ -39,6 +39,12 @@ __global__ void init_ident_row(const rocblas_int m, const rocblas_int n, const r
     }
 }
 
+template <typename T>
+void rocsolver_orgl2_getMemorySize(const rocblas_int m, const rocblas_int n, const rocblas_int batch_count, size_t *size)
+{
+    rocsolver_larf_getMemorySize<T>(rocblas_side_right,m,n,batch_count,size);
+}
+
 template <typename T, typename U>
 rocblas_status rocsolver_orgl2_template(rocblas_handle handle, const rocblas_int m, 
                                    const rocblas_int n, const rocblas_int k, U A, const rocblas_int shiftA, 
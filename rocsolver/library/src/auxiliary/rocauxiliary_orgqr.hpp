@@ -14,6 +14,7 @@
 #include "rocblas.hpp"
 #include "rocsolver.h"
 #include "common_device.hpp"
+#include "rocsolver_handle.hpp"
 #include "ideal_sizes.hpp"
 #include "../auxiliary/rocauxiliary_org2r.hpp"
 #include "../auxiliary/rocauxiliary_larfb.hpp"
@@ -36,6 +37,26 @@ __global__ void set_zero_col(const rocblas_int n, const rocblas_int kk, U A,
     }
 }
 
+template <typename T>
+void rocsolver_orgqr_getMemorySize(const rocblas_int m, const rocblas_int n, const rocblas_int k, 
+                                  const rocblas_int batch_count, size_t *size)
+{
+    rocsolver_org2r_getMemorySize<T>(m,n,batch_count,size);
+
+    // if the matrix is small, the unblocked variant is used
+    if (k <= GEQRF_GEQR2_SWITCHSIZE)
+        return;
+
+    // work + max(org2r, larft, larfb)
+    rocblas_int ldw = GEQRF_GEQR2_BLOCKSIZE;
+    size_t s;
+    rocsolver_larft_getMemorySize<T>(std::max(m,n),ldw,batch_count,&s);
+    *size = std::max(*size,s);
+    rocsolver_larfb_getMemorySize<T>(rocblas_side_left,m,n,ldw,batch_count,&s);
+    *size = std::max(*size,s);
+    *size += rocsolver_workspace_size<T>(size_t(ldw)*ldw*batch_count);
+}
+
 template <bool BATCHED, bool STRIDED, typename T, typename U>
 rocblas_status rocsolver_orgqr_template(rocblas_handle handle, const rocblas_int m, 
                                    const rocblas_int n, const rocblas_int k, U A, const rocblas_int shiftA, 
@@ -53,12 +74,13 @@ rocblas_status rocsolver_orgqr_template(rocblas_handle handle, const rocblas_int
     if (k <= GEQRF_GEQR2_SWITCHSIZE) 
         return rocsolver_org2r_template<T>(handle, m, n, k, A, shiftA, lda, strideA, ipiv, strideP, batch_count);
 
-    // (TODO) THIS SHOULD BE DONE WITH THE HANDLE MEMORY ALLOCATOR
     //memory in GPU (workspace)
-    T* work;
     rocblas_int ldw = GEQRF_GEQR2_BLOCKSIZE;
     rocblas_stride strideW = rocblas_stride(ldw) *ldw;
-    hipMalloc(&work, sizeof(T)*strideW*batch_count);
+    rocsolver_workspace_frame frame(handle);
+    T* work = frame.alloc<T>(strideW*batch_count);
+    if (!work)
+        return rocblas_status_memory_error;
 
     // start of first blocked block
     rocblas_int jb = GEQRF_GEQR2_BLOCKSIZE;
@@ -116,7 +138,6 @@ rocblas_status rocsolver_orgqr_template(rocblas_handle handle, const rocblas_int
         j -= jb;
     }
  
-    hipFree(work);
 
     return rocblas_status_success;
 }
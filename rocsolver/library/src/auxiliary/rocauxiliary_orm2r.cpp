@@ -28,6 +28,15 @@ rocblas_status rocsolver_orm2r_impl(rocblas_handle handle, const rocblas_side si
     rocblas_stride strideC = 0;
     rocblas_int batch_count=1;
 
+    // memory management
+    size_t size;
+    rocsolver_orm2r_getMemorySize<T>(side,m,n,k,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
     return rocsolver_orm2r_template<T>(handle,side,trans,
                                       m,n,k,
                                       A,0,    //shifted 0 entries
@@ -32,6 +32,15 @@ rocblas_status rocsolver_ormbr_impl(rocblas_handle handle, const rocblas_storev
     rocblas_int strideC = 0;
     rocblas_int batch_count=1;
 
+    // memory management
+    size_t size;
+    rocsolver_ormbr_getMemorySize<T>(storev,side,m,n,k,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
     return rocsolver_ormbr_template<false,false,T>(handle,storev,side,trans,
                                                   m,n,k,
                                                   A,0,    //shifted 0 entries
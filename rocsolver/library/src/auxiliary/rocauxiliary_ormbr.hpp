@@ -17,6 +17,23 @@
 #include "rocauxiliary_ormlq.hpp"
 #include "rocauxiliary_ormqr.hpp"
 
+template <typename T>
+void rocsolver_ormbr_getMemorySize(const rocblas_storev storev, const rocblas_side side, const rocblas_int m, const rocblas_int n, 
+                                   const rocblas_int k, const rocblas_int batch_count, size_t *size)
+{
+    // quick return
+    if (!n || !m || !k) {
+        *size = 0;
+        return;
+    }
+
+    // the shifted cases work on smaller matrices, so the size for m-by-n is an upper bound
+    if (storev == rocblas_column_wise)
+        rocsolver_ormqr_getMemorySize<T>(side,m,n,k,batch_count,size);
+    else
+        rocsolver_ormlq_getMemorySize<T>(side,m,n,k,batch_count,size);
+}
+
 template <bool BATCHED, bool STRIDED, typename T, typename U>
 rocblas_status rocsolver_ormbr_template(rocblas_handle handle, const rocblas_storev storev, const rocblas_side side, const rocblas_operation trans, 
                                    const rocblas_int m, const rocblas_int n, 
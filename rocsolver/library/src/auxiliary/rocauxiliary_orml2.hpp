@@ -14,8 +14,24 @@
 #include "rocblas.hpp"
 #include "rocsolver.h"
 #include "common_device.hpp"
+#include "rocsolver_handle.hpp"
 #include "../auxiliary/rocauxiliary_larf.hpp"
 
+template <typename T>
+void rocsolver_orml2_getMemorySize(const rocblas_side side, const rocblas_int m, const rocblas_int n, const rocblas_int k, 
+                                  const rocblas_int batch_count, size_t *size)
+{
+    // quick return
+    if (!n || !m || !k) {
+        *size = 0;
+        return;
+    }
+
+    // diag + larf
+    rocsolver_larf_getMemorySize<T>(side,m,n,batch_count,size);
+    *size += rocsolver_workspace_size<T>(batch_count);
+}
+
 template <typename T, typename U>
 rocblas_status rocsolver_orml2_template(rocblas_handle handle, const rocblas_side side, const rocblas_operation trans, 
                                    const rocblas_int m, const rocblas_int n, 
@@ -31,10 +47,11 @@ rocblas_status rocsolver_orml2_template(rocblas_handle handle, const rocblas_sid
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    // (TODO) THIS SHOULD BE DONE WITH THE HANDLE MEMORY ALLOCATOR
-    // memory in GPU (workspace)
-    T *diag;
-    hipMalloc(&diag,sizeof(T)*batch_count);
+    //memory in GPU (workspace)
+    rocsolver_workspace_frame frame(handle);
+    T *diag = frame.alloc<T>(batch_count);
+    if (!diag)
+        return rocblas_status_memory_error;
 
     // determine limits and indices
     bool left = (side == rocblas_side_left);
@@ -91,7 +108,6 @@ rocblas_status rocsolver_orml2_template(rocblas_handle handle, const rocblas_sid
         hipLaunchKernelGGL(restore_diag,dim3(batch_count,1,1),dim3(1,1,1),0,stream,diag,A,shiftA+idx2D(i,i,lda),strideA);
     }
 
-    hipFree(diag);
  
     return rocblas_status_success;
 }
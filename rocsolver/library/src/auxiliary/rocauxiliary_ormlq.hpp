@@ -14,10 +14,30 @@
 #include "rocblas.hpp"
 #include "rocsolver.h"
 #include "common_device.hpp"
+#include "rocsolver_handle.hpp"
 #include "../auxiliary/rocauxiliary_orml2.hpp"
 #include "../auxiliary/rocauxiliary_larfb.hpp"
 #include "../auxiliary/rocauxiliary_larft.hpp"
 
+template <typename T>
+void rocsolver_ormlq_getMemorySize(const rocblas_side side, const rocblas_int m, const rocblas_int n, const rocblas_int k, 
+                                  const rocblas_int batch_count, size_t *size)
+{
+    // if the matrix is small, the unblocked variant is used
+    if (k <= ORMLQ_ORML2_BLOCKSIZE) {
+        rocsolver_orml2_getMemorySize<T>(side,m,n,k,batch_count,size);
+        return;
+    }
+
+    // work + max(larft, larfb)
+    rocblas_int ldw = ORMLQ_ORML2_BLOCKSIZE;
+    size_t s;
+    rocsolver_larft_getMemorySize<T>(std::max(m,n),ldw,batch_count,size);
+    rocsolver_larfb_getMemorySize<T>(side,m,n,ldw,batch_count,&s);
+    *size = std::max(*size,s);
+    *size += rocsolver_workspace_size<T>(size_t(ldw)*ldw*batch_count);
+}
+
 template <bool BATCHED, bool STRIDED, typename T, typename U>
 rocblas_status rocsolver_ormlq_template(rocblas_handle handle, const rocblas_side side, const rocblas_operation trans, 
                                    const rocblas_int m, const rocblas_int n, 
@@ -37,12 +57,13 @@ rocblas_status rocsolver_ormlq_template(rocblas_handle handle, const rocblas_sid
     if (k <= ORMLQ_ORML2_BLOCKSIZE) 
         return rocsolver_orml2_template<T>(handle, side, trans, m, n, k, A, shiftA, lda, strideA, ipiv, strideP, C, shiftC, ldc, strideC, batch_count);
 
-    // (TODO) THIS SHOULD BE DONE WITH THE HANDLE MEMORY ALLOCATOR
     //memory in GPU (workspace)
-    T* work;
     rocblas_int ldw = ORMLQ_ORML2_BLOCKSIZE;
     rocblas_stride strideW = rocblas_stride(ldw) *ldw;
-    hipMalloc(&work, sizeof(T)*strideW*batch_count);    
+    rocsolver_workspace_frame frame(handle);
+    T* work = frame.alloc<T>(strideW*batch_count);
+    if (!work)
+        return rocblas_status_memory_error;
 
     // determine limits and indices
     bool left = (side == rocblas_side_left);
@@ -107,7 +128,6 @@ rocblas_status rocsolver_ormlq_template(rocblas_handle handle, const rocblas_sid
                                  batch_count);
     }
 
-    hipFree(work);
  
     return rocblas_status_success;
 }
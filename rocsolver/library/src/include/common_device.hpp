@@ -7,6 +7,7 @@
 
 #include <hip/hip_runtime.h>
 #include "../../../../rocblascommon/library/src/include/utility.h"
+#include "ideal_sizes.hpp"
 
 // **********************************************************
 // GPU kernels that are used by many rocsolver functions
@@ -40,6 +41,156 @@ __global__ void get_array(T** out, T* in, rocblas_stride stride, rocblas_int bat
         out[b] = in + b*stride;
 }
 
+template<typename T>
+__global__ void shift_array(T** out, T *const in[], const rocblas_int shift, const rocblas_int batch) 
+{
+    int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    
+    if (b < batch)
+        out[b] = in[b] + shift;
+}
+
+// Early exit: out[k] (k < *count) are the matrices of the batch whose info is still 0, and idx[k] their
+// positions in the batch (in any order). *count must be 0 on entry.
+template<typename T, typename U>
+__global__ void compact_batch(U A, const rocblas_stride strideA, const rocblas_int *info,
+                              T** out, rocblas_int *idx, rocblas_int *count, const rocblas_int batch)
+{
+    int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (b < batch && info[b] == 0) {
+        rocblas_int k = atomicAdd(count, 1);
+        out[k] = load_ptr_batch<T>(A,b,0,strideA);
+        idx[k] = b;
+    }
+}
+
+// Launches compact_batch and returns the number of healthy matrices (this synchronizes the stream).
+// count is a device scalar.
+template<typename T, typename U>
+rocblas_int rocsolver_compact_batch(hipStream_t stream, U A, const rocblas_stride strideA, const rocblas_int *info,
+                                    T** out, rocblas_int *idx, rocblas_int *count, const rocblas_int batch)
+{
+    rocblas_int blocks = (batch - 1) / BLOCKSIZE + 1;
+    rocblas_int h;
+    hipLaunchKernelGGL(reset_info,dim3(1),dim3(1),0,stream,count,1,0);
+    hipLaunchKernelGGL(compact_batch<T>,dim3(blocks),dim3(BLOCKSIZE),0,stream,A,strideA,info,out,idx,count,batch);
+    hipMemcpyAsync(&h, count, sizeof(rocblas_int), hipMemcpyDeviceToHost, stream);
+    hipStreamSynchronize(stream);
+    return h;
+}
+
+// absolute value as used by iamax (|real part| + |imaginary part| for complex numbers)
+template <typename T>
+__device__ __host__ inline auto aabs(T x)
+{
+    return rocblas_abs(std::real(x)) + rocblas_abs(std::imag(x));
+}
+
+// iamax computed by a block of DIM threads. sval and sidx are DIM entries of shared memory.
+// Returns (to all the threads) the 0-based index of the first entry with maximum absolute value
+template <rocblas_int DIM, typename T, typename S>
+__device__ rocblas_int block_iamax(const rocblas_int n, const T* x, const rocblas_int incx,
+                                   S *sval, rocblas_int *sidx)
+{
+    int tid = hipThreadIdx_x;
+
+    // each thread finds the maximum of its entries
+    S val = -1;
+    rocblas_int idx = 0;
+    for (rocblas_int i = tid; i < n; i += DIM) {
+        S a = aabs(x[i*incx]);
+        if (a > val) {
+            val = a;
+            idx = i;
+        }
+    }
+    sval[tid] = val;
+    sidx[tid] = idx;
+    __syncthreads();
+
+    // reduction (ties are resolved in favor of the smallest index)
+    for (rocblas_int r = DIM/2; r > 0; r /= 2) {
+        if (tid < r) {
+            S a = sval[tid + r];
+            rocblas_int ia = sidx[tid + r];
+            if (a > sval[tid] || (a == sval[tid] && ia < sidx[tid])) {
+                sval[tid] = a;
+                sidx[tid] = ia;
+            }
+        }
+        __syncthreads();
+    }
+
+    return sidx[0];
+}
+
+// array of pointers to the matrices of a batch. The entries of the matrices that failed
+// (info != 0) point to the scratch matrix instead, so that they are not modified
+template <typename T, typename U>
+__global__ void mask_pointers(U AA, const rocblas_int shiftA, const rocblas_stride strideA, const rocblas_int* info,
+                              T* scratch, T** out, const rocblas_int batch_count)
+{
+    int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (b < batch_count)
+        out[b] = info[b] ? scratch : load_ptr_batch<T>(AA,b,shiftA,strideA);
+}
+
+// batched version of nrm2 for real precisions. Each block of DIM threads works on one vector.
+// As in the nrm2 of LAPACK, the squares are taken of the entries divided by the largest one, so that
+// the norm neither overflows nor underflows when the entries are very large or very small
+template <rocblas_int DIM, typename T, typename U>
+__global__ void nrm2_batched(const rocblas_int n, U xx, const rocblas_int shiftx, const rocblas_int incx,
+                             const rocblas_stride stridex, T *result)
+{
+    __shared__ T sval[DIM];
+
+    int b = hipBlockIdx_x;
+    int tid = hipThreadIdx_x;
+    T* x = load_ptr_batch<T>(xx,b,shiftx,stridex);
+
+    // largest absolute value
+    T val = 0;
+    for (rocblas_int i = tid; i < n; i += DIM)
+        val = max(val, aabs(x[i*incx]));
+    sval[tid] = val;
+    __syncthreads();
+
+    for (rocblas_int r = DIM/2; r > 0; r /= 2) {
+        if (tid < r)
+            sval[tid] = max(sval[tid], sval[tid + r]);
+        __syncthreads();
+    }
+
+    T scale = sval[0];
+    __syncthreads();
+    if (scale == 0 || isinf(scale)) {
+        if (tid == 0)
+            result[b] = scale;
+        return;
+    }
+
+    // each thread adds the squares of its scaled entries
+    val = 0;
+    for (rocblas_int i = tid; i < n; i += DIM) {
+        T t = x[i*incx] / scale;
+        val += t * t;
+    }
+    sval[tid] = val;
+    __syncthreads();
+
+    // reduction
+    for (rocblas_int r = DIM/2; r > 0; r /= 2) {
+        if (tid < r)
+            sval[tid] += sval[tid + r];
+        __syncthreads();
+    }
+
+    if (tid == 0)
+        result[b] = scale * sqrt(sval[0]);
+}
+
 template <typename T, typename U>
 __global__ void setdiag(const rocblas_int j, U A, 
                         const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
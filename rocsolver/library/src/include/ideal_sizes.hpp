@@ -11,11 +11,44 @@
 // MORE SUITABLE VALUES  
 #define BLOCKSIZE 256
 #define LASWP_BLOCKSIZE 256
+#define LAPMR_BLOCKSIZE 256
 #define GETF2_BLOCKSIZE 256
+#define GETF2_SMALL_SIZE 64
+#define GETF2_SMALL_LDS 32768
+#define LARFG_BLOCKSIZE 256
+#define LARFB_BLOCKSIZE 256
+#define LARFB_TRMM_LDS 32768
+#define LARFB_TRMM_SWITCHSIZE 128
 #define ORMQR_ORM2R_BLOCKSIZE 32
 #define ORMLQ_ORML2_BLOCKSIZE 32
 #define GETRF_GETF2_SWITCHSIZE 64
+#define GETRF_RECURSIVE_BASESIZE 16
+#define GETRF_RECURSIVE_MINROWS 512
+#define GETRF_TOURNAMENT_ROWS 256
+#define GETRF_TOURNAMENT_MINROWS 1024
+#define GETRF_TOURNAMENT_BLOCKS 256
+#define GBTRF_BLOCKSIZE 64
+#define GBTRS_BLOCKSIZE 64
 #define POTRF_POTF2_SWITCHSIZE 64
+#define POTRF_RECURSIVE_MINSIZE 1024
+#define POTRF_LEFTLOOKING_MINBATCH 2
+#define EARLY_EXIT_INTERVAL 4
+#define POTF2_SMALL_SIZE 64
+#define POTF2_SMALL_LDS 32768
+#define PPTRF_BLOCKSIZE 32
+#define PPTRS_BLOCKSIZE 256
+#define PBTRF_BLOCKSIZE 64
+#define PBTRS_BLOCKSIZE 64
+#define GETRS_SMALL_SIZE 64
+#define GETRS_SMALL_NRHS 8
+#define GETRS_SMALL_LDS 32768
+#define GETRI_SMALL_SIZE 64
+#define GETRI_SMALL_LDS 32768
+#define GETRI_BLOCKSIZE 64
+#define GESV_MIXED_ITERMAX 30
+#define GESV_NORM_COLS 64
+#define CON_BLOCKSIZE 256
+#define CON_ITMAX 5
 #define GEQRF_GEQR2_SWITCHSIZE 128
 #define GEQRF_GEQR2_BLOCKSIZE 64
 
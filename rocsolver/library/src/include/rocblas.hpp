@@ -10,6 +10,33 @@
 #include "helpers.h"
 #include "ideal_sizes.hpp"
 #include "common_device.hpp"
+#include "rocsolver_handle.hpp"
+
+// array of pointers to the batch_count matrices/vectors of the strided argument x.
+// It is taken from the given workspace frame and filled by a single small kernel.
+template <typename T>
+T** rocsolver_strided_array(rocblas_handle handle, rocsolver_workspace_frame& frame, T* x, rocblas_stride stridex, 
+                            rocblas_int batch_count)
+{
+    T **array = frame.alloc<T*>(batch_count);
+
+    if (array) {
+        hipStream_t stream;
+        rocblas_get_stream(handle, &stream);
+        rocblas_int blocks =  (batch_count - 1)/256 + 1;
+        hipLaunchKernelGGL(get_array,dim3(blocks),dim3(256),0,stream,array,x,stridex,batch_count);
+    }
+
+    return array;
+}
+
+// workspace (in bytes) needed by the overloads of ger, gemv and gemm that mix
+// batched and strided arguments
+template <typename T>
+size_t rocblasCall_strided_array_memsize(rocblas_int batch_count)
+{
+    return rocsolver_workspace_size<T*>(batch_count);
+}
 
 // scal
 template <typename T, typename U, typename V>
@@ -93,21 +120,13 @@ rocblas_status rocblasCall_ger(rocblas_handle handle,
                            rocblas_stride strideA,
                            rocblas_int    batch_count)
 {
-    hipStream_t stream;
-    rocblas_get_stream(handle, &stream);
+    rocsolver_workspace_frame frame(handle);
+    T **work = rocsolver_strided_array<T>(handle,frame,y,stridey,batch_count);
+    if (!work)
+        return rocblas_status_memory_error;
 
-    T **work;
-    hipMalloc(&work, sizeof(T*) * batch_count);
-    rocblas_int blocks =  (batch_count - 1)/256 + 1;
-    hipLaunchKernelGGL(get_array,dim3(blocks),dim3(256),0,stream,work,y,stridey,batch_count);
- 
-    rocblas_status status;
-
-    status = rocblas_ger_template<CONJ,T>(handle,m,n,alpha,stridea,cast2constType<T>(x),offsetx,incx,stridex,
-                                          cast2constType<T>(work),offsety,incy,stridey,A,offsetA,lda,strideA,batch_count);
-    
-    hipFree(work);
-    return status;
+    return rocblas_ger_template<CONJ,T>(handle,m,n,alpha,stridea,cast2constType<T>(x),offsetx,incx,stridex,
+                                        cast2constType<T>(work),offsety,incy,stridey,A,offsetA,lda,strideA,batch_count);
 }
 
 // ger overload
@@ -131,21 +150,13 @@ rocblas_status rocblasCall_ger(rocblas_handle handle,
                            rocblas_stride strideA,
                            rocblas_int    batch_count)
 {
-    hipStream_t stream;
-    rocblas_get_stream(handle, &stream);
+    rocsolver_workspace_frame frame(handle);
+    T **work = rocsolver_strided_array<T>(handle,frame,x,stridex,batch_count);
+    if (!work)
+        return rocblas_status_memory_error;
 
-    T **work;
-    hipMalloc(&work, sizeof(T*) * batch_count);
-    rocblas_int blocks =  (batch_count - 1)/256 + 1;
-    hipLaunchKernelGGL(get_array,dim3(blocks),dim3(256),0,stream,work,x,stridex,batch_count);
- 
-    rocblas_status status;
-
-    status = rocblas_ger_template<CONJ,T>(handle,m,n,alpha,stridea,cast2constType<T>(work),offsetx,incx,stridex,
-                                          cast2constType<T>(y),offsety,incy,stridey,A,offsetA,lda,strideA,batch_count);
-    
-    hipFree(work);
-    return status;
+    return rocblas_ger_template<CONJ,T>(handle,m,n,alpha,stridea,cast2constType<T>(work),offsetx,incx,stridex,
+                                        cast2constType<T>(y),offsety,incy,stridey,A,offsetA,lda,strideA,batch_count);
 }
 
 // gemv
@@ -203,22 +214,15 @@ rocblas_status rocblasCall_gemv(rocblas_handle    handle,
                             rocblas_stride    stridey,
                             rocblas_int       batch_count)
 {
-    hipStream_t stream;
-    rocblas_get_stream(handle, &stream);
+    rocsolver_workspace_frame frame(handle);
+    T **work = rocsolver_strided_array<T>(handle,frame,y,stridey,batch_count);
+    if (!work)
+        return rocblas_status_memory_error;
 
-    T **work;
-    hipMalloc(&work, sizeof(T*) * batch_count);
-    rocblas_int blocks =  (batch_count - 1)/256 + 1;
-    hipLaunchKernelGGL(get_array,dim3(blocks),dim3(256),0,stream,work,y,stridey,batch_count);
- 
-    rocblas_status status;
-    status = rocblas_gemv_template<T>(handle,transA,m,n,alpha,stride_alpha,
-                                      cast2constType<T>(A),offseta,lda,strideA,
-                                      cast2constType<T>(x),offsetx,incx,stridex,beta,stride_beta,
-                                      cast2constPointer<T>(work),offsety,incy,stridey,batch_count);
-
-    hipFree(work);
-    return status;
+    return rocblas_gemv_template<T>(handle,transA,m,n,alpha,stride_alpha,
+                                    cast2constType<T>(A),offseta,lda,strideA,
+                                    cast2constType<T>(x),offsetx,incx,stridex,beta,stride_beta,
+                                    cast2constPointer<T>(work),offsety,incy,stridey,batch_count);
 }
 
 // trmv
@@ -298,22 +302,15 @@ rocblas_status rocblasCall_gemm(rocblas_handle    handle,
                             rocblas_stride    stride_c,
                             rocblas_int       batch_count)
 {
-    hipStream_t stream;
-    rocblas_get_stream(handle, &stream);
+    rocsolver_workspace_frame frame(handle);
+    T **work = rocsolver_strided_array<T>(handle,frame,A,stride_a,batch_count);
+    if (!work)
+        return rocblas_status_memory_error;
 
-    T **work;
-    hipMalloc(&work, sizeof(T*) * batch_count);
-    rocblas_int blocks =  (batch_count - 1)/256 + 1;
-    hipLaunchKernelGGL(get_array,dim3(blocks),dim3(256),0,stream,work,A,stride_a,batch_count);
- 
-    rocblas_status status;
-    status = rocblas_gemm_template<BATCHED,STRIDED,T>(handle,trans_a,trans_b,m,n,k,alpha,
-                                                      cast2constType<T>(work),offset_a,ld_a,stride_a,
-                                                      cast2constType<T>(B),offset_b,ld_b,stride_b,beta,
-                                                      C,offset_c,ld_c,stride_c,batch_count);
-
-    hipFree(work);
-    return status;
+    return rocblas_gemm_template<BATCHED,STRIDED,T>(handle,trans_a,trans_b,m,n,k,alpha,
+                                                    cast2constType<T>(work),offset_a,ld_a,stride_a,
+                                                    cast2constType<T>(B),offset_b,ld_b,stride_b,beta,
+                                                    C,offset_c,ld_c,stride_c,batch_count);
 }
 
 //gemm overload
@@ -340,23 +337,15 @@ rocblas_status rocblasCall_gemm(rocblas_handle    handle,
                             rocblas_stride    stride_c,
                             rocblas_int       batch_count)
 {
-    hipStream_t stream;
-    rocblas_get_stream(handle, &stream);
-
-    T **work;
-    hipMalloc(&work, sizeof(T*) * batch_count);
-    rocblas_int blocks =  (batch_count - 1)/256 + 1;
-    hipLaunchKernelGGL(get_array,dim3(blocks),dim3(256),0,stream,work,B,stride_b,batch_count);
- 
-    rocblas_status status;
-    status = rocblas_gemm_template<BATCHED,STRIDED,T>(handle,trans_a,trans_b,m,n,k,alpha,
-                                                      cast2constType<T>(A),offset_a,ld_a,stride_a,
-                                                      cast2constType<T>(work),offset_b,ld_b,stride_b,beta,
-                                                      C,offset_c,ld_c,stride_c,batch_count);
-
-    hipFree(work);
-    return status;
+    rocsolver_workspace_frame frame(handle);
+    T **work = rocsolver_strided_array<T>(handle,frame,B,stride_b,batch_count);
+    if (!work)
+        return rocblas_status_memory_error;
 
+    return rocblas_gemm_template<BATCHED,STRIDED,T>(handle,trans_a,trans_b,m,n,k,alpha,
+                                                    cast2constType<T>(A),offset_a,ld_a,stride_a,
+                                                    cast2constType<T>(work),offset_b,ld_b,stride_b,beta,
+                                                    C,offset_c,ld_c,stride_c,batch_count);
 }
 
 //gemm overload
@@ -383,23 +372,15 @@ rocblas_status rocblasCall_gemm(rocblas_handle    handle,
                             rocblas_stride    stride_c,
                             rocblas_int       batch_count)
 {
-    hipStream_t stream;
-    rocblas_get_stream(handle, &stream);
-
-    T **work;
-    hipMalloc(&work, sizeof(T*) * batch_count);
-    rocblas_int blocks =  (batch_count - 1)/256 + 1;
-    hipLaunchKernelGGL(get_array,dim3(blocks),dim3(256),0,stream,work,C,stride_c,batch_count);
- 
-    rocblas_status status;
-    status = rocblas_gemm_template<BATCHED,STRIDED,T>(handle,trans_a,trans_b,m,n,k,alpha,
-                                                      cast2constType<T>(A),offset_a,ld_a,stride_a,
-                                                      cast2constType<T>(B),offset_b,ld_b,stride_b,beta,
-                                                      work,offset_c,ld_c,stride_c,batch_count);
-
-    hipFree(work);
-    return status;
+    rocsolver_workspace_frame frame(handle);
+    T **work = rocsolver_strided_array<T>(handle,frame,C,stride_c,batch_count);
+    if (!work)
+        return rocblas_status_memory_error;
 
+    return rocblas_gemm_template<BATCHED,STRIDED,T>(handle,trans_a,trans_b,m,n,k,alpha,
+                                                    cast2constType<T>(A),offset_a,ld_a,stride_a,
+                                                    cast2constType<T>(B),offset_b,ld_b,stride_b,beta,
+                                                    work,offset_c,ld_c,stride_c,batch_count);
 }
 
 // syrk
@@ -432,110 +413,154 @@ rocblas_status rocblasCall_syrk(rocblas_handle    handle,
 // ROCBLAS TEMPLATE FUNCTIONS ONCE THEY ARE EXPORTED
 // ROCBLAS.CPP CAN BE ELIMINATED THEN
 
- 
-// nrm2
-template <typename T1, typename T2>
-rocblas_status rocblas_nrm2(rocblas_handle handle, rocblas_int n, const T1 *x,
-                            rocblas_int incx, T2 *result);
-/*template <>
-rocblas_status rocblas_nrm2(rocblas_handle handle, rocblas_int n,
-                            const float* x, const rocblas_int incx, float* result) {
-  return rocblas_snrm2(handle, n, x, incx, result);
-}
-template <>
-rocblas_status rocblas_nrm2(rocblas_handle handle, rocblas_int n,
-                            const double* x, const rocblas_int incx, double* result) {
-  return rocblas_dnrm2(handle, n, x, incx, result);
-}*/
-
-// iamax
-template <typename T>
-rocblas_status rocblas_iamax(rocblas_handle handle, rocblas_int n, const T *x,
-                             rocblas_int incx, rocblas_int *result);
-/*template <>
-rocblas_status rocblas_iamax(rocblas_handle handle, rocblas_int n,
-                             const float *x, rocblas_int incx,
-                             rocblas_int *result) {
-  return rocblas_isamax(handle, n, x, incx, result);
-}
-template <>
-rocblas_status rocblas_iamax(rocblas_handle handle, rocblas_int n,
-                             const double *x, rocblas_int incx,
-                             rocblas_int *result) {
-  return rocblas_idamax(handle, n, x, incx, result);
-}
-template <>
-rocblas_status rocblas_iamax(rocblas_handle handle, rocblas_int n,
-                             const rocblas_float_complex *x, rocblas_int incx,
-                             rocblas_int *result) {
-  return rocblas_icamax(handle, n, x, incx, result);
-}
-template <>
-rocblas_status rocblas_iamax(rocblas_handle handle, rocblas_int n,
-                             const rocblas_double_complex *x, rocblas_int incx,
-                             rocblas_int *result) {
-  return rocblas_izamax(handle, n, x, incx, result);
-}*/
-
-// trsm
+// trsm_batched
 template <typename T>
-rocblas_status rocblas_trsm(rocblas_handle handle, rocblas_side side,
-                            rocblas_fill uplo, rocblas_operation transA,
-                            rocblas_diagonal diag, rocblas_int m, rocblas_int n,
-                            const T *alpha, T *A, rocblas_int lda, T *B,
-                            rocblas_int ldb);
-/*template <>
-rocblas_status rocblas_trsm(rocblas_handle handle, rocblas_side side,
-                            rocblas_fill uplo, rocblas_operation transA,
-                            rocblas_diagonal diag, rocblas_int m, rocblas_int n,
-                            const float *alpha, float *A, rocblas_int lda,
-                            float *B, rocblas_int ldb) {
-  return rocblas_strsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B,ldb);
-}
-template <>
-rocblas_status rocblas_trsm(rocblas_handle handle, rocblas_side side,
-                            rocblas_fill uplo, rocblas_operation transA,
-                            rocblas_diagonal diag, rocblas_int m, rocblas_int n,
-                            const double *alpha, double *A, rocblas_int lda,
-                            double *B, rocblas_int ldb) {
-  return rocblas_dtrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B,ldb);
-}
-template <>
-rocblas_status rocblas_trsm(rocblas_handle handle, rocblas_side side,
+rocblas_status rocblas_trsm_batched(rocblas_handle handle, rocblas_side side,
                             rocblas_fill uplo, rocblas_operation transA,
                             rocblas_diagonal diag, rocblas_int m, rocblas_int n,
-                            const rocblas_float_complex *alpha, rocblas_float_complex *A, rocblas_int lda,
-                            rocblas_float_complex *B, rocblas_int ldb) {
-    return rocblas_ctrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
-}
-template <>
-rocblas_status rocblas_trsm(rocblas_handle handle, rocblas_side side,
+                            const T *alpha, const T *const A[], rocblas_int lda, 
+                            T *const B[], rocblas_int ldb, rocblas_int batch_count);
+
+// trsm_strided_batched
+template <typename T>
+rocblas_status rocblas_trsm_strided_batched(rocblas_handle handle, rocblas_side side,
                             rocblas_fill uplo, rocblas_operation transA,
                             rocblas_diagonal diag, rocblas_int m, rocblas_int n,
-                            const rocblas_double_complex *alpha, rocblas_double_complex *A, rocblas_int lda,
-                            rocblas_double_complex *B, rocblas_int ldb) {
-    return rocblas_ztrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
-}*/
+                            const T *alpha, const T *A, rocblas_int lda, rocblas_stride strideA, 
+                            T *B, rocblas_int ldb, rocblas_stride strideB, rocblas_int batch_count);
 
 // trmm
 template <typename T>
 rocblas_status rocblas_trmm(rocblas_handle handle, rocblas_side side, rocblas_fill uplo,
                             rocblas_operation trans, rocblas_diagonal diag, rocblas_int m, rocblas_int n,
-                            T *alpha, T *A, rocblas_int lda, T* B, rocblas_int ldb);
-/*template <>
-rocblas_status rocblas_trmm(rocblas_handle handle, rocblas_side side, rocblas_fill uplo,
-                            rocblas_operation trans, rocblas_diagonal diag, rocblas_int m, rocblas_int n,
-                            float *alpha, float *A, rocblas_int lda, float* B, rocblas_int ldb)
+                            const T *alpha, const T *A, rocblas_int lda, T* B, rocblas_int ldb);
+
+// trsm
+template <typename T>
+rocblas_status rocblasCall_trsm(rocblas_handle    handle,
+                            rocblas_side      side,
+                            rocblas_fill      uplo,
+                            rocblas_operation transA,
+                            rocblas_diagonal  diag,
+                            rocblas_int       m,
+                            rocblas_int       n,
+                            const T*          alpha,
+                            T*                A,
+                            rocblas_int       offsetA,
+                            rocblas_int       lda,
+                            rocblas_stride    strideA,
+                            T*                B,
+                            rocblas_int       offsetB,
+                            rocblas_int       ldb,
+                            rocblas_stride    strideB,
+                            rocblas_int       batch_count)
 {
-    return rocblas_strmm(handle,side,uplo,trans,diag,m,n,alpha,A,lda,B,ldb);
+    return rocblas_trsm_strided_batched<T>(handle,side,uplo,transA,diag,m,n,alpha,
+                                           A + offsetA,lda,strideA,B + offsetB,ldb,strideB,batch_count);
 }
-template <>
-rocblas_status rocblas_trmm(rocblas_handle handle, rocblas_side side, rocblas_fill uplo,
-                            rocblas_operation trans, rocblas_diagonal diag, rocblas_int m, rocblas_int n,
-                            double *alpha, double *A, rocblas_int lda, double* B, rocblas_int ldb)
+
+// trsm overload
+template <typename T>
+rocblas_status rocblasCall_trsm(rocblas_handle    handle,
+                            rocblas_side      side,
+                            rocblas_fill      uplo,
+                            rocblas_operation transA,
+                            rocblas_diagonal  diag,
+                            rocblas_int       m,
+                            rocblas_int       n,
+                            const T*          alpha,
+                            T *const          A[],
+                            rocblas_int       offsetA,
+                            rocblas_int       lda,
+                            rocblas_stride    strideA,
+                            T *const          B[],
+                            rocblas_int       offsetB,
+                            rocblas_int       ldb,
+                            rocblas_stride    strideB,
+                            rocblas_int       batch_count)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // the batched API has no offsets; the shifted pointers are built on the device
+    rocsolver_workspace_frame frame(handle);
+    T **workA = frame.alloc<T*>(batch_count);
+    T **workB = frame.alloc<T*>(batch_count);
+    if (!workA || !workB)
+        return rocblas_status_memory_error;
+    rocblas_int blocks =  (batch_count - 1)/256 + 1;
+    hipLaunchKernelGGL(shift_array,dim3(blocks),dim3(256),0,stream,workA,A,offsetA,batch_count);
+    hipLaunchKernelGGL(shift_array,dim3(blocks),dim3(256),0,stream,workB,B,offsetB,batch_count);
+
+    return rocblas_trsm_batched<T>(handle,side,uplo,transA,diag,m,n,alpha,
+                                   cast2constType<T>(workA),lda,workB,ldb,batch_count);
+}
+
+// trsm overload
+template <typename T>
+rocblas_status rocblasCall_trsm(rocblas_handle    handle,
+                            rocblas_side      side,
+                            rocblas_fill      uplo,
+                            rocblas_operation transA,
+                            rocblas_diagonal  diag,
+                            rocblas_int       m,
+                            rocblas_int       n,
+                            const T*          alpha,
+                            T *const          A[],
+                            rocblas_int       offsetA,
+                            rocblas_int       lda,
+                            rocblas_stride    strideA,
+                            T*                B,
+                            rocblas_int       offsetB,
+                            rocblas_int       ldb,
+                            rocblas_stride    strideB,
+                            rocblas_int       batch_count)
+{
+    rocsolver_workspace_frame frame(handle);
+    T **work = rocsolver_strided_array<T>(handle,frame,B,strideB,batch_count);
+    if (!work)
+        return rocblas_status_memory_error;
+
+    return rocblasCall_trsm<T>(handle,side,uplo,transA,diag,m,n,alpha,
+                               A,offsetA,lda,strideA,work,offsetB,ldb,strideB,batch_count);
+}
+
+// trsm overload
+template <typename T>
+rocblas_status rocblasCall_trsm(rocblas_handle    handle,
+                            rocblas_side      side,
+                            rocblas_fill      uplo,
+                            rocblas_operation transA,
+                            rocblas_diagonal  diag,
+                            rocblas_int       m,
+                            rocblas_int       n,
+                            const T*          alpha,
+                            T*                A,
+                            rocblas_int       offsetA,
+                            rocblas_int       lda,
+                            rocblas_stride    strideA,
+                            T *const          B[],
+                            rocblas_int       offsetB,
+                            rocblas_int       ldb,
+                            rocblas_stride    strideB,
+                            rocblas_int       batch_count)
+{
+    rocsolver_workspace_frame frame(handle);
+    T **work = rocsolver_strided_array<T>(handle,frame,A,strideA,batch_count);
+    if (!work)
+        return rocblas_status_memory_error;
+
+    return rocblasCall_trsm<T>(handle,side,uplo,transA,diag,m,n,alpha,
+                               work,offsetA,lda,strideA,B,offsetB,ldb,strideB,batch_count);
+}
+
+// workspace (in bytes) needed by the batched overloads of rocblasCall_trsm
+// (the shifted pointers, plus the pointers to the strided argument if there is one)
+template <typename T>
+size_t rocblasCall_trsm_memsize(rocblas_int batch_count)
 {
-    return rocblas_dtrmm(handle,side,uplo,trans,diag,m,n,alpha,A,lda,B,ldb);
-}*/
+    return 3 * rocsolver_workspace_size<T*>(batch_count);
+}
 
 
 
@@ -0,0 +1,166 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef ROCSOLVER_HANDLE_HPP
+#define ROCSOLVER_HANDLE_HPP
+
+#include <hip/hip_runtime_api.h>
+#include <rocblas.h>
+#include "rocsolver-extra-types.h"
+#include <algorithm>
+#include <cstddef>
+
+// **********************************************************
+// Device memory owned by a rocblas handle on the rocsolver side.
+// The workspace is a stack-like arena: it is reserved once, grows
+// on demand and is reused by all the subsequent calls with the
+// same handle. Templates request memory through a workspace frame
+// that gives it back when it goes out of scope, so nested calls
+// (e.g. geqrf -> larft -> larfb) share the same buffer.
+// Alternatively, the user can provide the workspace memory; in that case
+// the library never allocates device memory.
+//
+// The state that holds the workspace and the settings exists from
+// rocsolver_attach_handle (called by rocsolver_create_handle) to
+// rocsolver_detach_handle (called by rocsolver_destroy_handle).
+// rocsolver_workspace_reserve fails with rocblas_status_invalid_handle
+// for a handle that is not attached, so the functions below that take
+// the state (everything except rocsolver_workspace_query) must only be
+// used after it succeeded. A change of the stream of the handle keeps
+// the state: the new stream waits for the work enqueued on the old one.
+// **********************************************************
+
+// every block handed out by the workspace is aligned to this size (bytes)
+#define WORKSPACE_ALIGNMENT 256
+
+// Table of the sets of device constants kept with the handle: one slot of WORKSPACE_CONSTANTS_SLOT
+// bytes per entry, written the first time it is requested. A new set of constants needs a new entry
+// (before rocsolver_constants_count); the area, and the size reported by the workspace queries, grow with it.
+enum rocsolver_constants_id
+{
+    rocsolver_constants_float,              // -1, 0, 1 of type float
+    rocsolver_constants_double,             // -1, 0, 1 of type double
+    rocsolver_constants_float_complex,      // -1, 0, 1 of type rocblas_float_complex
+    rocsolver_constants_double_complex,     // -1, 0, 1 of type rocblas_double_complex
+    rocsolver_constants_count
+};
+
+// bytes at the head of a workspace provided by the user that hold the table of device constants
+#define WORKSPACE_CONSTANTS_SLOT 64
+#define WORKSPACE_CONSTANTS_SIZE (WORKSPACE_CONSTANTS_SLOT * rocsolver_constants_count)
+
+static_assert(3 * sizeof(rocblas_double_complex) <= WORKSPACE_CONSTANTS_SLOT,
+              "the constants -1, 0 and 1 of every precision must fit in a slot");
+static_assert(WORKSPACE_CONSTANTS_SIZE % WORKSPACE_ALIGNMENT == 0,
+              "the workspace after the constants must stay aligned");
+
+// number of bytes taken from the workspace by a request of n elements of type T
+template <typename T>
+constexpr size_t rocsolver_workspace_size(const size_t n)
+{
+    return ((n * sizeof(T) + WORKSPACE_ALIGNMENT - 1) / WORKSPACE_ALIGNMENT) * WORKSPACE_ALIGNMENT;
+}
+
+struct rocsolver_handle_state;
+
+// Used by the API functions once the arguments are validated. If the handle is in
+// workspace query mode, size is recorded and true is returned (the caller must then return
+// without doing any work). The size reported to the user includes WORKSPACE_CONSTANTS_SIZE.
+// Returns false if the handle is not attached.
+bool rocsolver_workspace_query(rocblas_handle handle, const size_t size);
+
+// Makes sure that size bytes can be taken from the workspace without allocating more memory.
+// Returns rocblas_status_invalid_handle if the handle is not attached, and
+// rocblas_status_memory_error if the workspace provided by the user is too small
+// or if the workspace cannot be grown.
+rocblas_status rocsolver_workspace_reserve(rocblas_handle handle, const size_t size);
+
+// Returns a pointer to the slot id of the table of device constants, where the given values
+// (at most WORKSPACE_CONSTANTS_SLOT bytes) are copied on the stream of the handle the first
+// time the slot is requested; the copy is kept until the handle (or its workspace) is released.
+// With a workspace provided by the user the table is at its head; otherwise the library
+// allocates it once. Returns nullptr if the table cannot be allocated.
+void* rocsolver_device_constants(rocblas_handle handle, const rocsolver_constants_id id,
+                                 const void* values, const size_t bytes);
+
+// entry of the table of device constants that holds -1, 0 and 1 of type T
+template <typename T>
+constexpr rocsolver_constants_id rocsolver_constants_slot();
+template <>
+constexpr rocsolver_constants_id rocsolver_constants_slot<float>() { return rocsolver_constants_float; }
+template <>
+constexpr rocsolver_constants_id rocsolver_constants_slot<double>() { return rocsolver_constants_double; }
+template <>
+constexpr rocsolver_constants_id rocsolver_constants_slot<rocblas_float_complex>() { return rocsolver_constants_float_complex; }
+template <>
+constexpr rocsolver_constants_id rocsolver_constants_slot<rocblas_double_complex>() { return rocsolver_constants_double_complex; }
+
+// device constants -1, 0 and 1 (in this order) of type T,
+// or nullptr if they could not be created
+template <typename T>
+T* rocsolver_constants(rocblas_handle handle)
+{
+    const T values[3] = {T(-1), T(0), T(1)};
+    return static_cast<T*>(rocsolver_device_constants(handle, rocsolver_constants_slot<T>(), values, sizeof(values)));
+}
+
+// Returns at least bytes of pinned host memory kept with the handle (and grown when needed), from which
+// data can be copied to the device with hipMemcpyAsync without synchronizing the stream afterwards, or
+// nullptr if it cannot be allocated. The buffer is shared by all the calls with the handle: the caller
+// must make sure that the copies from a previous request are done (e.g. the stream was synchronized
+// since then) before writing into it. It is host memory, so it is not part of the workspace.
+void* rocsolver_host_buffer(rocblas_handle handle, const size_t bytes);
+
+// algorithm selected with rocsolver_set_getrf_panel (rocblas_panel_auto by default)
+rocblas_panel rocsolver_getrf_panel(rocblas_handle handle);
+
+// true if the look-ahead of getrf was enabled with rocsolver_set_getrf_lookahead
+bool rocsolver_getrf_lookahead(rocblas_handle handle);
+
+// true if the early exit of failed batch entries was enabled with rocsolver_set_early_exit
+bool rocsolver_early_exit(rocblas_handle handle);
+
+// Secondary rocblas handle, with its own (non-blocking) stream, used to overlap work with
+// the stream of the main handle. The events are used to synchronize both streams: ready is
+// recorded on the main stream and waited by the side stream, done the other way around.
+// The side handle has its own workspace.
+struct rocsolver_side_stream
+{
+    rocblas_handle handle;
+    hipStream_t    stream;
+    hipEvent_t     ready;
+    hipEvent_t     done;
+};
+
+// Returns the side stream of the handle (created the first time it is requested), or nullptr if
+// it cannot be created or if the workspace was provided by the user (in which case no device
+// memory can be allocated for the side handle).
+const rocsolver_side_stream* rocsolver_get_side_stream(rocblas_handle handle);
+
+class rocsolver_workspace_frame
+{
+public:
+    explicit rocsolver_workspace_frame(rocblas_handle handle);
+    ~rocsolver_workspace_frame();
+
+    rocsolver_workspace_frame(const rocsolver_workspace_frame&) = delete;
+    rocsolver_workspace_frame& operator=(const rocsolver_workspace_frame&) = delete;
+
+    // returns a pointer to n elements of type T in device memory,
+    // or nullptr if the workspace could not be grown
+    template <typename T>
+    T* alloc(const size_t n)
+    {
+        return static_cast<T*>(push(rocsolver_workspace_size<T>(n)));
+    }
+
+private:
+    void* push(const size_t bytes);
+
+    rocsolver_handle_state* state;
+    size_t mark_chunk;
+    size_t mark_used;
+};
+
+#endif /* ROCSOLVER_HANDLE_HPP */
@@ -0,0 +1,131 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#ifndef ROCLAPACK_GBTRF_HPP
+#define ROCLAPACK_GBTRF_HPP
+
+#include <hip/hip_runtime.h>
+#include "rocblas.hpp"
+#include "rocsolver.h"
+#include "ideal_sizes.hpp"
+#include "common_device.hpp"
+#include "rocsolver_handle.hpp"
+
+// Position in band storage of the entry (i,j) of a matrix with kl sub-diagonals and kv = kl+ku
+// super-diagonals (the ku super-diagonals of A plus the kl of fill-in of U)
+__device__ inline size_t gb_loc(const rocblas_int kv, const rocblas_int ldab, const rocblas_int i, const rocblas_int j)
+{
+    return kv + i - j + size_t(j)*ldab;
+}
+
+// LU factorization of a band matrix with partial pivoting. One block of DIM threads per matrix: the
+// columns are factorized one after the other as in getf2, but the pivot search, the row interchange,
+// the scaling and the rank-1 update only touch the (kl+1)-by-(kv+1) window starting at the diagonal
+// element, so the cost is O(n*kl*(kl+ku)). As in LAPACK, a zero pivot sets info and the column is skipped.
+template <rocblas_int DIM, typename T, typename U>
+__global__ void gbtrf_kernel(const rocblas_int m, const rocblas_int n, const rocblas_int kl, const rocblas_int ku,
+                             U AA, const rocblas_int shiftA, const rocblas_int ldab, const rocblas_stride strideA,
+                             rocblas_int* ipivA, const rocblas_int shiftP, const rocblas_stride strideP,
+                             rocblas_int* info)
+{
+    using S = decltype(aabs(T(0)));
+    __shared__ S sval[DIM];
+    __shared__ rocblas_int sidx[DIM];
+
+    int id = hipBlockIdx_x;
+    int tid = hipThreadIdx_x;
+    const rocblas_int kv = kl + ku;
+
+    T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+    rocblas_int* ipiv = ipivA + id*strideP + shiftP;
+
+    // set the fill-in elements (the first kl rows of the storage) to zero
+    for (rocblas_int k = tid; k < kl*n; k += DIM) {
+        rocblas_int r = k % kl, j = k / kl;
+        if (r >= kv - j)
+            A[r + size_t(j)*ldab] = 0;
+    }
+    __syncthreads();
+
+    rocblas_int singular = 0;
+    rocblas_int dim = min(m, n);
+    for (rocblas_int j = 0; j < dim; ++j) {
+        // find pivot among the km+1 entries on and below the diagonal
+        rocblas_int km = min(kl, m - 1 - j);
+        rocblas_int piv = j + block_iamax<DIM>(km + 1, A + gb_loc(kv,ldab,j,j), 1, sval, sidx);
+        T pivot = A[gb_loc(kv,ldab,piv,j)];
+        if (tid == 0)
+            ipiv[j] = piv + 1;      //use Fortran 1-based indexing
+        __syncthreads();
+
+        if (pivot == 0) {
+            if (singular == 0)
+                singular = j + 1;
+            continue;
+        }
+
+        // swap pivot row and j-th row (up to the last column that can have fill-in)
+        rocblas_int ju = min(n - 1, j + kv);
+        if (piv != j) {
+            for (rocblas_int c = j + tid; c <= ju; c += DIM) {
+                T temp = A[gb_loc(kv,ldab,j,c)];
+                A[gb_loc(kv,ldab,j,c)] = A[gb_loc(kv,ldab,piv,c)];
+                A[gb_loc(kv,ldab,piv,c)] = temp;
+            }
+            __syncthreads();
+        }
+
+        // scale the multipliers
+        for (rocblas_int r = tid; r < km; r += DIM)
+            A[gb_loc(kv,ldab,j+1+r,j)] *= T(1.0 / pivot);
+        __syncthreads();
+
+        // update the km-by-(ju-j) window
+        rocblas_int nc = ju - j;
+        for (rocblas_int k = tid; k < km*nc; k += DIM) {
+            rocblas_int r = j + 1 + k % km, c = j + 1 + k / km;
+            A[gb_loc(kv,ldab,r,c)] -= A[gb_loc(kv,ldab,r,j)] * A[gb_loc(kv,ldab,j,c)];
+        }
+        __syncthreads();
+    }
+
+    if (tid == 0)
+        info[id] = singular;
+}
+
+
+template <typename T>
+void rocsolver_gbtrf_getMemorySize(const rocblas_int m, const rocblas_int n, const rocblas_int batch_count, size_t *size)
+{
+    // the factorization works in place
+    *size = 0;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_gbtrf_template(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                                        const rocblas_int kl, const rocblas_int ku,
+                                        U A, const rocblas_int shiftA, const rocblas_int ldab, const rocblas_stride strideA,
+                                        rocblas_int *ipiv, const rocblas_int shiftP, const rocblas_stride strideP,
+                                        rocblas_int *info, const rocblas_int batch_count)
+{
+    // quick return
+    if (batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // (info is also set when m = 0 or n = 0)
+    hipLaunchKernelGGL(gbtrf_kernel<GBTRF_BLOCKSIZE,T>,dim3(batch_count),dim3(GBTRF_BLOCKSIZE),0,stream,
+                       m,n,kl,ku,A,shiftA,ldab,strideA,ipiv,shiftP,strideP,info);
+
+    return rocblas_status_success;
+}
+
+#endif /* ROCLAPACK_GBTRF_HPP */
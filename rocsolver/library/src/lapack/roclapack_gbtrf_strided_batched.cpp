@@ -0,0 +1,76 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gbtrf.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_gbtrf_strided_batched_impl(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                                    const rocblas_int kl, const rocblas_int ku, U AB, const rocblas_int ldab, const rocblas_stride strideA,
+                                    rocblas_int *ipiv, const rocblas_stride strideP, rocblas_int* info, const rocblas_int batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    //logging is missing ???
+
+    if (m < 0 || n < 0 || kl < 0 || ku < 0 || ldab < 2*kl + ku + 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if (!AB || !ipiv || !info)
+        return rocblas_status_invalid_pointer;
+
+    // memory management
+    size_t size;
+    rocsolver_gbtrf_getMemorySize<T>(m,n,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_gbtrf_template<T>(handle,m,n,kl,ku,
+                                    AB,0,    //the matrix is shifted 0 entries (will work on the entire matrix)
+                                    ldab,strideA,
+                                    ipiv,0,  //the vector is shifted 0 entries (will work on the entire vector)
+                                    strideP,
+                                    info,batch_count);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgbtrf_strided_batched(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int kl, const rocblas_int ku, float *AB, const rocblas_int ldab, const rocblas_stride strideA,
+                 rocblas_int *ipiv, const rocblas_stride strideP, rocblas_int* info, const rocblas_int batch_count)
+{
+    return rocsolver_gbtrf_strided_batched_impl<float>(handle, m, n, kl, ku, AB, ldab, strideA, ipiv, strideP, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgbtrf_strided_batched(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int kl, const rocblas_int ku, double *AB, const rocblas_int ldab, const rocblas_stride strideA,
+                 rocblas_int *ipiv, const rocblas_stride strideP, rocblas_int* info, const rocblas_int batch_count)
+{
+    return rocsolver_gbtrf_strided_batched_impl<double>(handle, m, n, kl, ku, AB, ldab, strideA, ipiv, strideP, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgbtrf_strided_batched(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int kl, const rocblas_int ku, rocblas_float_complex *AB, const rocblas_int ldab, const rocblas_stride strideA,
+                 rocblas_int *ipiv, const rocblas_stride strideP, rocblas_int* info, const rocblas_int batch_count)
+{
+    return rocsolver_gbtrf_strided_batched_impl<rocblas_float_complex>(handle, m, n, kl, ku, AB, ldab, strideA, ipiv, strideP, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgbtrf_strided_batched(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 const rocblas_int kl, const rocblas_int ku, rocblas_double_complex *AB, const rocblas_int ldab, const rocblas_stride strideA,
+                 rocblas_int *ipiv, const rocblas_stride strideP, rocblas_int* info, const rocblas_int batch_count)
+{
+    return rocsolver_gbtrf_strided_batched_impl<rocblas_double_complex>(handle, m, n, kl, ku, AB, ldab, strideA, ipiv, strideP, info, batch_count);
+}
+
+} //extern C
@@ -0,0 +1,116 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#ifndef ROCLAPACK_GBTRS_HPP
+#define ROCLAPACK_GBTRS_HPP
+
+#include <hip/hip_runtime.h>
+#include "rocblas.hpp"
+#include "rocsolver.h"
+#include "ideal_sizes.hpp"
+#include "common_device.hpp"
+#include "rocsolver_handle.hpp"
+#include "roclapack_gbtrf.hpp"
+
+// Solves A*x = b, A**T*x = b or A**H*x = b with the band LU factorization computed by gbtrf. Each thread
+// solves one right hand side of one matrix: with narrow bands the substitutions only involve kl+ku
+// entries per row, and the parallelism comes from the batch and the right hand sides.
+// As in LAPACK, the row interchanges are applied together with L, one column at a time.
+template <typename T, typename U>
+__global__ void gbtrs_kernel(const rocblas_operation trans, const rocblas_int n, const rocblas_int kl, const rocblas_int ku,
+                             const rocblas_int nrhs, U AA, const rocblas_int shiftA, const rocblas_int ldab, const rocblas_stride strideA,
+                             const rocblas_int *ipivA, const rocblas_stride strideP,
+                             U BB, const rocblas_int shiftB, const rocblas_int ldb, const rocblas_stride strideB,
+                             const rocblas_int batch_count)
+{
+    size_t t = size_t(hipBlockIdx_x) * hipBlockDim_x + hipThreadIdx_x;
+    if (t >= size_t(nrhs) * batch_count)
+        return;
+
+    rocblas_int id = t / nrhs;
+    T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+    T* b = load_ptr_batch<T>(BB,id,shiftB,strideB) + (t % nrhs)*ldb;
+    const rocblas_int* ipiv = ipivA + id*strideP;
+    const rocblas_int kv = kl + ku;
+    const bool CONJ = (trans == rocblas_operation_conjugate_transpose);
+
+    if (trans == rocblas_operation_none) {
+        // solve L*X = B, applying the row interchanges
+        for (rocblas_int j = 0; j < n - 1; ++j) {
+            rocblas_int jp = ipiv[j] - 1;
+            T x = b[jp];
+            if (jp != j) {
+                b[jp] = b[j];
+                b[j] = x;
+            }
+            for (rocblas_int i = j + 1; i <= min(n - 1, j + kl); ++i)
+                b[i] -= A[gb_loc(kv,ldab,i,j)] * x;
+        }
+
+        // solve U*X = B (U has kv super-diagonals)
+        for (rocblas_int j = n - 1; j >= 0; --j) {
+            T x = b[j] / A[gb_loc(kv,ldab,j,j)];
+            b[j] = x;
+            for (rocblas_int i = max(0, j - kv); i < j; ++i)
+                b[i] -= A[gb_loc(kv,ldab,i,j)] * x;
+        }
+    }
+    else {
+        // solve U**T *X = B or U**H *X = B
+        for (rocblas_int j = 0; j < n; ++j) {
+            T x = b[j];
+            for (rocblas_int i = max(0, j - kv); i < j; ++i)
+                x -= (CONJ ? conj(A[gb_loc(kv,ldab,i,j)]) : A[gb_loc(kv,ldab,i,j)]) * b[i];
+            b[j] = x / (CONJ ? conj(A[gb_loc(kv,ldab,j,j)]) : A[gb_loc(kv,ldab,j,j)]);
+        }
+
+        // solve L**T *X = B or L**H *X = B, applying the row interchanges in reverse order
+        for (rocblas_int j = n - 2; j >= 0; --j) {
+            T x = b[j];
+            for (rocblas_int i = j + 1; i <= min(n - 1, j + kl); ++i)
+                x -= (CONJ ? conj(A[gb_loc(kv,ldab,i,j)]) : A[gb_loc(kv,ldab,i,j)]) * b[i];
+            rocblas_int jp = ipiv[j] - 1;
+            b[j] = b[jp];
+            b[jp] = x;
+        }
+    }
+}
+
+
+template <typename T>
+void rocsolver_gbtrs_getMemorySize(const rocblas_int n, const rocblas_int nrhs, const rocblas_int batch_count, size_t *size)
+{
+    // the solve works in place
+    *size = 0;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_gbtrs_template(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                         const rocblas_int kl, const rocblas_int ku, const rocblas_int nrhs,
+                         U A, const rocblas_int shiftA, const rocblas_int ldab, const rocblas_stride strideA,
+                         const rocblas_int *ipiv, const rocblas_stride strideP,
+                         U B, const rocblas_int shiftB, const rocblas_int ldb, const rocblas_stride strideB,
+                         const rocblas_int batch_count)
+{
+    // quick return
+    if (n == 0 || nrhs == 0 || batch_count == 0) {
+      return rocblas_status_success;
+    }
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (size_t(nrhs) * batch_count - 1) / GBTRS_BLOCKSIZE + 1;
+    hipLaunchKernelGGL(gbtrs_kernel<T>,dim3(blocks),dim3(GBTRS_BLOCKSIZE),0,stream,
+                       trans,n,kl,ku,nrhs,A,shiftA,ldab,strideA,ipiv,strideP,B,shiftB,ldb,strideB,batch_count);
+
+    return rocblas_status_success;
+}
+
+#endif /* ROCLAPACK_GBTRS_HPP */
@@ -0,0 +1,82 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gbtrs.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_gbtrs_batched_impl(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                                    const rocblas_int kl, const rocblas_int ku, const rocblas_int nrhs, U AB, const rocblas_int ldab,
+                                    const rocblas_int *ipiv, const rocblas_stride strideP, U B, const rocblas_int ldb, const rocblas_int batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    //logging is missing ???
+
+    if (trans != rocblas_operation_none && trans != rocblas_operation_transpose
+        && trans != rocblas_operation_conjugate_transpose)
+        return rocblas_status_not_implemented;
+    if (n < 0 || kl < 0 || ku < 0 || nrhs < 0 || ldab < 2*kl + ku + 1 || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if (!AB || !ipiv || !B)
+        return rocblas_status_invalid_pointer;
+
+    rocblas_stride strideA = 0;
+    rocblas_stride strideB = 0;
+
+    // memory management
+    size_t size;
+    rocsolver_gbtrs_getMemorySize<T>(n,nrhs,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_gbtrs_template<T>(handle,trans,n,kl,ku,nrhs,
+                                       AB,0,    //The matrix is shifted 0 entries (will work on the entire matrix)
+                                       ldab,strideA,
+                                       ipiv,strideP,
+                                       B,0,ldb,strideB,
+                                       batch_count);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgbtrs_batched(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int kl, const rocblas_int ku, const rocblas_int nrhs, float *const AB[], const rocblas_int ldab,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, float *const B[], const rocblas_int ldb, const rocblas_int batch_count)
+{
+    return rocsolver_gbtrs_batched_impl<float>(handle, trans, n, kl, ku, nrhs, AB, ldab, ipiv, strideP, B, ldb, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgbtrs_batched(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int kl, const rocblas_int ku, const rocblas_int nrhs, double *const AB[], const rocblas_int ldab,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, double *const B[], const rocblas_int ldb, const rocblas_int batch_count)
+{
+    return rocsolver_gbtrs_batched_impl<double>(handle, trans, n, kl, ku, nrhs, AB, ldab, ipiv, strideP, B, ldb, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgbtrs_batched(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int kl, const rocblas_int ku, const rocblas_int nrhs, rocblas_float_complex *const AB[], const rocblas_int ldab,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, rocblas_float_complex *const B[], const rocblas_int ldb, const rocblas_int batch_count)
+{
+    return rocsolver_gbtrs_batched_impl<rocblas_float_complex>(handle, trans, n, kl, ku, nrhs, AB, ldab, ipiv, strideP, B, ldb, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgbtrs_batched(rocblas_handle handle, const rocblas_operation trans, const rocblas_int n,
+                 const rocblas_int kl, const rocblas_int ku, const rocblas_int nrhs, rocblas_double_complex *const AB[], const rocblas_int ldab,
+                 const rocblas_int *ipiv, const rocblas_stride strideP, rocblas_double_complex *const B[], const rocblas_int ldb, const rocblas_int batch_count)
+{
+    return rocsolver_gbtrs_batched_impl<rocblas_double_complex>(handle, trans, n, kl, ku, nrhs, AB, ldab, ipiv, strideP, B, ldb, batch_count);
+}
+
+} //extern C
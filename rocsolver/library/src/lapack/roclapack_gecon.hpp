@@ -0,0 +1,273 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#ifndef ROCLAPACK_GECON_HPP
+#define ROCLAPACK_GECON_HPP
+
+#include <hip/hip_runtime.h>
+#include "rocblas.hpp"
+#include "rocsolver.h"
+#include "ideal_sizes.hpp"
+#include "common_device.hpp"
+#include "rocsolver_handle.hpp"
+
+// sign of x as used by the estimator (x/|x| for complex numbers)
+template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+__device__ inline T con_sign(T x)
+{
+    return x >= 0 ? T(1) : T(-1);
+}
+
+template <typename T, std::enable_if_t<is_complex<T>, int> = 0>
+__device__ inline T con_sign(T x)
+{
+    auto a = rocblas_abs(x);
+    return a > 0 ? x * T(1 / a) : T(1);
+}
+
+// sum of the values val of all the threads of a block of DIM threads. sval has DIM entries of shared memory
+template <rocblas_int DIM, typename S>
+__device__ S block_sum(S val, S *sval)
+{
+    int tid = hipThreadIdx_x;
+
+    sval[tid] = val;
+    __syncthreads();
+    for (rocblas_int r = DIM/2; r > 0; r /= 2) {
+        if (tid < r)
+            sval[tid] += sval[tid + r];
+        __syncthreads();
+    }
+    S sum = sval[0];
+    __syncthreads();
+
+    return sum;
+}
+
+// x = inv(A)*x (or inv(A')*x if trans is true) for the n-by-n triangular matrix A, computed by a block of DIM threads.
+// sred has DIM entries of shared memory
+template <rocblas_int DIM, typename T>
+__device__ void block_trsv(const bool lower, const bool trans, const bool unit, const rocblas_int n,
+                           const T* A, const rocblas_int lda, T* x, T* sred)
+{
+    int tid = hipThreadIdx_x;
+
+    if (!trans) {
+        // column oriented: once x[j] is final it is eliminated from the remaining entries
+        for (rocblas_int jj = 0; jj < n; ++jj) {
+            rocblas_int j = lower ? jj : n - 1 - jj;
+            __syncthreads();
+            T xj = unit ? x[j] : x[j] / A[j + j*lda];
+            __syncthreads();
+            if (tid == 0)
+                x[j] = xj;
+            if (lower) {
+                for (rocblas_int i = j + 1 + tid; i < n; i += DIM)
+                    x[i] -= A[i + j*lda] * xj;
+            }
+            else {
+                for (rocblas_int i = tid; i < j; i += DIM)
+                    x[i] -= A[i + j*lda] * xj;
+            }
+        }
+        __syncthreads();
+    }
+    else {
+        // row oriented (the rows of A' are the columns of A): x[i] is reduced with the entries already computed
+        __syncthreads();
+        for (rocblas_int ii = 0; ii < n; ++ii) {
+            rocblas_int i = lower ? n - 1 - ii : ii;
+            T s = 0;
+            if (lower) {
+                for (rocblas_int k = i + 1 + tid; k < n; k += DIM)
+                    s += conj(A[k + i*lda]) * x[k];
+            }
+            else {
+                for (rocblas_int k = tid; k < i; k += DIM)
+                    s += conj(A[k + i*lda]) * x[k];
+            }
+            s = block_sum<DIM>(s, sred);
+            if (tid == 0)
+                x[i] = unit ? x[i] - s : (x[i] - s) / conj(A[i + i*lda]);
+            __syncthreads();
+        }
+    }
+}
+
+// x = inv(A)*x (or inv(A')*x if trans is true). If GE is true A = L*U, with the factors returned by getrf
+// (the row interchanges only permute the columns of inv(A), which does not change its 1-norm);
+// otherwise A = U'*U or L*L' as returned by potrf (and inv(A) = inv(A)')
+template <rocblas_int DIM, bool GE, typename T>
+__device__ void con_apply(const rocblas_fill uplo, const bool trans, const rocblas_int n,
+                          const T* A, const rocblas_int lda, T* x, T* sred)
+{
+    if (GE) {
+        if (!trans) {
+            block_trsv<DIM>(true, false, true, n, A, lda, x, sred);
+            block_trsv<DIM>(false, false, false, n, A, lda, x, sred);
+        }
+        else {
+            block_trsv<DIM>(false, true, false, n, A, lda, x, sred);
+            block_trsv<DIM>(true, true, true, n, A, lda, x, sred);
+        }
+    }
+    else {
+        bool lower = (uplo == rocblas_fill_lower);
+        block_trsv<DIM>(lower, !lower, false, n, A, lda, x, sred);
+        block_trsv<DIM>(lower, lower, false, n, A, lda, x, sred);
+    }
+}
+
+// Reciprocal of the condition number in the 1-norm, rcond = 1 / (anorm * norm(inv(A))), where norm(inv(A))
+// is estimated with the method of Hager and Higham (as in LAPACK's lacn2) using the factors of A.
+// One block of DIM threads per matrix; work has 2*n entries per matrix.
+// rcond = 0 if anorm = 0 or if a diagonal element of the factors is zero.
+template <rocblas_int DIM, bool GE, typename T, typename S, typename U>
+__global__ void con_estimate(const rocblas_fill uplo, const rocblas_int n, U AA, const rocblas_int shiftA,
+                             const rocblas_int lda, const rocblas_stride strideA,
+                             const S* anorm, S* rcond, T* work)
+{
+    __shared__ T sred[DIM];
+    __shared__ S sval[DIM];
+    __shared__ rocblas_int sidx[DIM];
+
+    int id = hipBlockIdx_x;
+    int tid = hipThreadIdx_x;
+
+    const T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+    T* x = work + size_t(id)*2*n;
+    T* sgn = x + n;
+
+    // quick return if the matrix is singular
+    bool zero = false;
+    for (rocblas_int i = tid; i < n; i += DIM)
+        zero = zero || A[i + i*lda] == T(0);
+    S anrm = anorm[id];
+    if (__syncthreads_or(zero) || anrm == 0) {
+        if (tid == 0)
+            rcond[id] = 0;
+        return;
+    }
+
+    // x = inv(A)*e/n
+    for (rocblas_int i = tid; i < n; i += DIM)
+        x[i] = T(S(1) / n);
+    con_apply<DIM,GE>(uplo, false, n, A, lda, x, sred);
+
+    S est, estold, temp;
+    if (n == 1)
+        est = rocblas_abs(x[0]);
+    else {
+        temp = 0;
+        for (rocblas_int i = tid; i < n; i += DIM)
+            temp += rocblas_abs(x[i]);
+        est = block_sum<DIM>(temp, sval);
+
+        // x = inv(A')*sign(x)
+        for (rocblas_int i = tid; i < n; i += DIM) {
+            sgn[i] = con_sign(x[i]);
+            x[i] = sgn[i];
+        }
+        con_apply<DIM,GE>(uplo, true, n, A, lda, x, sred);
+        rocblas_int j = block_iamax<DIM>(n, x, 1, sval, sidx);
+        __syncthreads();
+
+        for (rocblas_int iter = 2; ; ++iter) {
+            // x = inv(A)*e_j
+            for (rocblas_int i = tid; i < n; i += DIM)
+                x[i] = (i == j) ? T(1) : T(0);
+            con_apply<DIM,GE>(uplo, false, n, A, lda, x, sred);
+            estold = est;
+            temp = 0;
+            for (rocblas_int i = tid; i < n; i += DIM)
+                temp += rocblas_abs(x[i]);
+            est = block_sum<DIM>(temp, sval);
+
+            // stop if the signs repeat (real case) or if the estimate does not grow
+            bool repeated = !is_complex<T>;
+            for (rocblas_int i = tid; i < n; i += DIM)
+                repeated = repeated && con_sign(x[i]) == sgn[i];
+            if (__syncthreads_and(repeated) || est <= estold)
+                break;
+
+            // x = inv(A')*sign(x)
+            for (rocblas_int i = tid; i < n; i += DIM) {
+                sgn[i] = con_sign(x[i]);
+                x[i] = sgn[i];
+            }
+            con_apply<DIM,GE>(uplo, true, n, A, lda, x, sred);
+            rocblas_int jlast = j;
+            j = block_iamax<DIM>(n, x, 1, sval, sidx);
+            __syncthreads();
+            if (rocblas_abs(x[jlast]) == rocblas_abs(x[j]) || iter >= CON_ITMAX)
+                break;
+        }
+
+        // alternating sign vector, x = inv(A)*x
+        for (rocblas_int i = tid; i < n; i += DIM)
+            x[i] = T((i % 2 ? -1 : 1) * (1 + S(i) / (n - 1)));
+        con_apply<DIM,GE>(uplo, false, n, A, lda, x, sred);
+        temp = 0;
+        for (rocblas_int i = tid; i < n; i += DIM)
+            temp += rocblas_abs(x[i]);
+        temp = 2 * block_sum<DIM>(temp, sval) / (3 * n);
+        est = temp > est ? temp : est;
+    }
+
+    if (tid == 0)
+        rcond[id] = est != 0 ? (S(1) / est) / anrm : S(0);
+}
+
+
+template <typename T>
+void rocsolver_gecon_getMemorySize(const rocblas_int n, const rocblas_int batch_count, size_t *size)
+{
+    // x and the vector of signs
+    *size = rocsolver_workspace_size<T>(size_t(2)*n*batch_count);
+}
+
+template <bool GE, typename T, typename S, typename U>
+rocblas_status rocsolver_con_template(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                                      U A, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                                      const S* anorm, S* rcond, const rocblas_int batch_count)
+{
+    // quick return
+    if (batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    if (n == 0) {
+        //rcond=1 (nothing to estimate)
+        rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+        hipLaunchKernelGGL(reset_info,dim3(blocksReset),dim3(BLOCKSIZE),0,stream,rcond,batch_count,1);
+        return rocblas_status_success;
+    }
+
+    rocsolver_workspace_frame frame(handle);
+    T *work = frame.alloc<T>(size_t(2)*n*batch_count);
+    if (!work)
+        return rocblas_status_memory_error;
+
+    hipLaunchKernelGGL((con_estimate<CON_BLOCKSIZE,GE,T>),dim3(batch_count),dim3(CON_BLOCKSIZE),0,stream,
+                       uplo,n,A,shiftA,lda,strideA,anorm,rcond,work);
+
+    return rocblas_status_success;
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_gecon_template(rocblas_handle handle, const rocblas_int n,
+                                        U A, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                                        const S* anorm, S* rcond, const rocblas_int batch_count)
+{
+    return rocsolver_con_template<true,T>(handle,rocblas_fill_full,n,A,shiftA,lda,strideA,anorm,rcond,batch_count);
+}
+
+#endif /* ROCLAPACK_GECON_HPP */
@@ -0,0 +1,69 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gecon.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_gecon_strided_batched_impl(rocblas_handle handle, const rocblas_int n,
+                                        U A, const rocblas_int lda, const rocblas_stride strideA,
+                                        const S* anorm, S* rcond, const rocblas_int batch_count) {
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    
+    //logging is missing ???    
+
+    if (n < 0 || lda < n || batch_count < 0) 
+        return rocblas_status_invalid_size;
+    if (!A || !anorm || !rcond)
+        return rocblas_status_invalid_pointer;
+
+    // memory management
+    size_t size;
+    rocsolver_gecon_getMemorySize<T>(n,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_gecon_template<T>(handle,n,
+                                                A,0,    //The matrix is shifted 0 entries (will work on the entire matrix)
+                                                lda,strideA,
+                                                anorm,rcond,batch_count);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgecon_strided_batched(rocblas_handle handle, const rocblas_int n,
+                 float *A, const rocblas_int lda, const rocblas_stride strideA, const float *anorm, float *rcond, const rocblas_int batch_count) 
+{
+    return rocsolver_gecon_strided_batched_impl<float>(handle, n, A, lda, strideA, anorm, rcond, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgecon_strided_batched(rocblas_handle handle, const rocblas_int n,
+                 double *A, const rocblas_int lda, const rocblas_stride strideA, const double *anorm, double *rcond, const rocblas_int batch_count) 
+{
+    return rocsolver_gecon_strided_batched_impl<double>(handle, n, A, lda, strideA, anorm, rcond, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgecon_strided_batched(rocblas_handle handle, const rocblas_int n,
+                 rocblas_float_complex *A, const rocblas_int lda, const rocblas_stride strideA, const float *anorm, float *rcond, const rocblas_int batch_count) 
+{
+    return rocsolver_gecon_strided_batched_impl<rocblas_float_complex>(handle, n, A, lda, strideA, anorm, rcond, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgecon_strided_batched(rocblas_handle handle, const rocblas_int n,
+                 rocblas_double_complex *A, const rocblas_int lda, const rocblas_stride strideA, const double *anorm, double *rcond, const rocblas_int batch_count) 
+{
+    return rocsolver_gecon_strided_batched_impl<rocblas_double_complex>(handle, n, A, lda, strideA, anorm, rcond, batch_count);
+}
+
+} //extern C
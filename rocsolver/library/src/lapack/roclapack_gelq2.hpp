@@ -14,9 +14,26 @@
 #include "rocblas.hpp"
 #include "rocsolver.h"
 #include "common_device.hpp"
+#include "rocsolver_handle.hpp"
 #include "../auxiliary/rocauxiliary_larfg.hpp"
 #include "../auxiliary/rocauxiliary_larf.hpp"
 
+template <typename T>
+void rocsolver_gelq2_getMemorySize(const rocblas_int m, const rocblas_int n, const rocblas_int batch_count, size_t *size)
+{
+    // quick return
+    if (m == 0 || n == 0) {
+        *size = 0;
+        return;
+    }
+
+    // diag + max(larfg, larf)
+    size_t s;
+    rocsolver_larfg_getMemorySize<T>(n,batch_count,size);
+    rocsolver_larf_getMemorySize<T>(rocblas_side_right,m,n,batch_count,&s);
+    *size = std::max(*size,s) + rocsolver_workspace_size<T>(batch_count);
+}
+
 template <typename T, typename U>
 rocblas_status rocsolver_gelq2_template(rocblas_handle handle, const rocblas_int m,
                                         const rocblas_int n, U A, const rocblas_int shiftA, const rocblas_int lda, 
@@ -30,10 +47,11 @@ rocblas_status rocsolver_gelq2_template(rocblas_handle handle, const rocblas_int
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    // (TODO) THIS SHOULD BE DONE WITH THE HANDLE MEMORY ALLOCATOR
     //memory in GPU (workspace)
-    T *diag;
-    hipMalloc(&diag,sizeof(T)*batch_count);
+    rocsolver_workspace_frame frame(handle);
+    T *diag = frame.alloc<T>(batch_count);
+    if (!diag)
+        return rocblas_status_memory_error;
    
     rocblas_int dim = min(m, n);    //total number of pivots    
 
@@ -67,7 +85,6 @@ rocblas_status rocsolver_gelq2_template(rocblas_handle handle, const rocblas_int
         hipLaunchKernelGGL(restore_diag,dim3(batch_count,1,1),dim3(1,1,1),0,stream,diag,A,shiftA+idx2D(j,j,lda),strideA);
     }
 
-    hipFree(diag);
 
     return rocblas_status_success;
 }
@@ -20,6 +20,15 @@ rocblas_status rocsolver_gelq2_strided_batched_impl(rocblas_handle handle, const
         return rocblas_status_invalid_size;
 
 
+    // memory management
+    size_t size;
+    rocsolver_gelq2_getMemorySize<T>(m,n,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
     return rocsolver_gelq2_template<T>(handle,m,n,
                                     A,0,    //the matrix is shifted 0 entries (will work on the entire matrix)
                                     lda,strideA,
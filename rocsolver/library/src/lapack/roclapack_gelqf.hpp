@@ -15,10 +15,30 @@
 #include "rocsolver.h"
 #include "ideal_sizes.hpp"
 #include "common_device.hpp"
+#include "rocsolver_handle.hpp"
 #include "roclapack_gelq2.hpp"
 #include "../auxiliary/rocauxiliary_larft.hpp"
 #include "../auxiliary/rocauxiliary_larfb.hpp"
 
+template <typename T>
+void rocsolver_gelqf_getMemorySize(const rocblas_int m, const rocblas_int n, const rocblas_int batch_count, size_t *size)
+{
+    rocsolver_gelq2_getMemorySize<T>(m,n,batch_count,size);
+
+    // if the matrix is small, the unblocked variant is used
+    if (m <= GEQRF_GEQR2_SWITCHSIZE || n <= GEQRF_GEQR2_SWITCHSIZE)
+        return;
+
+    // work + max(gelq2, larft, larfb)
+    rocblas_int ldw = GEQRF_GEQR2_BLOCKSIZE;
+    size_t s;
+    rocsolver_larft_getMemorySize<T>(std::max(m,n),ldw,batch_count,&s);
+    *size = std::max(*size,s);
+    rocsolver_larfb_getMemorySize<T>(rocblas_side_right,m,n,ldw,batch_count,&s);
+    *size = std::max(*size,s);
+    *size += rocsolver_workspace_size<T>(size_t(ldw)*ldw*batch_count);
+}
+
 template <bool BATCHED, bool STRIDED, typename T, typename U>
 rocblas_status rocsolver_gelqf_template(rocblas_handle handle, const rocblas_int m,
                                         const rocblas_int n, U A, const rocblas_int shiftA, const rocblas_int lda, 
@@ -39,12 +59,13 @@ rocblas_status rocsolver_gelqf_template(rocblas_handle handle, const rocblas_int
     rocblas_int dim = min(m, n);    //total number of pivots
     rocblas_int jb, j = 0;
 
-    // (TODO) THIS SHOULD BE DONE WITH THE HANDLE MEMORY ALLOCATOR
     //memory in GPU (workspace)
-    T* work;
     rocblas_int ldw = GEQRF_GEQR2_BLOCKSIZE;
     rocblas_stride strideW = rocblas_stride(ldw) * ldw;
-    hipMalloc(&work, sizeof(T)*strideW*batch_count);
+    rocsolver_workspace_frame frame(handle);
+    T* work = frame.alloc<T>(strideW*batch_count);
+    if (!work)
+        return rocblas_status_memory_error;
 
     while (j < dim - GEQRF_GEQR2_SWITCHSIZE) {
         // Factor diagonal and subdiagonal blocks 
@@ -77,7 +98,6 @@ rocblas_status rocsolver_gelqf_template(rocblas_handle handle, const rocblas_int
     if (j < dim) 
         rocsolver_gelq2_template<T>(handle, m-j, n-j, A, shiftA + idx2D(j,j,lda), lda, strideA, (ipiv + j), strideP, batch_count);
         
-    hipFree(work);
 
     return rocblas_status_success;
 }
@@ -23,6 +23,15 @@ rocblas_status rocsolver_geqr2_impl(rocblas_handle handle, const rocblas_int m,
     rocblas_stride stridep = 0;
     rocblas_int batch_count = 1;
 
+    // memory management
+    size_t size;
+    rocsolver_geqr2_getMemorySize<T>(m,n,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
     return rocsolver_geqr2_template<T>(handle,m,n,
                                     A,0,    //the matrix is shifted 0 entries (will work on the entire matrix)
                                     lda,strideA,
@@ -2,7 +2,6 @@
  * Copyright 2019-2020 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 
-#define batched
 #include "roclapack_geqr2.hpp"
 
 template <typename T, typename U>
@@ -22,6 +21,15 @@ rocblas_status rocsolver_geqr2_batched_impl(rocblas_handle handle, const rocblas
 
     rocblas_stride strideA = 0;
 
+    // memory management
+    size_t size;
+    rocsolver_geqr2_getMemorySize<T>(m,n,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
     return rocsolver_geqr2_template<T>(handle,m,n,
                                     A,0,    //the matrix is shifted 0 entries (will work on the entire matrix)
                                     lda,strideA,
@@ -52,4 +60,3 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_dgeqr2_batched(rocblas_handle handle,
 }
 
 } //extern C
-#undef batched
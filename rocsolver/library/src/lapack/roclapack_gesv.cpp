@@ -0,0 +1,75 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gesv.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_gesv_impl(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs, U A, const rocblas_int lda,
+                                        rocblas_int *ipiv, U B, const rocblas_int ldb, rocblas_int* info) {
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    
+    //logging is missing ???    
+
+    if (n < 0 || nrhs < 0 || lda < n || ldb < n) 
+        return rocblas_status_invalid_size;
+    if (!A || !ipiv || !B || !info)
+        return rocblas_status_invalid_pointer;
+
+    rocblas_stride strideA = 0;
+    rocblas_stride strideB = 0;
+    rocblas_stride strideP = 0;
+    rocblas_int batch_count = 1;
+
+    // memory management
+    size_t size;
+    rocsolver_gesv_getMemorySize<T>(n,nrhs,ldb,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_gesv_template<false,false,T>(handle,n,nrhs,
+                                                A,0,    //The matrix is shifted 0 entries (will work on the entire matrix)
+                                                lda,strideA,
+                                                ipiv,strideP,
+                                                B,0,ldb,strideB,
+                                                info,batch_count);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgesv(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                 float *A, const rocblas_int lda, rocblas_int *ipiv, float *B, const rocblas_int ldb, rocblas_int* info) 
+{
+    return rocsolver_gesv_impl<float>(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgesv(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                 double *A, const rocblas_int lda, rocblas_int *ipiv, double *B, const rocblas_int ldb, rocblas_int* info) 
+{
+    return rocsolver_gesv_impl<double>(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgesv(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                 rocblas_float_complex *A, const rocblas_int lda, rocblas_int *ipiv, rocblas_float_complex *B, const rocblas_int ldb, rocblas_int* info) 
+{
+    return rocsolver_gesv_impl<rocblas_float_complex>(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgesv(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                 rocblas_double_complex *A, const rocblas_int lda, rocblas_int *ipiv, rocblas_double_complex *B, const rocblas_int ldb, rocblas_int* info) 
+{
+    return rocsolver_gesv_impl<rocblas_double_complex>(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+} //extern C
@@ -0,0 +1,108 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#ifndef ROCLAPACK_GESV_HPP
+#define ROCLAPACK_GESV_HPP
+
+#include <hip/hip_runtime.h>
+#include "rocblas.hpp"
+#include "rocsolver.h"
+#include "common_device.hpp"
+#include "rocsolver_handle.hpp"
+#include "roclapack_getrf.hpp"
+#include "roclapack_getrs.hpp"
+
+// array of pointers to the matrices A (taken from the workspace frame if A is strided)
+template <typename T>
+T *const* gesv_pointer_array(rocblas_handle handle, rocsolver_workspace_frame& frame, T* A, const rocblas_stride strideA,
+                             const rocblas_int batch_count)
+{
+    return rocsolver_strided_array<T>(handle,frame,A,strideA,batch_count);
+}
+
+template <typename T>
+T *const* gesv_pointer_array(rocblas_handle handle, rocsolver_workspace_frame& frame, T *const A[], const rocblas_stride strideA,
+                             const rocblas_int batch_count)
+{
+    return A;
+}
+
+
+template <typename T>
+void rocsolver_gesv_getMemorySize(const rocblas_int n, const rocblas_int nrhs, const rocblas_int ldb,
+                                  const rocblas_int batch_count, size_t *size)
+{
+    // getrf and getrs run one after the other and share the workspace
+    size_t s;
+    rocsolver_getrf_getMemorySize<T>(n,n,batch_count,size);
+    rocsolver_getrs_getMemorySize<T>(n,nrhs,batch_count,&s);
+    *size = std::max(*size,s);
+
+    // masked pointers to B + scratch matrix for the singular systems + pointers to A
+    if (n > 0 && nrhs > 0) {
+        *size += 2 * rocsolver_workspace_size<T*>(batch_count);
+        *size += rocsolver_workspace_size<T>(size_t(ldb)*nrhs);
+    }
+}
+
+// Factorizes A with getrf and solves the systems with getrs, without synchronizing with the host.
+// The right hand sides of the singular matrices are left untouched.
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_gesv_template(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                                       U A, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                                       rocblas_int *ipiv, const rocblas_stride strideP,
+                                       U B, const rocblas_int shiftB, const rocblas_int ldb, const rocblas_stride strideB,
+                                       rocblas_int* info, const rocblas_int batch_count)
+{
+    // quick return
+    if (batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+
+    if (n == 0) {
+        //info=0 (nothing to factorize)
+        hipLaunchKernelGGL(reset_info,dim3(blocksReset),dim3(BLOCKSIZE),0,stream,info,batch_count,0);
+        return rocblas_status_success;
+    }
+
+    // masked pointers to B and scratch matrix (reserved before the workspace of getrf and getrs)
+    rocsolver_workspace_frame frame(handle);
+    T** Barr = nullptr;
+    T* scratch = nullptr;
+    if (nrhs > 0) {
+        Barr = frame.alloc<T*>(batch_count);
+        scratch = frame.alloc<T>(size_t(ldb)*nrhs);
+        if (!Barr || !scratch)
+            return rocblas_status_memory_error;
+    }
+
+    // factorize A
+    rocblas_status status = rocsolver_getrf_template<BATCHED,STRIDED,true,T>(handle,n,n,A,shiftA,lda,strideA,
+                                                                            ipiv,0,strideP,info,batch_count);
+    if (status != rocblas_status_success || nrhs == 0)
+        return status;
+
+    // solve the systems with nonsingular matrices
+    T *const* Aarr = gesv_pointer_array<T>(handle,frame,A,strideA,batch_count);
+    if (!Aarr)
+        return rocblas_status_memory_error;
+    hipLaunchKernelGGL(mask_pointers<T>,dim3(blocksReset),dim3(BLOCKSIZE),0,stream,
+                       B,shiftB,strideB,info,scratch,Barr,batch_count);
+
+    return rocsolver_getrs_template<T>(handle,rocblas_operation_none,n,nrhs,
+                                       Aarr,shiftA,lda,strideA,
+                                       ipiv,strideP,
+                                       cast2constPointer<T>(Barr),0,ldb,strideB,
+                                       batch_count);
+}
+
+#endif /* ROCLAPACK_GESV_HPP */
@@ -0,0 +1,56 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gesv_mixed.hpp"
+
+template <typename T, typename S>
+rocblas_status rocsolver_gesv_mixed_impl(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                                        T* A, const rocblas_int lda, rocblas_int *ipiv, T* B, const rocblas_int ldb,
+                                        T* X, const rocblas_int ldx, rocblas_int* iter, rocblas_int* info) {
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    
+    //logging is missing ???    
+
+    if (n < 0 || nrhs < 0 || lda < n || ldb < n || ldx < n) 
+        return rocblas_status_invalid_size;
+    if (!A || !ipiv || !B || !X || !iter || !info)
+        return rocblas_status_invalid_pointer;
+
+    // memory management
+    size_t size;
+    rocsolver_gesv_mixed_getMemorySize<T,S>(n,nrhs,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_gesv_mixed_template<T,S>(handle,n,nrhs,A,lda,ipiv,B,ldb,X,ldx,iter,info);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dsgesv(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                 double *A, const rocblas_int lda, rocblas_int *ipiv, double *B, const rocblas_int ldb,
+                 double *X, const rocblas_int ldx, rocblas_int *iter, rocblas_int *info) 
+{
+    return rocsolver_gesv_mixed_impl<double,float>(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zcgesv(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                 rocblas_double_complex *A, const rocblas_int lda, rocblas_int *ipiv, rocblas_double_complex *B, const rocblas_int ldb,
+                 rocblas_double_complex *X, const rocblas_int ldx, rocblas_int *iter, rocblas_int *info) 
+{
+    return rocsolver_gesv_mixed_impl<rocblas_double_complex,rocblas_float_complex>(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info);
+}
+
+} //extern C
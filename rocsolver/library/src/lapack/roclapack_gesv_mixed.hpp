@@ -0,0 +1,311 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#ifndef ROCLAPACK_GESV_MIXED_HPP
+#define ROCLAPACK_GESV_MIXED_HPP
+
+#include <hip/hip_runtime.h>
+#include <limits>
+#include "rocblas.hpp"
+#include "rocsolver.h"
+#include "ideal_sizes.hpp"
+#include "common_device.hpp"
+#include "rocsolver_handle.hpp"
+#include "roclapack_getrf.hpp"
+#include "roclapack_getrs.hpp"
+
+// conversion between precisions
+template <typename T2, typename T1>
+__device__ inline T2 convert_precision(T1 x)
+{
+    return T2(x);
+}
+
+template <>
+__device__ inline rocblas_float_complex convert_precision<rocblas_float_complex, rocblas_double_complex>(rocblas_double_complex x)
+{
+    return rocblas_float_complex(std::real(x), std::imag(x));
+}
+
+template <>
+__device__ inline rocblas_double_complex convert_precision<rocblas_double_complex, rocblas_float_complex>(rocblas_float_complex x)
+{
+    return rocblas_double_complex(std::real(x), std::imag(x));
+}
+
+// Y = X converted to the precision of Y. If overflow is not null, it is set to 1 when
+// an entry of X does not fit in the precision of Y.
+template <typename T1, typename T2>
+__global__ void gesv_convert(const rocblas_int m, const rocblas_int n, const T1* X, const rocblas_int ldx,
+                             T2* Y, const rocblas_int ldy, rocblas_int* overflow)
+{
+    using S2 = decltype(std::real(T2(0)));
+    int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    int j = hipBlockIdx_y;
+
+    if (i < m) {
+        T1 x = X[i + j*ldx];
+        if (overflow && (rocblas_abs(std::real(x)) > std::numeric_limits<S2>::max() ||
+                         rocblas_abs(std::imag(x)) > std::numeric_limits<S2>::max()))
+            *overflow = 1;
+        Y[i + j*ldy] = convert_precision<T2>(x);
+    }
+}
+
+// X = X + Y (Y in lower precision)
+template <typename T1, typename T2>
+__global__ void gesv_update(const rocblas_int m, T1* X, const rocblas_int ldx, const T2* Y, const rocblas_int ldy)
+{
+    int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    int j = hipBlockIdx_y;
+
+    if (i < m)
+        X[i + j*ldx] += convert_precision<T1>(Y[i + j*ldy]);
+}
+
+// partial row sums of |A| (|real part| + |imaginary part| for complex entries) for the
+// infinity norm: block (x,y) adds the columns y*COLS to (y+1)*COLS-1 of its rows and
+// stores the sums in sums[:,y]
+template <rocblas_int COLS, typename T, typename S>
+__global__ void gesv_norm_partial(const rocblas_int n, const T* A, const rocblas_int lda, S* sums)
+{
+    int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    int y = hipBlockIdx_y;
+    rocblas_int j0 = y*COLS;
+    rocblas_int j1 = (j0 + COLS < n) ? j0 + COLS : n;
+
+    if (i < n) {
+        S sum = 0;
+        for (rocblas_int j = j0; j < j1; ++j)
+            sum += aabs(A[i + j*lda]);
+        sums[i + y*n] = sum;
+    }
+}
+
+// anorm = max over the rows of the nparts partial sums of each row, computed by one block
+template <rocblas_int DIM, typename S>
+__global__ void gesv_norm_max(const rocblas_int n, const rocblas_int nparts, const S* sums, S* anorm)
+{
+    __shared__ S sval[DIM];
+    int tid = hipThreadIdx_x;
+
+    S val = 0;
+    for (rocblas_int i = tid; i < n; i += DIM) {
+        S sum = 0;
+        for (rocblas_int y = 0; y < nparts; ++y)
+            sum += sums[i + y*n];
+        val = max(val, sum);
+    }
+    sval[tid] = val;
+    __syncthreads();
+
+    for (rocblas_int r = DIM/2; r > 0; r /= 2) {
+        if (tid < r)
+            sval[tid] = max(sval[tid], sval[tid + r]);
+        __syncthreads();
+    }
+
+    if (tid == 0)
+        anorm[0] = sval[0];
+}
+
+// Each block of DIM threads checks one column: converged is set to 0 if
+// max|R(:,j)| > max|X(:,j)| * anorm * cte
+template <rocblas_int DIM, typename T, typename S>
+__global__ void gesv_check_convergence(const rocblas_int n, const T* X, const rocblas_int ldx, const T* R, const rocblas_int ldr,
+                                       const S* anorm, const S cte, rocblas_int* converged)
+{
+    __shared__ S sx[DIM];
+    __shared__ S sr[DIM];
+    int j = hipBlockIdx_x;
+    int tid = hipThreadIdx_x;
+
+    S xval = 0, rval = 0;
+    for (rocblas_int i = tid; i < n; i += DIM) {
+        xval = max(xval, aabs(X[i + j*ldx]));
+        rval = max(rval, aabs(R[i + j*ldr]));
+    }
+    sx[tid] = xval;
+    sr[tid] = rval;
+    __syncthreads();
+
+    for (rocblas_int r = DIM/2; r > 0; r /= 2) {
+        if (tid < r) {
+            sx[tid] = max(sx[tid], sx[tid + r]);
+            sr[tid] = max(sr[tid], sr[tid + r]);
+        }
+        __syncthreads();
+    }
+
+    if (tid == 0 && sr[0] > sx[0] * anorm[0] * cte)
+        *converged = 0;
+}
+
+// copies a device flag to the host (this synchronizes the stream)
+inline rocblas_int gesv_read_flag(hipStream_t stream, const rocblas_int* flag)
+{
+    rocblas_int h;
+    hipMemcpyAsync(&h, flag, sizeof(rocblas_int), hipMemcpyDeviceToHost, stream);
+    hipStreamSynchronize(stream);
+    return h;
+}
+
+
+template <typename T, typename S>
+void rocsolver_gesv_mixed_getMemorySize(const rocblas_int n, const rocblas_int nrhs, size_t *size)
+{
+    // quick return
+    if (n == 0 || nrhs == 0) {
+        *size = 0;
+        return;
+    }
+
+    // factorization and solves in both precisions
+    size_t s;
+    rocsolver_getrf_getMemorySize<S>(n,n,1,size);
+    rocsolver_getrs_getMemorySize<S>(n,nrhs,1,&s);
+    *size = std::max(*size,s);
+    rocsolver_getrf_getMemorySize<T>(n,n,1,&s);
+    *size = std::max(*size,s);
+    rocsolver_getrs_getMemorySize<T>(n,nrhs,1,&s);
+    *size = std::max(*size,s);
+
+    // low precision copies of A and B (or the residual), residual, partial row sums,
+    // norm of A and flag
+    size_t nparts = (n - 1) / GESV_NORM_COLS + 1;
+    *size += rocsolver_workspace_size<S>(size_t(n)*n);
+    *size += rocsolver_workspace_size<S>(size_t(n)*nrhs);
+    *size += rocsolver_workspace_size<T>(size_t(n)*nrhs);
+    *size += rocsolver_workspace_size<decltype(std::real(T(0)))>(size_t(n)*nparts);
+    *size += rocsolver_workspace_size<decltype(std::real(T(0)))>(1);
+    *size += rocsolver_workspace_size<rocblas_int>(1);
+}
+
+// Solves A*X = B factorizing A in the low precision S and refining the solution in the
+// working precision T. If the refinement does not converge (or the low precision
+// factorization fails), A is factorized in precision T instead.
+// The stream is synchronized after every refinement step to check convergence.
+template <typename T, typename S>
+rocblas_status rocsolver_gesv_mixed_template(rocblas_handle handle, const rocblas_int n, const rocblas_int nrhs,
+                                             T* A, const rocblas_int lda, rocblas_int* ipiv, T* B, const rocblas_int ldb,
+                                             T* X, const rocblas_int ldx, rocblas_int* iter, rocblas_int* info)
+{
+    using R = decltype(std::real(T(0)));
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return
+    if (n == 0 || nrhs == 0) {
+        hipLaunchKernelGGL(reset_info,dim3(1),dim3(1),0,stream,iter,1,0);
+        hipLaunchKernelGGL(reset_info,dim3(1),dim3(1),0,stream,info,1,0);
+        return rocblas_status_success;
+    }
+
+    //constants to use when calling rocablas functions
+    T* constants = rocsolver_constants<T>(handle);
+    if (!constants)
+        return rocblas_status_memory_error;
+    T* minoneInt = constants;     //constant -1 in device
+    T* oneInt = constants + 2;    //constant 1 in device
+
+    rocblas_int nparts = (n - 1) / GESV_NORM_COLS + 1;
+    rocsolver_workspace_frame frame(handle);
+    S* SA = frame.alloc<S>(size_t(n)*n);
+    S* SX = frame.alloc<S>(size_t(n)*nrhs);
+    T* Res = frame.alloc<T>(size_t(n)*nrhs);
+    R* sums = frame.alloc<R>(size_t(n)*nparts);
+    R* anorm = frame.alloc<R>(1);
+    rocblas_int* flag = frame.alloc<rocblas_int>(1);
+    if (!SA || !SX || !Res || !sums || !anorm || !flag)
+        return rocblas_status_memory_error;
+
+    rocblas_int blocks = (n - 1) / BLOCKSIZE + 1;
+    dim3 gridA(blocks, n, 1);
+    dim3 gridB(blocks, nrhs, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+    const R cte = std::numeric_limits<R>::epsilon() / 2 * sqrt(R(n));
+    rocblas_int result = -GESV_MIXED_ITERMAX - 1;    //iter if the refinement does not converge
+    rocblas_status status;
+
+    hipLaunchKernelGGL((gesv_norm_partial<GESV_NORM_COLS,T>),dim3(blocks,nparts),threads,0,stream,n,A,lda,sums);
+    hipLaunchKernelGGL((gesv_norm_max<BLOCKSIZE,R>),dim3(1),threads,0,stream,n,nparts,sums,anorm);
+
+    // convert A and B to the low precision
+    hipLaunchKernelGGL(reset_info,dim3(1),dim3(1),0,stream,flag,1,0);
+    hipLaunchKernelGGL(gesv_convert,gridA,threads,0,stream,n,n,A,lda,SA,n,flag);
+    hipLaunchKernelGGL(gesv_convert,gridB,threads,0,stream,n,nrhs,B,ldb,SX,n,flag);
+
+    if (gesv_read_flag(stream,flag))
+        result = -2;
+    else {
+        // factorize in low precision
+        status = rocsolver_getrf_template<false,false,true,S>(handle,n,n,SA,0,n,0,ipiv,0,0,info,1);
+        if (status != rocblas_status_success)
+            return status;
+
+        if (gesv_read_flag(stream,info))
+            result = -3;
+        else {
+            // solve in low precision and compute the residual R = B - A*X
+            status = rocsolver_getrs_template<S>(handle,rocblas_operation_none,n,nrhs,SA,0,n,0,ipiv,0,SX,0,n,0,1);
+            if (status != rocblas_status_success)
+                return status;
+            hipLaunchKernelGGL(gesv_convert,gridB,threads,0,stream,n,nrhs,SX,n,X,ldx,(rocblas_int*)nullptr);
+
+            for (rocblas_int it = 0; it <= GESV_MIXED_ITERMAX; ++it) {
+                if (it > 0) {
+                    // correct the solution with the low precision solve of A*D = R
+                    hipLaunchKernelGGL(reset_info,dim3(1),dim3(1),0,stream,flag,1,0);
+                    hipLaunchKernelGGL(gesv_convert,gridB,threads,0,stream,n,nrhs,Res,n,SX,n,flag);
+                    if (gesv_read_flag(stream,flag)) {
+                        result = -2;
+                        break;
+                    }
+                    status = rocsolver_getrs_template<S>(handle,rocblas_operation_none,n,nrhs,SA,0,n,0,ipiv,0,SX,0,n,0,1);
+                    if (status != rocblas_status_success)
+                        return status;
+                    hipLaunchKernelGGL(gesv_update,gridB,threads,0,stream,n,X,ldx,SX,n);
+                }
+
+                hipLaunchKernelGGL(gesv_convert,gridB,threads,0,stream,n,nrhs,B,ldb,Res,n,(rocblas_int*)nullptr);
+                rocblasCall_gemm<false,false,T>(handle, rocblas_operation_none, rocblas_operation_none,
+                                                n, nrhs, n, minoneInt,
+                                                A, 0, lda, 0,
+                                                X, 0, ldx, 0, oneInt,
+                                                Res, 0, n, 0, 1);
+
+                // check convergence
+                hipLaunchKernelGGL(reset_info,dim3(1),dim3(1),0,stream,flag,1,1);
+                hipLaunchKernelGGL((gesv_check_convergence<BLOCKSIZE,T>),dim3(nrhs),threads,0,stream,
+                                   n,X,ldx,Res,n,anorm,cte,flag);
+                if (gesv_read_flag(stream,flag)) {
+                    result = it;
+                    break;
+                }
+            }
+        }
+    }
+
+    hipLaunchKernelGGL(reset_info,dim3(1),dim3(1),0,stream,iter,1,result);
+    if (result >= 0)
+        return rocblas_status_success;
+
+    // fall back to the factorization in the working precision
+    status = rocsolver_getrf_template<false,false,true,T>(handle,n,n,A,0,lda,0,ipiv,0,0,info,1);
+    if (status != rocblas_status_success)
+        return status;
+    if (gesv_read_flag(stream,info))
+        return rocblas_status_success;
+
+    hipLaunchKernelGGL(gesv_convert,gridB,threads,0,stream,n,nrhs,B,ldb,X,ldx,(rocblas_int*)nullptr);
+    return rocsolver_getrs_template<T>(handle,rocblas_operation_none,n,nrhs,A,0,lda,0,ipiv,0,X,0,ldx,0,1);
+}
+
+#endif /* ROCLAPACK_GESV_MIXED_HPP */
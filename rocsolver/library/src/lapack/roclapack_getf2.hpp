@@ -15,32 +15,141 @@
 #include "rocsolver.h"
 #include "ideal_sizes.hpp"
 #include "common_device.hpp"
-#include "../auxiliary/rocauxiliary_laswp.hpp"
-
-template <typename T, typename U>
-__global__ void getf2_check_singularity(U AA, const rocblas_int shiftA, const rocblas_stride strideA,
-                                        rocblas_int* ipivA, const rocblas_int shiftP,
-                                        const rocblas_stride strideP, const rocblas_int j,
-                                        const rocblas_int lda,
-                                        T* invpivot, rocblas_int* info)
+#include "rocsolver_handle.hpp"
+
+// One step of getf2 on column j of each matrix in the batch (one block of DIM threads per matrix):
+// finds the pivot, checks singularity, swaps the pivot row with row j (all n columns)
+// and scales the entries below the diagonal. Only the rank-1 update is left to the caller.
+// If PIVOT is false, the diagonal element is the pivot and ipiv is not referenced.
+template <rocblas_int DIM, bool PIVOT, typename T, typename U>
+__global__ void getf2_pivot_column(const rocblas_int m, const rocblas_int n, U AA, const rocblas_int shiftA,
+                                   const rocblas_int lda, const rocblas_stride strideA, const rocblas_int j,
+                                   rocblas_int* ipivA, const rocblas_int shiftP, const rocblas_stride strideP,
+                                   rocblas_int* info)
 {
+    using S = decltype(aabs(T(0)));
+    __shared__ S sval[DIM];
+    __shared__ rocblas_int sidx[DIM];
+
     int id = hipBlockIdx_x;
+    int tid = hipThreadIdx_x;
 
     T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
-    rocblas_int *ipiv = ipivA + id*strideP + shiftP;
 
-    ipiv[j] += j;           //update the pivot index
-    if (A[j * lda + ipiv[j] - 1] == 0) {
-        invpivot[id] = 1.0;
-        if (info[id] == 0)
-           info[id] = j + 1;   //use Fortran 1-based indexing
+    // find pivot
+    rocblas_int piv = j;
+    if (PIVOT)
+        piv += block_iamax<DIM>(m - j, A + j + j*lda, 1, sval, sidx);
+    T pivot = A[piv + j*lda];
+
+    if (tid == 0) {
+        if (PIVOT)
+            ipivA[id*strideP + shiftP + j] = piv + 1;      //use Fortran 1-based indexing
+        if (pivot == 0 && info[id] == 0)
+            info[id] = j + 1;
+    }
+    __syncthreads();
+
+    // swap pivot row and j-th row
+    if (piv != j) {
+        for (rocblas_int k = tid; k < n; k += DIM) {
+            T temp = A[j + k*lda];
+            A[j + k*lda] = A[piv + k*lda];
+            A[piv + k*lda] = temp;
+        }
+        __syncthreads();
+    }
+
+    // compute elements j+1:m of j-th column (nothing is done if the pivot is zero)
+    if (pivot != 0) {
+        T invpivot = 1.0 / pivot;
+        for (rocblas_int i = j + 1 + tid; i < m; i += DIM)
+            A[i + j*lda] *= invpivot;
     }
-    else
-        invpivot[id] = 1.0 / A[j * lda + ipiv[j] - 1];
 }
 
 
-template <typename T, typename U>
+// LU factorization of a small matrix (m, n <= DIM) with partial pivoting (if PIVOT is true), entirely
+// in shared memory. One block of DIM threads per matrix: the matrix is loaded once, thread i owns row i
+// during the updates, and A, ipiv and info are written back at the end. The dynamic shared memory must
+// hold m*n entries of type T.
+template <rocblas_int DIM, bool PIVOT, typename T, typename U>
+__global__ void getf2_small(const rocblas_int m, const rocblas_int n, U AA, const rocblas_int shiftA,
+                            const rocblas_int lda, const rocblas_stride strideA,
+                            rocblas_int* ipivA, const rocblas_int shiftP, const rocblas_stride strideP,
+                            rocblas_int* info)
+{
+    using S = decltype(aabs(T(0)));
+    __shared__ S sval[DIM];
+    __shared__ rocblas_int sidx[DIM];
+    extern __shared__ double lmem[];
+    T* sA = reinterpret_cast<T*>(lmem);
+
+    int id = hipBlockIdx_x;
+    int tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+
+    // load the matrix (leading dimension m in shared memory)
+    for (rocblas_int k = tid; k < m*n; k += DIM)
+        sA[k] = A[k % m + (k / m)*lda];
+    __syncthreads();
+
+    rocblas_int singular = 0;
+    rocblas_int dim = min(m, n);
+    for (rocblas_int j = 0; j < dim; ++j) {
+        // find pivot
+        rocblas_int piv = j;
+        if (PIVOT)
+            piv += block_iamax<DIM>(m - j, sA + j + j*m, 1, sval, sidx);
+        T pivot = sA[piv + j*m];
+        if (PIVOT && tid == 0)
+            ipivA[id*strideP + shiftP + j] = piv + 1;      //use Fortran 1-based indexing
+        if (pivot == 0 && singular == 0)
+            singular = j + 1;
+        __syncthreads();
+
+        // swap pivot row and j-th row
+        if (piv != j) {
+            for (rocblas_int k = tid; k < n; k += DIM) {
+                T temp = sA[j + k*m];
+                sA[j + k*m] = sA[piv + k*m];
+                sA[piv + k*m] = temp;
+            }
+            __syncthreads();
+        }
+
+        // scale the j-th column and update the trailing submatrix (thread i updates row i)
+        if (tid > j && tid < m) {
+            T l = sA[tid + j*m];
+            if (pivot != 0) {
+                l *= T(1.0 / pivot);
+                sA[tid + j*m] = l;
+            }
+            for (rocblas_int k = j + 1; k < n; ++k)
+                sA[tid + k*m] -= l * sA[j + k*m];
+        }
+        __syncthreads();
+    }
+
+    // write back the factors
+    for (rocblas_int k = tid; k < m*n; k += DIM)
+        A[k % m + (k / m)*lda] = sA[k];
+    if (tid == 0)
+        info[id] = singular;
+}
+
+
+template <typename T>
+void rocsolver_getf2_getMemorySize(const rocblas_int m, const rocblas_int n, const rocblas_int batch_count, size_t *size)
+{
+    // no workspace needed
+    *size = 0;
+}
+
+// If PIVOT is false, no row interchanges are done (the LU factorization without pivoting)
+// and ipiv is not referenced.
+template <bool PIVOT, typename T, typename U>
 rocblas_status rocsolver_getf2_template(rocblas_handle handle, const rocblas_int m,
                                         const rocblas_int n, U A, const rocblas_int shiftA, const rocblas_int lda, 
                                         const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_int shiftP, 
@@ -49,62 +158,35 @@ rocblas_status rocsolver_getf2_template(rocblas_handle handle, const rocblas_int
     // quick return
     if (m == 0 || n == 0 || batch_count == 0) 
         return rocblas_status_success;
-        
-    // **** THIS SYNCHRONIZATION WILL BE REQUIRED UNTIL
-    //      IAMAX_BATCH FUNCTIONALITY IS ENABLED. ****
-    #ifdef batched
-        T* AA[batch_count];
-        hipMemcpy(AA, A, batch_count*sizeof(T*), hipMemcpyDeviceToHost);
-    #else
-        T* AA = A;
-    #endif
-
-    //constants to use when calling rocablas functions
-    rocblas_int oneInt = 1;       //constant 1 in host
-    T minone = -1;                //constant -1 in host
-    T* minoneInt;                 //constant -1 in device
-    hipMalloc(&minoneInt, sizeof(T));
-    hipMemcpy(minoneInt, &minone, sizeof(T), hipMemcpyHostToDevice);
-
-    // (TODO) THIS SHOULD BE DONE WITH THE HANDLE MEMORY ALLOCATOR
-    //pivoting info in device (to avoid continuous synchronization with CPU)
-    T *pivotGPU; 
-    hipMalloc(&pivotGPU, sizeof(T)*batch_count);
 
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
-    rocblas_int blocksPivot = (n - 1) / GETF2_BLOCKSIZE + 1;
+
+    // small matrices are factorized in shared memory with a single kernel
+    if (m <= GETF2_SMALL_SIZE && n <= GETF2_SMALL_SIZE && sizeof(T)*m*n <= GETF2_SMALL_LDS) {
+        hipLaunchKernelGGL((getf2_small<GETF2_SMALL_SIZE,PIVOT,T>), dim3(batch_count), dim3(GETF2_SMALL_SIZE),
+                  sizeof(T)*m*n, stream, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info);
+        return rocblas_status_success;
+    }
+
+    //constants to use when calling rocablas functions
+    T* constants = rocsolver_constants<T>(handle);
+    if (!constants)
+        return rocblas_status_memory_error;
+    T* minoneInt = constants;     //constant -1 in device
+
     rocblas_int blocksReset = (batch_count - 1) / GETF2_BLOCKSIZE + 1;
-    dim3 gridPivot(blocksPivot, batch_count, 1);
     dim3 gridReset(blocksReset, 1, 1);
     dim3 threads(GETF2_BLOCKSIZE, 1, 1);
     rocblas_int dim = min(m, n);    //total number of pivots
-    T* M;
 
     //info=0 (starting with a nonsingular matrix)
     hipLaunchKernelGGL(reset_info,gridReset,threads,0,stream,info,batch_count,0);
-    
-
-    // **** IAMAX_BATCH IS EXECUTED IN A FOR-LOOP UNTIL 
-    //      FUNCITONALITY IS ENABLED. ****
 
     for (rocblas_int j = 0; j < dim; ++j) {
-        // find pivot. Use Fortran 1-based indexing for the ipiv array as iamax does that as well!
-        for (int b=0;b<batch_count;++b) {
-            M = load_ptr_batch<T>(AA,b,shiftA,strideA);
-            rocblas_iamax(handle, m - j, (M + idx2D(j, j, lda)), 1, 
-                        (ipiv + shiftP + b*strideP + j));
-        }
-
-        // adjust pivot indices and check singularity
-        hipLaunchKernelGGL(getf2_check_singularity<T>, dim3(batch_count), dim3(1), 0, stream,
-                  A, shiftA, strideA, ipiv, shiftP, strideP, j, lda, pivotGPU, info);
-
-        // Swap pivot row and j-th row 
-        rocsolver_laswp_template<T>(handle, n, A, shiftA, lda, strideA, j+1, j+1, ipiv, shiftP, strideP, 1, batch_count);
-
-        // Compute elements J+1:M of J'th column
-        rocblasCall_scal<T>(handle, m-j-1, pivotGPU, 1, A, shiftA+idx2D(j+1, j, lda), 1, strideA, batch_count);
+        // find pivot, check singularity, swap rows and scale the column
+        hipLaunchKernelGGL((getf2_pivot_column<GETF2_BLOCKSIZE,PIVOT,T>), dim3(batch_count), threads, 0, stream,
+                  m, n, A, shiftA, lda, strideA, j, ipiv, shiftP, strideP, info);
 
         // update trailing submatrix
         if (j < min(m, n) - 1) {
@@ -116,9 +198,6 @@ rocblas_status rocsolver_getf2_template(rocblas_handle handle, const rocblas_int
         }
     }
 
-    hipFree(pivotGPU);
-    hipFree(minoneInt);
-
     return rocblas_status_success;
 }
 
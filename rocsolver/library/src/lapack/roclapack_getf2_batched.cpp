@@ -2,7 +2,6 @@
  * Copyright 2019-2020 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 
-#define batched
 #include "roclapack_getf2.hpp"
 
 template <typename T, typename U>
@@ -22,7 +21,16 @@ rocblas_status rocsolver_getf2_batched_impl(rocblas_handle handle, const rocblas
         return rocblas_status_invalid_size;
 
     rocblas_stride strideA = 0;
-    return rocsolver_getf2_template<T>(handle,m,n,
+    // memory management
+    size_t size;
+    rocsolver_getf2_getMemorySize<T>(m,n,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_getf2_template<true,T>(handle,m,n,
                                             A,0,    //the matrix is shifted 0 entries (will work on the entire matrix)
                                             lda, strideA,
                                             ipiv,0, //the vector is shifted 0 entries (will work on the entire vector)
@@ -64,5 +72,3 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zgetf2_batched(rocblas_handle handle,
 }
 
 } //extern C
-
-#undef batched
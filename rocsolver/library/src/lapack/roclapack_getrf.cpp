@@ -22,7 +22,16 @@ rocblas_status rocsolver_getrf_impl(rocblas_handle handle, const rocblas_int m,
     rocblas_stride strideP = 0;
     rocblas_int batch_count = 1;
 
-    return rocsolver_getrf_template<false,false,T>(handle,m,n,
+    // memory management
+    size_t size;
+    rocsolver_getrf_getMemorySize<T>(m,n,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_getrf_template<false,false,true,T>(handle,m,n,
                                                     A,0,    //The matrix is shifted 0 entries (will work on the entire matrix)
                                                     lda,strideA,
                                                     ipiv,0, //the vector is shifted 0 entries (will work on the entire vector)
@@ -15,6 +15,7 @@
 #include "rocsolver.h"
 #include "ideal_sizes.hpp"
 #include "common_device.hpp"
+#include "rocsolver_handle.hpp"
 #include "roclapack_getf2.hpp"
 #include "../auxiliary/rocauxiliary_laswp.hpp"
 
@@ -23,18 +24,442 @@ __global__ void getrf_check_singularity(const rocblas_int n, const rocblas_int j
                                 const rocblas_stride strideP, const rocblas_int *iinfo, rocblas_int *info) {
     int id = hipBlockIdx_y;
 
-    rocblas_int *ipiv = ipivA + id*strideP + shiftP;
-
     if (info[id] == 0 && iinfo[id] > 0)
         info[id] = iinfo[id] + j;
 
     int tid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
 
-    if (tid < n)
+    if (tid < n) {
+        rocblas_int *ipiv = ipivA + id*strideP + shiftP;
         ipiv[tid] += j;
+    }
+}
+
+// Partial pivoting on some rows of a panel with n columns (rows <= DIM).
+// The rows (srow, in shared memory) are copied to W (leading dimension DIM; thread i owns row i)
+// and factorized; on return srow[0:min(rows,n)-1] are the pivot rows, in the order they were chosen.
+template <rocblas_int DIM, typename T, typename S>
+__device__ rocblas_int getrf_tournament_select(const rocblas_int n, const rocblas_int rows, const T* A,
+                                               const rocblas_int lda, T* W, rocblas_int* srow,
+                                               S* sval, rocblas_int* sidx)
+{
+    int tid = hipThreadIdx_x;
+    __syncthreads();
+
+    // gather the rows
+    if (tid < rows) {
+        for (rocblas_int k = 0; k < n; ++k)
+            W[tid + k*DIM] = A[srow[tid] + k*lda];
+    }
+    __syncthreads();
+
+    rocblas_int dim = min(rows, n);
+    for (rocblas_int j = 0; j < dim; ++j) {
+        // find pivot and swap it with the j-th row
+        rocblas_int piv = j + block_iamax<DIM>(rows - j, W + j + j*DIM, 1, sval, sidx);
+        if (piv != j) {
+            for (rocblas_int k = tid; k < n; k += DIM) {
+                T temp = W[j + k*DIM];
+                W[j + k*DIM] = W[piv + k*DIM];
+                W[piv + k*DIM] = temp;
+            }
+            if (tid == 0) {
+                rocblas_int temp = srow[j];
+                srow[j] = srow[piv];
+                srow[piv] = temp;
+            }
+        }
+        __syncthreads();
+
+        // update the trailing rows (nothing is done if the pivot is zero)
+        T pivot = W[j + j*DIM];
+        if (tid > j && tid < rows && pivot != 0) {
+            T l = W[tid + j*DIM] * T(1.0 / pivot);
+            for (rocblas_int k = j + 1; k < n; ++k)
+                W[tid + k*DIM] -= l * W[j + k*DIM];
+        }
+        __syncthreads();
+    }
+
+    return dim;
+}
+
+// One round of tournament pivoting on an m-by-n panel (grid of groups-by-batch_count blocks of DIM threads).
+// In the first round (candIn = nullptr) block g takes chunks of DIM-n rows g, g+groups, g+2*groups, ...
+// and keeps the n pivot rows of each chunk together with the candidates of the previous chunks (flat tree).
+// In the following rounds block g merges the candidate sets 2g and 2g+1 of the previous round (binary tree).
+// Each matrix uses groups candidate sets of n rows in candIn/candOut (sizes in countIn/countOut),
+// and groups work matrices of DIM-by-n entries in work.
+template <rocblas_int DIM, typename T, typename U>
+__global__ void getrf_tournament(const rocblas_int m, const rocblas_int n, U AA, const rocblas_int shiftA,
+                                 const rocblas_int lda, const rocblas_stride strideA,
+                                 const rocblas_int* candIn, const rocblas_int* countIn, const rocblas_int setsIn,
+                                 rocblas_int* candOut, rocblas_int* countOut, const rocblas_int groups, T* work)
+{
+    using S = decltype(aabs(T(0)));
+    __shared__ S sval[DIM];
+    __shared__ rocblas_int sidx[DIM];
+    __shared__ rocblas_int srow[DIM];
+
+    int id = hipBlockIdx_y;
+    int g = hipBlockIdx_x;
+    int tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+    T* W = work + (size_t(id)*groups + g)*DIM*n;
+
+    rocblas_int cnt = 0;    //number of candidates in srow
+    if (candIn) {
+        const rocblas_int* cand = candIn + id*groups*n;
+        rocblas_int c0 = countIn[id*groups + 2*g];
+        rocblas_int c1 = (2*g + 1 < setsIn) ? countIn[id*groups + 2*g + 1] : 0;
+        if (tid < c0)
+            srow[tid] = cand[2*g*n + tid];
+        else if (tid < c0 + c1)
+            srow[tid] = cand[(2*g + 1)*n + tid - c0];
+        cnt = getrf_tournament_select<DIM>(n, c0 + c1, A, lda, W, srow, sval, sidx);
+    }
+    else {
+        rocblas_int chunk = DIM - n;
+        for (rocblas_int r = g*chunk; r < m; r += groups*chunk) {
+            rocblas_int rows = min(chunk, m - r);
+            if (tid < rows)
+                srow[cnt + tid] = r + tid;
+            cnt = getrf_tournament_select<DIM>(n, cnt + rows, A, lda, W, srow, sval, sidx);
+        }
+    }
+
+    if (tid < cnt)
+        candOut[id*groups*n + g*n + tid] = srow[tid];
+    if (tid == 0)
+        countOut[id*groups + g] = cnt;
 }
 
+// Converts the n pivot rows chosen by the tournament (0-based, in order) into the interchanges
+// of ipiv (1-based), so that laswp moves them to the top of the panel. One thread per matrix.
+// Rows that are moved away from the first n positions are kept in mpos/mrow.
+template <rocblas_int NMAX>
+__global__ void getrf_tournament_pivots(const rocblas_int n, const rocblas_int* candA, const rocblas_stride strideC,
+                                        rocblas_int* ipivA, const rocblas_int shiftP, const rocblas_stride strideP,
+                                        const rocblas_int batch_count)
+{
+    int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (b < batch_count) {
+        const rocblas_int* cand = candA + b*strideC;
+        rocblas_int* ipiv = ipivA + b*strideP + shiftP;
+        rocblas_int top[NMAX], mpos[NMAX], mrow[NMAX];
+        rocblas_int moved = 0;
+
+        for (rocblas_int k = 0; k < n; ++k)
+            top[k] = k;
+
+        for (rocblas_int k = 0; k < n; ++k) {
+            // find the current position p of the pivot row w
+            rocblas_int w = cand[k];
+            rocblas_int p = -1, q = -1;
+            for (rocblas_int i = k; i < n && p < 0; ++i) {
+                if (top[i] == w)
+                    p = i;
+            }
+            for (rocblas_int i = 0; i < moved && p < 0; ++i) {
+                if (mrow[i] == w) {
+                    p = mpos[i];
+                    q = i;
+                }
+            }
+            if (p < 0)
+                p = w;
+
+            // interchange rows k and p
+            ipiv[k] = p + 1;
+            if (p < n)
+                top[p] = top[k];
+            else if (q >= 0)
+                mrow[q] = top[k];
+            else {
+                mpos[moved] = p;
+                mrow[moved] = top[k];
+                moved++;
+            }
+            top[k] = w;
+        }
+    }
+}
+
+// number of blocks per matrix in the first round of tournament pivoting
+inline rocblas_int getrf_tournament_groups(const rocblas_int m, const rocblas_int n, const rocblas_int batch_count)
+{
+    rocblas_int chunks = (m - 1) / (GETRF_TOURNAMENT_ROWS - n) + 1;
+    return std::min(chunks, std::max(1, GETRF_TOURNAMENT_BLOCKS / batch_count));
+}
+
+// algorithm used to factorize an m-by-n panel
+inline rocblas_panel getrf_panel_algorithm(const rocblas_panel panel, const rocblas_int m, const rocblas_int n)
+{
+    if (panel == rocblas_panel_tournament && m >= GETRF_TOURNAMENT_MINROWS && 2*n <= GETRF_TOURNAMENT_ROWS)
+        return rocblas_panel_tournament;
+    if (panel == rocblas_panel_recursive || (panel != rocblas_panel_unblocked && m >= GETRF_RECURSIVE_MINROWS))
+        return rocblas_panel_recursive;
+    return rocblas_panel_unblocked;
+}
+
+template <typename T>
+void rocsolver_getrf_panel_getMemorySize(const rocblas_int m, const rocblas_int n, const rocblas_int batch_count, size_t *size)
+{
+    // iinfo of every level of the recursion + trsm
+    *size = 0;
+    for (rocblas_int nn = n; nn > GETRF_RECURSIVE_BASESIZE; nn -= nn / 2)
+        *size += rocsolver_workspace_size<rocblas_int>(batch_count);
+    if (n > GETRF_RECURSIVE_BASESIZE)
+        *size += rocblasCall_trsm_memsize<T>(batch_count);
+
+    // work matrices + 2 sets of candidates and their sizes + trsm (for tournament pivoting)
+    if (m >= GETRF_TOURNAMENT_MINROWS && 2*n <= GETRF_TOURNAMENT_ROWS) {
+        size_t groups = getrf_tournament_groups(m,n,batch_count);
+        size_t s = rocsolver_workspace_size<T>(groups*GETRF_TOURNAMENT_ROWS*n*batch_count);
+        s += rocsolver_workspace_size<rocblas_int>(2*groups*n*batch_count);
+        s += rocsolver_workspace_size<rocblas_int>(2*groups*batch_count);
+        s += rocblasCall_trsm_memsize<T>(batch_count);
+        *size = std::max(*size,s);
+    }
+}
+
+template <typename T>
+void rocsolver_getrf_getMemorySize(const rocblas_int m, const rocblas_int n, const rocblas_int batch_count, size_t *size)
+{
+    rocsolver_getf2_getMemorySize<T>(m,n,batch_count,size);
+
+    // iinfo + max(getf2, recursive panel, trsm) (for the blocked variant)
+    if (m >= GETRF_GETF2_SWITCHSIZE && n >= GETRF_GETF2_SWITCHSIZE) {
+        size_t s;
+        rocsolver_getrf_panel_getMemorySize<T>(m,GETRF_GETF2_SWITCHSIZE,batch_count,&s);
+        *size = std::max(*size,s);
+        *size = std::max(*size,rocblasCall_trsm_memsize<T>(batch_count));
+        *size += rocsolver_workspace_size<rocblas_int>(batch_count);
+
+        // + compacted batch (pointers, positions and count) for early exit
+        if (batch_count > 1)
+            *size += rocsolver_workspace_size<T*>(batch_count) + rocsolver_workspace_size<rocblas_int>(batch_count)
+                     + rocsolver_workspace_size<rocblas_int>(1);
+    }
+}
+
+// Recursive LU factorization of an m-by-n panel (m >= n): the left half is factorized, 
+// the right half is updated with trsm and gemm, and then factorized in turn.
+// Pivot indices and info are relative to the panel (as returned by getf2).
+// If PIVOT is false, no row interchanges are done and ipiv is not referenced.
+template <bool BATCHED, bool STRIDED, bool PIVOT, typename T, typename U>
+rocblas_status rocsolver_getrf_recursive_panel(rocblas_handle handle, const rocblas_int m,
+                                        const rocblas_int n, U A, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                                        rocblas_int *ipiv, const rocblas_int shiftP, const rocblas_stride strideP, rocblas_int *info, const rocblas_int batch_count) {
+    // base case
+    if (n <= GETRF_RECURSIVE_BASESIZE || m < n)
+        return rocsolver_getf2_template<PIVOT,T>(handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count);
+
+    //constants to use when calling rocablas functions
+    T* constants = rocsolver_constants<T>(handle);
+    if (!constants)
+        return rocblas_status_memory_error;
+    T* minoneInt = constants;     //constant -1 in device
+    T* oneInt = constants + 2;    //constant 1 in device
+
+    //info of the right half
+    rocsolver_workspace_frame frame(handle);
+    rocblas_int *iinfo = frame.alloc<rocblas_int>(batch_count);
+    if (!iinfo)
+        return rocblas_status_memory_error;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+    rocblas_int n1 = n / 2;
+    rocblas_int n2 = n - n1;
+    rocblas_status status;
+
+    // factorize left half
+    status = rocsolver_getrf_recursive_panel<BATCHED,STRIDED,PIVOT,T>(handle, m, n1, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count);
+    if (status != rocblas_status_success)
+        return status;
+
+    // apply interchanges to the right half
+    if (PIVOT)
+        rocsolver_laswp_template<T>(handle, n2, A, shiftA + idx2D(0, n1, lda), lda, strideA, 1, n1, ipiv, shiftP, strideP, 1, batch_count);
+
+    // compute block row of U
+    rocblasCall_trsm<T>(handle, rocblas_side_left, rocblas_fill_lower, rocblas_operation_none,
+                        rocblas_diagonal_unit, n1, n2, oneInt,
+                        A, shiftA, lda, strideA, 
+                        A, shiftA+idx2D(0, n1, lda), lda, strideA, batch_count);
+
+    // update the rest of the right half
+    rocblasCall_gemm<BATCHED,STRIDED,T>(handle, rocblas_operation_none, rocblas_operation_none,
+                                    m - n1, n2, n1, minoneInt,
+                                    A, shiftA+idx2D(n1, 0, lda), lda, strideA,
+                                    A, shiftA+idx2D(0, n1, lda), lda, strideA, oneInt,
+                                    A, shiftA+idx2D(n1, n1, lda), lda, strideA, batch_count);
+
+    // factorize right half
+    status = rocsolver_getrf_recursive_panel<BATCHED,STRIDED,PIVOT,T>(handle, m - n1, n2, A, shiftA + idx2D(n1, n1, lda), lda, strideA, 
+                                                                ipiv, shiftP + n1, strideP, iinfo, batch_count);
+    if (status != rocblas_status_success)
+        return status;
+
+    // adjust pivot indices and check singularity
+    rocblas_int sizePivot = min(m - n1, n2);     //number of pivots in the right half
+    rocblas_int blocksPivot = (sizePivot - 1) / GETF2_BLOCKSIZE + 1; 
+    dim3 gridPivot(blocksPivot, batch_count, 1);
+    dim3 threads(GETF2_BLOCKSIZE, 1, 1);
+    hipLaunchKernelGGL(getrf_check_singularity<U>,gridPivot,threads,0,stream,
+                       PIVOT ? sizePivot : 0,n1,ipiv,shiftP + n1,strideP,iinfo,info);
+
+    // apply interchanges to the left half
+    if (PIVOT)
+        rocsolver_laswp_template<T>(handle, n1, A, shiftA, lda, strideA, n1 + 1, n1 + sizePivot, ipiv, shiftP, strideP, 1, batch_count);
+
+    return rocblas_status_success;
+}
+
+// LU factorization of an m-by-n panel (m >= n) with tournament pivoting: the n pivot rows are
+// chosen by getrf_tournament, moved to the top, and the panel is then factorized without pivoting
+// (getf2 on the top block and trsm on the rest). Pivot indices and info are relative to the panel.
 template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_getrf_tournament_panel(rocblas_handle handle, const rocblas_int m,
+                                        const rocblas_int n, U A, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                                        rocblas_int *ipiv, const rocblas_int shiftP, const rocblas_stride strideP, rocblas_int *info, const rocblas_int batch_count) {
+    //constants to use when calling rocablas functions
+    T* constants = rocsolver_constants<T>(handle);
+    if (!constants)
+        return rocblas_status_memory_error;
+    T* oneInt = constants + 2;    //constant 1 in device
+
+    //work matrices and candidate sets (two of them, for the input and output of each round)
+    rocblas_int groups = getrf_tournament_groups(m,n,batch_count);
+    size_t sizeC = size_t(groups)*n*batch_count;
+    size_t sizeN = size_t(groups)*batch_count;
+    rocsolver_workspace_frame frame(handle);
+    T *work = frame.alloc<T>(size_t(GETRF_TOURNAMENT_ROWS)*sizeC);
+    rocblas_int *cand = frame.alloc<rocblas_int>(2*sizeC);
+    rocblas_int *count = frame.alloc<rocblas_int>(2*sizeN);
+    if (!work || !cand || !count)
+        return rocblas_status_memory_error;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+    dim3 threads(GETRF_TOURNAMENT_ROWS, 1, 1);
+
+    // choose the pivot rows: flat tree over the row chunks of each block...
+    hipLaunchKernelGGL((getrf_tournament<GETRF_TOURNAMENT_ROWS,T>),dim3(groups,batch_count,1),threads,0,stream,
+                       m,n,A,shiftA,lda,strideA,(rocblas_int*)nullptr,(rocblas_int*)nullptr,0,cand,count,groups,work);
+
+    // ...and binary tree among the blocks
+    rocblas_int sets = groups;
+    rocblas_int cur = 0;
+    while (sets > 1) {
+        rocblas_int half = (sets + 1) / 2;
+        hipLaunchKernelGGL((getrf_tournament<GETRF_TOURNAMENT_ROWS,T>),dim3(half,batch_count,1),threads,0,stream,
+                           m,n,A,shiftA,lda,strideA,cand + cur*sizeC,count + cur*sizeN,sets,
+                           cand + (1-cur)*sizeC,count + (1-cur)*sizeN,groups,work);
+        cur = 1 - cur;
+        sets = half;
+    }
+
+    // move the pivot rows to the top
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+    hipLaunchKernelGGL(getrf_tournament_pivots<GETRF_TOURNAMENT_ROWS/2>,dim3(blocksReset),dim3(BLOCKSIZE),0,stream,
+                       n,cand + cur*sizeC,groups*n,ipiv,shiftP,strideP,batch_count);
+    rocsolver_laswp_template<T>(handle, n, A, shiftA, lda, strideA, 1, n, ipiv, shiftP, strideP, 1, batch_count);
+
+    // factorize the panel without pivoting
+    rocblas_status status = rocsolver_getf2_template<false,T>(handle, n, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count);
+    if (status != rocblas_status_success)
+        return status;
+
+    rocblasCall_trsm<T>(handle, rocblas_side_right, rocblas_fill_upper, rocblas_operation_none,
+                        rocblas_diagonal_non_unit, m - n, n, oneInt,
+                        A, shiftA, lda, strideA,
+                        A, shiftA+idx2D(n, 0, lda), lda, strideA, batch_count);
+
+    return rocblas_status_success;
+}
+
+// factorization of the panel with the selected algorithm
+template <bool BATCHED, bool STRIDED, bool PIVOT, typename T, typename U>
+rocblas_status rocsolver_getrf_panel_template(rocblas_handle handle, const rocblas_panel panel, const rocblas_int m,
+                                        const rocblas_int n, U A, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                                        rocblas_int *ipiv, const rocblas_int shiftP, const rocblas_stride strideP, rocblas_int *info, const rocblas_int batch_count) {
+    if (PIVOT && panel == rocblas_panel_tournament)
+        return rocsolver_getrf_tournament_panel<BATCHED,STRIDED,T>(handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count);
+    else if (panel != rocblas_panel_unblocked)
+        return rocsolver_getrf_recursive_panel<BATCHED,STRIDED,PIVOT,T>(handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count);
+    else
+        return rocsolver_getf2_template<PIVOT,T>(handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count);
+}
+
+// Block row of U (columns j+jb : n-1) and update of the trailing matrix after the panel at column j, for the
+// matrices in AU (the whole batch A, or the compacted batch of early exit, with active matrices). With a side
+// stream (look-ahead), the next block column (jn columns) is updated first and factorized on the side stream,
+// for the whole batch A, while the rest of the trailing matrix is updated; the main stream must then wait for
+// side->done before using the next panel.
+template <bool BATCHED, bool STRIDED, bool UBATCHED, bool USTRIDED, bool PIVOT, typename T, typename U, typename V>
+rocblas_status rocsolver_getrf_trailing_update(rocblas_handle handle, const rocsolver_side_stream* side, const rocblas_panel panel,
+                                        const rocblas_int m, const rocblas_int n, const rocblas_int j, const rocblas_int jb,
+                                        const rocblas_int jn, U A, const rocblas_int shiftA, const rocblas_int lda,
+                                        const rocblas_stride strideA, rocblas_int *ipiv, const rocblas_int shiftP,
+                                        const rocblas_stride strideP, rocblas_int *iinfo, const rocblas_int batch_count,
+                                        V AU, const rocblas_int active, T* oneInt, T* minoneInt) {
+    // compute block row of U
+    rocblasCall_trsm<T>(handle, rocblas_side_left, rocblas_fill_lower, rocblas_operation_none,
+                        rocblas_diagonal_unit, jb, (n - j - jb), oneInt,
+                        AU, shiftA+idx2D(j, j, lda), lda, strideA, 
+                        AU, shiftA+idx2D(j, j + jb, lda), lda, strideA, active);
+
+    if (j + jb >= m)
+        return rocblas_status_success;
+
+    // update trailing submatrix
+    if (!side) {
+        rocblasCall_gemm<UBATCHED,USTRIDED,T>(handle, rocblas_operation_none, rocblas_operation_none,
+                                        m - j - jb, n - j - jb, jb, minoneInt,
+                                        AU, shiftA+idx2D(j + jb, j, lda), lda, strideA,
+                                        AU, shiftA+idx2D(j, j + jb, lda), lda, strideA, oneInt,
+                                        AU, shiftA+idx2D(j + jb, j + jb, lda), lda, strideA, active);
+        return rocblas_status_success;
+    }
+
+    // the next block first...
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+    rocblasCall_gemm<UBATCHED,USTRIDED,T>(handle, rocblas_operation_none, rocblas_operation_none,
+                                    m - j - jb, jn, jb, minoneInt,
+                                    AU, shiftA+idx2D(j + jb, j, lda), lda, strideA,
+                                    AU, shiftA+idx2D(j, j + jb, lda), lda, strideA, oneInt,
+                                    AU, shiftA+idx2D(j + jb, j + jb, lda), lda, strideA, active);
+
+    // ...factorize it on the side stream...
+    hipEventRecord(side->ready, stream);
+    hipStreamWaitEvent(side->stream, side->ready, 0);
+    rocblas_status status = rocsolver_getrf_panel_template<BATCHED,STRIDED,PIVOT,T>(side->handle, getrf_panel_algorithm(panel, m - j - jb, jn),
+                                                                              m - j - jb, jn, 
+                                                                              A, shiftA + idx2D(j + jb, j + jb, lda), lda, strideA, 
+                                                                              ipiv, shiftP + j + jb, strideP, iinfo, batch_count);
+    hipEventRecord(side->done, side->stream);
+    if (status != rocblas_status_success) {
+        // join the streams before leaving (part of the panel may have been launched)
+        hipStreamWaitEvent(stream, side->done, 0);
+        return status;
+    }
+
+    // ...while the rest is updated
+    rocblasCall_gemm<UBATCHED,USTRIDED,T>(handle, rocblas_operation_none, rocblas_operation_none,
+                                    m - j - jb, n - j - jb - jn, jb, minoneInt,
+                                    AU, shiftA+idx2D(j + jb, j, lda), lda, strideA,
+                                    AU, shiftA+idx2D(j, j + jb + jn, lda), lda, strideA, oneInt,
+                                    AU, shiftA+idx2D(j + jb, j + jb + jn, lda), lda, strideA, active);
+
+    return rocblas_status_success;
+}
+
+template <bool BATCHED, bool STRIDED, bool PIVOT, typename T, typename U>
 rocblas_status rocsolver_getrf_template(rocblas_handle handle, const rocblas_int m,
                                         const rocblas_int n, U A, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
                                         rocblas_int *ipiv, const rocblas_int shiftP, const rocblas_stride strideP, rocblas_int *info, const rocblas_int batch_count) {
@@ -44,33 +469,20 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle, const rocblas_int
 
     // if the matrix is small, use the unblocked (BLAS-levelII) variant of the algorithm
     if (m < GETRF_GETF2_SWITCHSIZE || n < GETRF_GETF2_SWITCHSIZE) 
-        return rocsolver_getf2_template<T>(handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count);
-
-    // **** THIS SYNCHRONIZATION WILL BE REQUIRED UNTIL
-    //      TRSM_BATCH FUNCTIONALITY IS ENABLED. ****
-    #ifdef batched
-        T* AA[batch_count];
-        hipMemcpy(AA, A, batch_count*sizeof(T*), hipMemcpyDeviceToHost);
-    #else
-        T* AA = A;
-    #endif
-    
+        return rocsolver_getf2_template<PIVOT,T>(handle, m, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, info, batch_count);
+
     //constants to use when calling rocablas functions
-    T one = 1;                    //constant 1 in host
-    T minone = -1;                //constant -1 in host
-    T* minoneInt;                 //constant -1 in device
-    T* oneInt;                    //constant 1 in device
-    hipMalloc(&minoneInt, sizeof(T));
-    hipMemcpy(minoneInt, &minone, sizeof(T), hipMemcpyHostToDevice);
-    hipMalloc(&oneInt, sizeof(T));
-    hipMemcpy(oneInt, &one, sizeof(T), hipMemcpyHostToDevice);
-
-    // (TODO) THIS SHOULD BE DONE WITH THE HANDLE MEMORY ALLOCATOR
-    //pivoting info in device (to avoid continuous synchronization with CPU)
-    T *pivotGPU;
-    hipMalloc(&pivotGPU, sizeof(T)*batch_count);
-    rocblas_int *iinfo;
-    hipMalloc(&iinfo, sizeof(rocblas_int)*batch_count);
+    T* constants = rocsolver_constants<T>(handle);
+    if (!constants)
+        return rocblas_status_memory_error;
+    T* minoneInt = constants;     //constant -1 in device
+    T* oneInt = constants + 2;    //constant 1 in device
+
+    //info of the panel factorizations in device (to avoid synchronization with CPU)
+    rocsolver_workspace_frame frame(handle);
+    rocblas_int *iinfo = frame.alloc<rocblas_int>(batch_count);
+    if (!iinfo)
+        return rocblas_status_memory_error;
 
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
@@ -80,61 +492,94 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle, const rocblas_int
     dim3 gridReset(blocksReset, 1, 1);
     dim3 threads(GETF2_BLOCKSIZE, 1, 1);
     rocblas_int dim = min(m, n);    //total number of pivots
-    T* M;
-    rocblas_int jb, sizePivot;
+    rocblas_int jb, jn, sizePivot;
+    rocblas_panel panel = rocsolver_getrf_panel(handle);
+    rocblas_status status;
+
+    // with early exit, the trailing matrices are only updated for the matrices of the batch that are 
+    // still nonsingular (the panels and interchanges are applied to all of them). The compacted batch
+    // is rebuilt every EARLY_EXIT_INTERVAL panels, as this synchronizes the stream; in between, the
+    // matrices that fail are still updated
+    bool early = rocsolver_early_exit(handle) && batch_count > 1;
+    rocblas_int active = batch_count;
+    T** Aarr = nullptr;
+    rocblas_int *idx = nullptr;
+    rocblas_int *count = nullptr;
+    if (early) {
+        Aarr = frame.alloc<T*>(batch_count);
+        idx = frame.alloc<rocblas_int>(batch_count);
+        count = frame.alloc<rocblas_int>(1);
+        if (!Aarr || !idx || !count)
+            return rocblas_status_memory_error;
+    }
+
+    // with look-ahead, the next panel is factorized on the side stream
+    // while the rest of the trailing matrix is updated
+    const rocsolver_side_stream* side = rocsolver_getrf_lookahead(handle) ? rocsolver_get_side_stream(handle) : nullptr;
+    bool factorized = false;    //true if the current panel was already factorized on the side stream
 
     //info=0 (starting with a nonsingular matrix)
     hipLaunchKernelGGL(reset_info,gridReset,threads,0,stream,info,batch_count,0);
 
-    // **** TRSM_BATCH IS EXECUTED IN A FOR-LOOP UNTIL 
-    //      FUNCITONALITY IS ENABLED. ****
-
     for (rocblas_int j = 0; j < dim; j += GETRF_GETF2_SWITCHSIZE) {
         // Factor diagonal and subdiagonal blocks 
         jb = min(dim - j, GETRF_GETF2_SWITCHSIZE);  //number of columns in the block
-        hipLaunchKernelGGL(reset_info,gridReset,threads,0,stream,iinfo,batch_count,0);
-        rocsolver_getf2_template<T>(handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, ipiv, shiftP + j, strideP, iinfo, batch_count);
+        if (factorized) {
+            hipStreamWaitEvent(stream, side->done, 0);
+            factorized = false;
+        }
+        else {
+            status = rocsolver_getrf_panel_template<BATCHED,STRIDED,PIVOT,T>(handle, getrf_panel_algorithm(panel, m - j, jb), m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, 
+                                                                       ipiv, shiftP + j, strideP, iinfo, batch_count);
+            if (status != rocblas_status_success)
+                return status;
+        }
         
         // adjust pivot indices and check singularity
         sizePivot = min(m - j, jb);     //number of pivots in the block
         blocksPivot = (sizePivot - 1) / GETF2_BLOCKSIZE + 1; 
         gridPivot = dim3(blocksPivot, batch_count, 1);
         hipLaunchKernelGGL(getrf_check_singularity<U>,gridPivot,threads,0,stream,
-			   sizePivot,j,ipiv,shiftP + j,strideP,iinfo,info);
+			   PIVOT ? sizePivot : 0,j,ipiv,shiftP + j,strideP,iinfo,info);
 
         // apply interchanges to columns 1 : j-1
-        rocsolver_laswp_template<T>(handle, j, A, shiftA, lda, strideA, j + 1, j + jb, ipiv, shiftP, strideP, 1, batch_count);
+        if (PIVOT)
+            rocsolver_laswp_template<T>(handle, j, A, shiftA, lda, strideA, j + 1, j + jb, ipiv, shiftP, strideP, 1, batch_count);
 
         if (j + jb < n) {
             // apply interchanges to columns j+jb : n
-            rocsolver_laswp_template<T>(handle, (n - j - jb), A,
-                                  shiftA + idx2D(0, j + jb, lda), lda, strideA, j + 1, j + jb,
-                                  ipiv, shiftP, strideP, 1, batch_count);
-
-            // compute block row of U
-            for (int b=0;b<batch_count;++b) {
-                M = load_ptr_batch<T>(AA,b,shiftA,strideA);
-                rocblas_trsm(handle, rocblas_side_left, rocblas_fill_lower, rocblas_operation_none,
-                             rocblas_diagonal_unit, jb, (n - j - jb), oneInt,
-                             (M + idx2D(j, j, lda)), lda, (M + idx2D(j, j + jb, lda)), lda);
-            }
+            if (PIVOT)
+                rocsolver_laswp_template<T>(handle, (n - j - jb), A,
+                                      shiftA + idx2D(0, j + jb, lda), lda, strideA, j + 1, j + jb,
+                                      ipiv, shiftP, strideP, 1, batch_count);
 
-            // update trailing submatrix
-            if (j + jb < m) {
-                rocblasCall_gemm<BATCHED,STRIDED,T>(handle, rocblas_operation_none, rocblas_operation_none,
-                                                m - j - jb, n - j - jb, jb, minoneInt,
-                                                A, shiftA+idx2D(j + jb, j, lda), lda, strideA,
-                                                A, shiftA+idx2D(j, j + jb, lda), lda, strideA, oneInt,
-                                                A, shiftA+idx2D(j + jb, j + jb, lda), lda, strideA, batch_count);
+            jn = min(dim - j - jb, GETRF_GETF2_SWITCHSIZE);  //number of columns in the next block
+            const rocsolver_side_stream* ahead = (j + jb < m && jn > 0 && n - j - jb > jn) ? side : nullptr;
+            if (early) {
+                // compute block row of U and update trailing submatrix of the nonsingular matrices
+                if ((j / GETRF_GETF2_SWITCHSIZE) % EARLY_EXIT_INTERVAL == 0)
+                    active = rocsolver_compact_batch<T>(stream, A, strideA, info, Aarr, idx, count, batch_count);
+                if (active > 0)
+                    status = rocsolver_getrf_trailing_update<BATCHED,STRIDED,true,false,PIVOT,T>(handle, ahead, panel, m, n, j, jb, jn,
+                                                                   A, shiftA, lda, strideA, ipiv, shiftP, strideP, iinfo, batch_count,
+                                                                   cast2constPointer<T>(Aarr), active, oneInt, minoneInt);
+                else {
+                    status = rocblas_status_success;
+                    ahead = nullptr;
+                }
+            }
+            else {
+                // compute block row of U and update trailing submatrix
+                status = rocsolver_getrf_trailing_update<BATCHED,STRIDED,BATCHED,STRIDED,PIVOT,T>(handle, ahead, panel, m, n, j, jb, jn,
+                                                                   A, shiftA, lda, strideA, ipiv, shiftP, strideP, iinfo, batch_count,
+                                                                   A, batch_count, oneInt, minoneInt);
             }
+            if (status != rocblas_status_success)
+                return status;
+            factorized = (ahead != nullptr);
         } 
     }
 
-    hipFree(pivotGPU);
-    hipFree(minoneInt);
-    hipFree(oneInt);
-    hipFree(iinfo);
-
     return rocblas_status_success;
 }
 
@@ -2,7 +2,6 @@
  * Copyright 2019-2020 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 
-#define batched
 #include "roclapack_getrf.hpp"
 
 template <typename T, typename U>
@@ -21,7 +20,16 @@ rocblas_status rocsolver_getrf_batched_impl(rocblas_handle handle, rocblas_int m
 
     rocblas_stride strideA = 0;
 
-    return rocsolver_getrf_template<true,false,T>(handle,m,n,
+    // memory management
+    size_t size;
+    rocsolver_getrf_getMemorySize<T>(m,n,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_getrf_template<true,false,true,T>(handle,m,n,
                                                     A,0,    //The matrix is shifted 0 entries (will work on the entire matrix)
                                                     lda,strideA,
                                                     ipiv,0, //the vector is shifted 0 entries (will work on the entire vector)
@@ -63,5 +71,3 @@ ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_batched(rocblas_handle handle,
 }
 
 } //extern C
-
-#undef batched
@@ -0,0 +1,72 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_getrf.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_getrf_npvt_batched_impl(rocblas_handle handle, rocblas_int m,
+                                        rocblas_int n, U A, rocblas_int lda, 
+                                        rocblas_int* info, rocblas_int batch_count) {
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    
+    //logging is missing ???    
+
+    if (m < 0 || n < 0 || batch_count < 0 || lda < m) 
+        return rocblas_status_invalid_size;
+    if (!A || !info)
+        return rocblas_status_invalid_pointer;
+
+    rocblas_stride strideA = 0;
+
+    // memory management
+    size_t size;
+    rocsolver_getrf_getMemorySize<T>(m,n,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_getrf_template<true,false,false,T>(handle,m,n,
+                                                    A,0,    //The matrix is shifted 0 entries (will work on the entire matrix)
+                                                    lda,strideA,
+                                                    nullptr,0,0,    //no pivots
+                                                    info,batch_count);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_npvt_batched(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 float *const A[], const rocblas_int lda, rocblas_int* info, const rocblas_int batch_count) 
+{
+    return rocsolver_getrf_npvt_batched_impl<float>(handle, m, n, A, lda, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_npvt_batched(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 double *const A[], const rocblas_int lda, rocblas_int* info, const rocblas_int batch_count) 
+{
+    return rocsolver_getrf_npvt_batched_impl<double>(handle, m, n, A, lda, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_npvt_batched(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 rocblas_float_complex *const A[], const rocblas_int lda, rocblas_int* info, const rocblas_int batch_count) 
+{
+    return rocsolver_getrf_npvt_batched_impl<rocblas_float_complex>(handle, m, n, A, lda, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_npvt_batched(rocblas_handle handle, const rocblas_int m, const rocblas_int n,
+                 rocblas_double_complex *const A[], const rocblas_int lda, rocblas_int* info, const rocblas_int batch_count) 
+{
+    return rocsolver_getrf_npvt_batched_impl<rocblas_double_complex>(handle, m, n, A, lda, info, batch_count);
+}
+
+} //extern C
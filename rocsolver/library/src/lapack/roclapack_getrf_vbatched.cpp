@@ -0,0 +1,74 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_vbatched.hpp"
+
+template <typename T>
+rocblas_status rocsolver_getrf_vbatched_impl(rocblas_handle handle, const rocblas_int *m, const rocblas_int *n,
+                                             T *const A[], const rocblas_int *lda, rocblas_int *const ipiv[],
+                                             rocblas_int* info, const rocblas_int batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    //logging is missing ???
+
+    if (batch_count < 0)
+        return rocblas_status_invalid_size;
+    if (!m || !n || !A || !lda || !ipiv || !info)
+        return rocblas_status_invalid_pointer;
+
+    // group the matrices by size
+    std::vector<rocsolver_vbatch_group> groups;
+    std::vector<rocblas_int> order;
+    rocblas_status status = rocsolver_vbatch_groups(handle,m,n,lda,batch_count,groups,order);
+    if (status != rocblas_status_success)
+        return status;
+
+    // memory management
+    size_t size;
+    rocsolver_getrf_vbatched_getMemorySize<T>(groups,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_getrf_vbatched_template<T>(handle,groups,order,A,lda,ipiv,info,batch_count);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetrf_vbatched(rocblas_handle handle, const rocblas_int *m, const rocblas_int *n,
+                 float *const A[], const rocblas_int *lda, rocblas_int *const ipiv[], rocblas_int* info, const rocblas_int batch_count)
+{
+    return rocsolver_getrf_vbatched_impl<float>(handle, m, n, A, lda, ipiv, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetrf_vbatched(rocblas_handle handle, const rocblas_int *m, const rocblas_int *n,
+                 double *const A[], const rocblas_int *lda, rocblas_int *const ipiv[], rocblas_int* info, const rocblas_int batch_count)
+{
+    return rocsolver_getrf_vbatched_impl<double>(handle, m, n, A, lda, ipiv, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetrf_vbatched(rocblas_handle handle, const rocblas_int *m, const rocblas_int *n,
+                 rocblas_float_complex *const A[], const rocblas_int *lda, rocblas_int *const ipiv[], rocblas_int* info, const rocblas_int batch_count)
+{
+    return rocsolver_getrf_vbatched_impl<rocblas_float_complex>(handle, m, n, A, lda, ipiv, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetrf_vbatched(rocblas_handle handle, const rocblas_int *m, const rocblas_int *n,
+                 rocblas_double_complex *const A[], const rocblas_int *lda, rocblas_int *const ipiv[], rocblas_int* info, const rocblas_int batch_count)
+{
+    return rocsolver_getrf_vbatched_impl<rocblas_double_complex>(handle, m, n, A, lda, ipiv, info, batch_count);
+}
+
+} //extern C
@@ -0,0 +1,75 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_getri.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_getri_impl(rocblas_handle handle, const rocblas_int n, U A, const rocblas_int lda,
+                                        const rocblas_int *ipiv, rocblas_int* info) {
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    
+    //logging is missing ???    
+
+    if (n < 0 || lda < n) 
+        return rocblas_status_invalid_size;
+    if (!A || !ipiv || !info)
+        return rocblas_status_invalid_pointer;
+
+    rocblas_stride strideA = 0;
+    rocblas_stride strideP = 0;
+    rocblas_int batch_count = 1;
+
+    // memory management
+    size_t size;
+    rocsolver_getri_getMemorySize<T>(n,lda,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_getri_template<false,false,T>(handle,n,
+                                                A,0,    //The matrix is shifted 0 entries (will work on the entire matrix)
+                                                lda,strideA,
+                                                ipiv,0, //the vector is shifted 0 entries (will work on the entire vector)
+                                                strideP,
+                                                A,0,lda,strideA,    //the inverse overwrites A
+                                                true,info,batch_count);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetri(rocblas_handle handle, const rocblas_int n,
+                 float *A, const rocblas_int lda, const rocblas_int *ipiv, rocblas_int* info) 
+{
+    return rocsolver_getri_impl<float>(handle, n, A, lda, ipiv, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetri(rocblas_handle handle, const rocblas_int n,
+                 double *A, const rocblas_int lda, const rocblas_int *ipiv, rocblas_int* info) 
+{
+    return rocsolver_getri_impl<double>(handle, n, A, lda, ipiv, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetri(rocblas_handle handle, const rocblas_int n,
+                 rocblas_float_complex *A, const rocblas_int lda, const rocblas_int *ipiv, rocblas_int* info) 
+{
+    return rocsolver_getri_impl<rocblas_float_complex>(handle, n, A, lda, ipiv, info);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetri(rocblas_handle handle, const rocblas_int n,
+                 rocblas_double_complex *A, const rocblas_int lda, const rocblas_int *ipiv, rocblas_int* info) 
+{
+    return rocsolver_getri_impl<rocblas_double_complex>(handle, n, A, lda, ipiv, info);
+}
+
+} //extern C
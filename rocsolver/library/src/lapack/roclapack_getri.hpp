@@ -0,0 +1,345 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#ifndef ROCLAPACK_GETRI_HPP
+#define ROCLAPACK_GETRI_HPP
+
+#include <hip/hip_runtime.h>
+#include "rocblas.hpp"
+#include "rocsolver.h"
+#include "ideal_sizes.hpp"
+#include "common_device.hpp"
+#include "rocsolver_handle.hpp"
+
+// Inverse of a small matrix (n <= DIM) from its LU factorization, entirely in shared memory.
+// One block of DIM threads per matrix: the factors are loaded from A once, thread i owns row i
+// while U is inverted, inv(A)*L = inv(U) is solved and the columns are interchanged, and the
+// inverse is written to C (which can be A). Singular matrices are left untouched.
+// The dynamic shared memory must hold n*n entries of type T.
+template <rocblas_int DIM, typename T, typename U>
+__global__ void getri_small(const rocblas_int n, U AA, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                            const rocblas_int* ipivA, const rocblas_int shiftP, const rocblas_stride strideP,
+                            U CC, const rocblas_int shiftC, const rocblas_int ldc, const rocblas_stride strideC,
+                            rocblas_int* info)
+{
+    __shared__ T w[DIM];
+    __shared__ rocblas_int singular;
+    extern __shared__ double lmem[];
+    T* sA = reinterpret_cast<T*>(lmem);
+
+    int id = hipBlockIdx_x;
+    int tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+    T* C = load_ptr_batch<T>(CC,id,shiftC,strideC);
+    const rocblas_int* ipiv = ipivA + id*strideP + shiftP;
+
+    // load the factors (leading dimension n in shared memory)
+    for (rocblas_int k = tid; k < n*n; k += DIM)
+        sA[k] = A[k % n + (k / n)*lda];
+    __syncthreads();
+
+    // check singularity
+    if (tid == 0) {
+        singular = 0;
+        for (rocblas_int j = 0; j < n && singular == 0; ++j)
+            if (sA[j + j*n] == 0)
+                singular = j + 1;
+        info[id] = singular;
+    }
+    __syncthreads();
+    if (singular)
+        return;
+
+    // compute inv(U) column by column
+    for (rocblas_int j = 0; j < n; ++j) {
+        T ujj = T(1.0) / sA[j + j*n];
+        T x = 0;
+        if (tid < j) {
+            for (rocblas_int k = tid; k < j; ++k)
+                x += sA[tid + k*n] * sA[k + j*n];
+        }
+        __syncthreads();
+        if (tid < j)
+            sA[tid + j*n] = -x * ujj;
+        else if (tid == j)
+            sA[j + j*n] = ujj;
+        __syncthreads();
+    }
+
+    // solve inv(A)*L = inv(U) for inv(A), from the last column to the first
+    for (rocblas_int j = n - 2; j >= 0; --j) {
+        if (tid > j && tid < n) {
+            w[tid] = sA[tid + j*n];
+            sA[tid + j*n] = 0;
+        }
+        __syncthreads();
+        if (tid < n) {
+            T x = sA[tid + j*n];
+            for (rocblas_int k = j + 1; k < n; ++k)
+                x -= sA[tid + k*n] * w[k];
+            sA[tid + j*n] = x;
+        }
+        __syncthreads();
+    }
+
+    // apply column interchanges (each thread only touches its own row)
+    if (tid < n) {
+        for (rocblas_int j = n - 2; j >= 0; --j) {
+            rocblas_int jp = ipiv[j] - 1;
+            if (jp != j) {
+                T temp = sA[tid + j*n];
+                sA[tid + j*n] = sA[tid + jp*n];
+                sA[tid + jp*n] = temp;
+            }
+        }
+    }
+    __syncthreads();
+
+    // write back the inverse
+    for (rocblas_int k = tid; k < n*n; k += DIM)
+        C[k % n + (k / n)*ldc] = sA[k];
+}
+
+// info = index of the first zero diagonal element of U (0 if there is none)
+template <rocblas_int DIM, typename T, typename U>
+__global__ void getri_check_singularity(const rocblas_int n, U AA, const rocblas_int shiftA, const rocblas_int lda,
+                                        const rocblas_stride strideA, rocblas_int* info)
+{
+    __shared__ rocblas_int sidx[DIM];
+
+    int id = hipBlockIdx_x;
+    int tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+
+    rocblas_int first = n;
+    for (rocblas_int j = tid; j < n && first == n; j += DIM)
+        if (A[j + j*lda] == 0)
+            first = j;
+    sidx[tid] = first;
+    __syncthreads();
+
+    for (rocblas_int s = DIM / 2; s > 0; s /= 2) {
+        if (tid < s)
+            sidx[tid] = min(sidx[tid], sidx[tid + s]);
+        __syncthreads();
+    }
+
+    if (tid == 0)
+        info[id] = sidx[0] < n ? sidx[0] + 1 : 0;
+}
+
+// copy the n-by-n matrix A into C
+template <typename T, typename U, typename V>
+__global__ void getri_copy(const rocblas_int n, U AA, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                           V CC, const rocblas_int shiftC, const rocblas_int ldc, const rocblas_stride strideC)
+{
+    int id = hipBlockIdx_y;
+    int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (i < n) {
+        T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+        T* C = load_ptr_batch<T>(CC,id,shiftC,strideC);
+        for (rocblas_int j = 0; j < n; ++j)
+            C[i + j*ldc] = A[i + j*lda];
+    }
+}
+
+// block column j:j+jb of the identity (rows 0:j+jb), to be overwritten with the same columns of inv(U)
+template <typename T>
+__global__ void getri_trtri_init(const rocblas_int j, const rocblas_int jb, T* W, const rocblas_int ldw, const rocblas_stride strideW)
+{
+    int id = hipBlockIdx_y;
+    int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (i < j + jb) {
+        T* w = W + id*strideW;
+        for (rocblas_int c = 0; c < jb; ++c)
+            w[i + c*ldw] = (i == j + c) ? 1 : 0;
+    }
+}
+
+// copy the upper triangular part of the computed columns of inv(U) back into A
+template <typename T, typename U>
+__global__ void getri_trtri_copy(const rocblas_int j, const rocblas_int jb, U AA, const rocblas_int shiftA, const rocblas_int lda,
+                                 const rocblas_stride strideA, T* W, const rocblas_int ldw, const rocblas_stride strideW)
+{
+    int id = hipBlockIdx_y;
+    int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (i < j + jb) {
+        T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+        T* w = W + id*strideW;
+        for (rocblas_int c = max(i - j, 0); c < jb; ++c)
+            A[i + (j + c)*lda] = w[i + c*ldw];
+    }
+}
+
+// move the strictly lower triangular part of the block column j:j+jb (i.e. the columns of L)
+// into the workspace, setting it to zero in A
+template <typename T, typename U>
+__global__ void getri_extract_L(const rocblas_int n, const rocblas_int j, const rocblas_int jb, U AA, const rocblas_int shiftA,
+                                const rocblas_int lda, const rocblas_stride strideA, T* W, const rocblas_int ldw, const rocblas_stride strideW)
+{
+    int id = hipBlockIdx_y;
+    int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (i > j && i < n) {
+        T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+        T* w = W + id*strideW;
+        for (rocblas_int c = 0; c < min(i - j, jb); ++c) {
+            w[i + c*ldw] = A[i + (j + c)*lda];
+            A[i + (j + c)*lda] = 0;
+        }
+    }
+}
+
+// apply the column interchanges in reverse order
+template <typename T, typename U>
+__global__ void getri_pivot(const rocblas_int n, U AA, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                            const rocblas_int* ipivA, const rocblas_int shiftP, const rocblas_stride strideP)
+{
+    int id = hipBlockIdx_y;
+    int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (i < n) {
+        T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+        const rocblas_int* ipiv = ipivA + id*strideP + shiftP;
+        for (rocblas_int j = n - 2; j >= 0; --j) {
+            rocblas_int jp = ipiv[j] - 1;
+            if (jp != j) {
+                T temp = A[i + j*lda];
+                A[i + j*lda] = A[i + jp*lda];
+                A[i + jp*lda] = temp;
+            }
+        }
+    }
+}
+
+// true if the matrix can be inverted with the single-kernel path
+template <typename T>
+inline bool getri_use_small(const rocblas_int n)
+{
+    return n <= GETRI_SMALL_SIZE && sizeof(T)*n*n <= GETRI_SMALL_LDS;
+}
+
+template <typename T>
+void rocsolver_getri_getMemorySize(const rocblas_int n, const rocblas_int ldc, const rocblas_int batch_count, size_t *size)
+{
+    // small matrices need no workspace
+    if (getri_use_small<T>(n)) {
+        *size = 0;
+        return;
+    }
+
+    // block column of inv(U) or L + masked pointers to C + scratch matrix for the singular matrices + trsm
+    *size = rocsolver_workspace_size<T>(size_t(n)*GETRI_BLOCKSIZE*batch_count);
+    *size += rocsolver_workspace_size<T*>(batch_count);
+    *size += rocsolver_workspace_size<T>(size_t(ldc)*n);
+    *size += rocblasCall_trsm_memsize<T>(batch_count);
+}
+
+// Computes the inverse of A from its LU factorization (as returned by getrf) and stores it in C.
+// C can be the same as A (in-place inversion); otherwise A is not modified. The C of singular
+// matrices is not modified either.
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_getri_template(rocblas_handle handle, const rocblas_int n,
+                                        U A, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                                        const rocblas_int *ipiv, const rocblas_int shiftP, const rocblas_stride strideP,
+                                        U C, const rocblas_int shiftC, const rocblas_int ldc, const rocblas_stride strideC,
+                                        const bool inplace, rocblas_int* info, const rocblas_int batch_count)
+{
+    // quick return
+    if (n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // small matrices are inverted in shared memory with a single kernel
+    if (getri_use_small<T>(n)) {
+        hipLaunchKernelGGL((getri_small<GETRI_SMALL_SIZE,T>), dim3(batch_count), dim3(GETRI_SMALL_SIZE),
+                  sizeof(T)*n*n, stream, n, A, shiftA, lda, strideA, ipiv, shiftP, strideP, C, shiftC, ldc, strideC, info);
+        return rocblas_status_success;
+    }
+
+    //constants to use when calling rocablas functions
+    T* constants = rocsolver_constants<T>(handle);
+    if (!constants)
+        return rocblas_status_memory_error;
+    T* minoneInt = constants;     //constant -1 in device
+    T* oneInt = constants + 2;    //constant 1 in device
+
+    //block column of inv(U) or L, masked pointers to C and scratch matrix
+    rocsolver_workspace_frame frame(handle);
+    rocblas_int ldw = n;
+    rocblas_stride strideW = rocblas_stride(n)*GETRI_BLOCKSIZE;
+    T* W = frame.alloc<T>(strideW*batch_count);
+    T** Carr = frame.alloc<T*>(batch_count);
+    T* scratch = frame.alloc<T>(size_t(ldc)*n);
+    if (!W || !Carr || !scratch)
+        return rocblas_status_memory_error;
+
+    rocblas_int blocks = (n - 1) / BLOCKSIZE + 1;
+    rocblas_int blocksBatch = (batch_count - 1) / BLOCKSIZE + 1;
+    dim3 grid(blocks, batch_count, 1);
+    dim3 threads(BLOCKSIZE, 1, 1);
+    rocblas_int jb;
+    rocblas_int nn = ((n - 1) / GETRI_BLOCKSIZE) * GETRI_BLOCKSIZE;    //first row of the last block
+
+    // singular matrices are left untouched: the entries of Carr point to C, or to the 
+    // scratch matrix for the singular matrices, and the inverse is computed through Carr
+    hipLaunchKernelGGL((getri_check_singularity<BLOCKSIZE,T>),dim3(batch_count),threads,0,stream,n,A,shiftA,lda,strideA,info);
+    hipLaunchKernelGGL(mask_pointers<T>,dim3(blocksBatch),threads,0,stream,C,shiftC,strideC,info,scratch,Carr,batch_count);
+    T *const* CC = cast2constPointer<T>(Carr);
+
+    if (!inplace)
+        hipLaunchKernelGGL(getri_copy<T>,grid,threads,0,stream,n,A,shiftA,lda,strideA,CC,0,ldc,0);
+
+    // compute inv(U) by block columns, from the last to the first, solving U*X = I
+    // (the columns to the left of the current block still hold the original U)
+    for (rocblas_int j = nn; j >= 0; j -= GETRI_BLOCKSIZE) {
+        jb = min(n - j, GETRI_BLOCKSIZE);
+        hipLaunchKernelGGL(getri_trtri_init<T>,grid,threads,0,stream,j,jb,W,ldw,strideW);
+
+        rocblasCall_trsm<T>(handle, rocblas_side_left, rocblas_fill_upper, rocblas_operation_none,
+                            rocblas_diagonal_non_unit, j + jb, jb, oneInt,
+                            CC, 0, ldc, 0,
+                            W, 0, ldw, strideW, batch_count);
+
+        hipLaunchKernelGGL(getri_trtri_copy<T>,grid,threads,0,stream,j,jb,CC,0,ldc,0,W,ldw,strideW);
+    }
+
+    // solve inv(A)*L = inv(U) for inv(A) by block columns, from the last to the first
+    for (rocblas_int j = nn; j >= 0; j -= GETRI_BLOCKSIZE) {
+        jb = min(n - j, GETRI_BLOCKSIZE);
+        hipLaunchKernelGGL(getri_extract_L<T>,grid,threads,0,stream,n,j,jb,CC,0,ldc,0,W,ldw,strideW);
+
+        if (j + jb < n) {
+            rocblasCall_gemm<true,false,T>(handle, rocblas_operation_none, rocblas_operation_none,
+                                           n, jb, n - j - jb, minoneInt,
+                                           CC, idx2D(0, j + jb, ldc), ldc, 0,
+                                           W, j + jb, ldw, strideW, oneInt,
+                                           CC, idx2D(0, j, ldc), ldc, 0, batch_count);
+        }
+
+        rocblasCall_trsm<T>(handle, rocblas_side_right, rocblas_fill_lower, rocblas_operation_none,
+                            rocblas_diagonal_unit, n, jb, oneInt,
+                            W, j, ldw, strideW,
+                            CC, idx2D(0, j, ldc), ldc, 0, batch_count);
+    }
+
+    // apply column interchanges
+    hipLaunchKernelGGL(getri_pivot<T>,grid,threads,0,stream,n,CC,0,ldc,0,ipiv,shiftP,strideP);
+
+    return rocblas_status_success;
+}
+
+#endif /* ROCLAPACK_GETRI_HPP */
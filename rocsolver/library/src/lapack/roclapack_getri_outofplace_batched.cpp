@@ -0,0 +1,79 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_getri.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_getri_outofplace_batched_impl(rocblas_handle handle, const rocblas_int n, U A, const rocblas_int lda,
+                                        const rocblas_int *ipiv, const rocblas_stride strideP, U C, const rocblas_int ldc,
+                                        rocblas_int* info, const rocblas_int batch_count) {
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    
+    //logging is missing ???    
+
+    if (n < 0 || lda < n || ldc < n || batch_count < 0) 
+        return rocblas_status_invalid_size;
+    if (!A || !ipiv || !C || !info)
+        return rocblas_status_invalid_pointer;
+
+    rocblas_stride strideA = 0;
+    rocblas_stride strideC = 0;
+
+    // memory management
+    size_t size;
+    rocsolver_getri_getMemorySize<T>(n,ldc,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_getri_template<true,false,T>(handle,n,
+                                                A,0,    //The matrix is shifted 0 entries (will work on the entire matrix)
+                                                lda,strideA,
+                                                ipiv,0, //the vector is shifted 0 entries (will work on the entire vector)
+                                                strideP,
+                                                C,0,ldc,strideC,
+                                                false,info,batch_count);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sgetri_outofplace_batched(rocblas_handle handle, const rocblas_int n,
+                 float *const A[], const rocblas_int lda, const rocblas_int *ipiv, const rocblas_stride strideP,
+                 float *const C[], const rocblas_int ldc, rocblas_int* info, const rocblas_int batch_count) 
+{
+    return rocsolver_getri_outofplace_batched_impl<float>(handle, n, A, lda, ipiv, strideP, C, ldc, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dgetri_outofplace_batched(rocblas_handle handle, const rocblas_int n,
+                 double *const A[], const rocblas_int lda, const rocblas_int *ipiv, const rocblas_stride strideP,
+                 double *const C[], const rocblas_int ldc, rocblas_int* info, const rocblas_int batch_count) 
+{
+    return rocsolver_getri_outofplace_batched_impl<double>(handle, n, A, lda, ipiv, strideP, C, ldc, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_cgetri_outofplace_batched(rocblas_handle handle, const rocblas_int n,
+                 rocblas_float_complex *const A[], const rocblas_int lda, const rocblas_int *ipiv, const rocblas_stride strideP,
+                 rocblas_float_complex *const C[], const rocblas_int ldc, rocblas_int* info, const rocblas_int batch_count) 
+{
+    return rocsolver_getri_outofplace_batched_impl<rocblas_float_complex>(handle, n, A, lda, ipiv, strideP, C, ldc, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_zgetri_outofplace_batched(rocblas_handle handle, const rocblas_int n,
+                 rocblas_double_complex *const A[], const rocblas_int lda, const rocblas_int *ipiv, const rocblas_stride strideP,
+                 rocblas_double_complex *const C[], const rocblas_int ldc, rocblas_int* info, const rocblas_int batch_count) 
+{
+    return rocsolver_getri_outofplace_batched_impl<rocblas_double_complex>(handle, n, A, lda, ipiv, strideP, C, ldc, info, batch_count);
+}
+
+} //extern C
@@ -25,6 +25,15 @@ rocblas_status rocsolver_getrs_impl(rocblas_handle handle, const rocblas_operati
     rocblas_stride strideP = 0;
     rocblas_int batch_count = 1;
 
+    // memory management
+    size_t size;
+    rocsolver_getrs_getMemorySize<T>(n,nrhs,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
     return rocsolver_getrs_template<T>(handle,trans,n,nrhs,
                                         A,0,
                                         lda,strideA,
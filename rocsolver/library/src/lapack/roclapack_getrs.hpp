@@ -12,8 +12,146 @@
 
 #include "rocblas.hpp"
 #include "common_device.hpp"
+#include "rocsolver_handle.hpp"
 #include "../auxiliary/rocauxiliary_laswp.hpp"
 
+// Solves the system with a small matrix (n <= DIM) and a few right hand sides (nrhs <= NRHS)
+// in one pass. One block of DIM threads per matrix: the factors L and U are loaded into shared
+// memory, and the row interchanges and both triangular solves are done on the right hand
+// sides (also kept in shared memory) with thread i updating row i.
+// The dynamic shared memory must hold n*n entries of type T.
+template <rocblas_int DIM, rocblas_int NRHS, typename T, typename U>
+__global__ void getrs_small(const rocblas_operation trans, const rocblas_int n, const rocblas_int nrhs,
+                            U AA, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                            const rocblas_int *ipivA, const rocblas_stride strideP,
+                            U BB, const rocblas_int shiftB, const rocblas_int ldb, const rocblas_stride strideB)
+{
+    __shared__ T sB[DIM*NRHS];
+    extern __shared__ double lmem[];
+    T* sA = reinterpret_cast<T*>(lmem);
+
+    int id = hipBlockIdx_x;
+    int tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+    T* B = load_ptr_batch<T>(BB,id,shiftB,strideB);
+    const rocblas_int* ipiv = ipivA + id*strideP;
+    const bool CONJ = (trans == rocblas_operation_conjugate_transpose);
+
+    // load the factors and the right hand sides (leading dimension n in shared memory)
+    for (rocblas_int k = tid; k < n*n; k += DIM)
+        sA[k] = A[k % n + (k / n)*lda];
+    for (rocblas_int k = tid; k < n*nrhs; k += DIM)
+        sB[k] = B[k % n + (k / n)*ldb];
+    __syncthreads();
+
+    if (trans == rocblas_operation_none) {
+        // apply row interchanges (thread r works on the r-th right hand side)
+        if (tid < nrhs) {
+            for (rocblas_int j = 0; j < n; ++j) {
+                rocblas_int jp = ipiv[j] - 1;
+                if (jp != j) {
+                    T temp = sB[j + tid*n];
+                    sB[j + tid*n] = sB[jp + tid*n];
+                    sB[jp + tid*n] = temp;
+                }
+            }
+        }
+
+        // solve L*X = B
+        for (rocblas_int j = 0; j < n; ++j) {
+            __syncthreads();
+            if (tid > j && tid < n) {
+                T l = sA[tid + j*n];
+                for (rocblas_int r = 0; r < nrhs; ++r)
+                    sB[tid + r*n] -= l * sB[j + r*n];
+            }
+        }
+
+        // solve U*X = B
+        for (rocblas_int j = n - 1; j >= 0; --j) {
+            __syncthreads();
+            if (tid == j) {
+                T d = sA[j + j*n];
+                for (rocblas_int r = 0; r < nrhs; ++r)
+                    sB[j + r*n] /= d;
+            }
+            __syncthreads();
+            if (tid < j) {
+                T u = sA[tid + j*n];
+                for (rocblas_int r = 0; r < nrhs; ++r)
+                    sB[tid + r*n] -= u * sB[j + r*n];
+            }
+        }
+        __syncthreads();
+    }
+    else {
+        // solve U**T *X = B or U**H *X = B
+        for (rocblas_int j = 0; j < n; ++j) {
+            __syncthreads();
+            if (tid == j) {
+                T d = CONJ ? conj(sA[j + j*n]) : sA[j + j*n];
+                for (rocblas_int r = 0; r < nrhs; ++r)
+                    sB[j + r*n] /= d;
+            }
+            __syncthreads();
+            if (tid > j && tid < n) {
+                T u = CONJ ? conj(sA[j + tid*n]) : sA[j + tid*n];
+                for (rocblas_int r = 0; r < nrhs; ++r)
+                    sB[tid + r*n] -= u * sB[j + r*n];
+            }
+        }
+
+        // solve L**T *X = B or L**H *X = B
+        for (rocblas_int j = n - 1; j >= 0; --j) {
+            __syncthreads();
+            if (tid < j) {
+                T l = CONJ ? conj(sA[j + tid*n]) : sA[j + tid*n];
+                for (rocblas_int r = 0; r < nrhs; ++r)
+                    sB[tid + r*n] -= l * sB[j + r*n];
+            }
+        }
+        __syncthreads();
+
+        // apply row interchanges in reverse order
+        if (tid < nrhs) {
+            for (rocblas_int j = n - 1; j >= 0; --j) {
+                rocblas_int jp = ipiv[j] - 1;
+                if (jp != j) {
+                    T temp = sB[j + tid*n];
+                    sB[j + tid*n] = sB[jp + tid*n];
+                    sB[jp + tid*n] = temp;
+                }
+            }
+        }
+        __syncthreads();
+    }
+
+    // write back the solution
+    for (rocblas_int k = tid; k < n*nrhs; k += DIM)
+        B[k % n + (k / n)*ldb] = sB[k];
+}
+
+// true if the system can be solved with the single-kernel path
+template <typename T>
+inline bool getrs_use_small(const rocblas_int n, const rocblas_int nrhs)
+{
+    return n <= GETRS_SMALL_SIZE && nrhs <= GETRS_SMALL_NRHS && sizeof(T)*n*n <= GETRS_SMALL_LDS;
+}
+
+
+template <typename T>
+void rocsolver_getrs_getMemorySize(const rocblas_int n, const rocblas_int nrhs, const rocblas_int batch_count, size_t *size)
+{
+    // quick return (the single-kernel path needs no workspace either)
+    if (n == 0 || nrhs == 0 || getrs_use_small<T>(n,nrhs)) {
+        *size = 0;
+        return;
+    }
+
+    // trsm
+    *size = rocblasCall_trsm_memsize<T>(batch_count);
+}
 
 template <typename T, typename U>
 rocblas_status rocsolver_getrs_template(rocblas_handle handle, const rocblas_operation trans,
@@ -26,74 +164,52 @@ rocblas_status rocsolver_getrs_template(rocblas_handle handle, const rocblas_ope
       return rocblas_status_success;
     }
 
-    // **** THIS SYNCHRONIZATION WILL BE REQUIRED UNTIL
-    //      TRSM_BATCH FUNCTIONALITY IS ENABLED. ****
-    #ifdef batched
-        T* AA[batch_count];
-        T* BB[batch_count];
-        hipMemcpy(AA, A, batch_count*sizeof(T*), hipMemcpyDeviceToHost);
-        hipMemcpy(BB, B, batch_count*sizeof(T*), hipMemcpyDeviceToHost);
-    #else
-        T* AA = A;
-        T* BB = B;
-    #endif
+    // small systems are solved with a single kernel
+    if (getrs_use_small<T>(n,nrhs)) {
+        hipStream_t stream;
+        rocblas_get_stream(handle, &stream);
+        hipLaunchKernelGGL((getrs_small<GETRS_SMALL_SIZE,GETRS_SMALL_NRHS,T>), dim3(batch_count), dim3(GETRS_SMALL_SIZE),
+                  sizeof(T)*n*n, stream, trans, n, nrhs, A, shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB);
+        return rocblas_status_success;
+    }
 
     //constants to use when calling rocablas functions
-    T one = 1;            //constant 1 in host
-    T* oneInt;            //constant 1 in device
-    hipMalloc(&oneInt, sizeof(T));
-    hipMemcpy(oneInt, &one, sizeof(T), hipMemcpyHostToDevice);
-
-    hipStream_t stream;
-    rocblas_get_stream(handle, &stream);
-    T *Ap, *Bp;
-
-    // **** TRSM_BATCH IS EXECUTED IN A FOR-LOOP UNTIL
-    //      FUNCITONALITY IS ENABLED. ****
+    T* constants = rocsolver_constants<T>(handle);
+    if (!constants)
+        return rocblas_status_memory_error;
+    T* oneInt = constants + 2;    //constant 1 in device
 
     if (trans == rocblas_operation_none) {
 
         // first apply row interchanges to the right hand sides
         rocsolver_laswp_template<T>(handle, nrhs, B, shiftB, ldb, strideB, 1, n, ipiv, 0, strideP, 1, batch_count);
 
-        for (int b = 0; b < batch_count; ++b) {
-            Ap = load_ptr_batch<T>(AA,b,shiftA,strideA);
-            Bp = load_ptr_batch<T>(BB,b,shiftB,strideB);
-            
-            // solve L*X = B, overwriting B with X
-            rocblas_trsm<T>(handle, rocblas_side_left, rocblas_fill_lower,
-                    trans, rocblas_diagonal_unit, n, nrhs,
-                    oneInt, Ap, lda, Bp, ldb);
-
-            // solve U*X = B, overwriting B with X
-            rocblas_trsm<T>(handle, rocblas_side_left, rocblas_fill_upper,
-                    trans, rocblas_diagonal_non_unit, n, nrhs,
-                    oneInt, Ap, lda, Bp, ldb);
-        }
+        // solve L*X = B, overwriting B with X
+        rocblasCall_trsm<T>(handle, rocblas_side_left, rocblas_fill_lower,
+                            trans, rocblas_diagonal_unit, n, nrhs,
+                            oneInt, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count);
+
+        // solve U*X = B, overwriting B with X
+        rocblasCall_trsm<T>(handle, rocblas_side_left, rocblas_fill_upper,
+                            trans, rocblas_diagonal_non_unit, n, nrhs,
+                            oneInt, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count);
     
     } else {
 
-        for (int b = 0; b < batch_count; ++b) {
-            Ap = load_ptr_batch<T>(AA,b,shiftA,strideA);
-            Bp = load_ptr_batch<T>(BB,b,shiftB,strideB);
-            
-            // solve U**T *X = B or U**H *X = B, overwriting B with X
-            rocblas_trsm<T>(handle, rocblas_side_left, rocblas_fill_upper, trans,
-                    rocblas_diagonal_non_unit, n, nrhs,
-                    oneInt, Ap, lda, Bp, ldb);
-
-            // solve L**T *X = B, or L**H *X = B overwriting B with X
-            rocblas_trsm<T>(handle, rocblas_side_left, rocblas_fill_lower, trans,
-                    rocblas_diagonal_unit, n, nrhs, oneInt,
-                    Ap, lda, Bp, ldb);
-        }
+        // solve U**T *X = B or U**H *X = B, overwriting B with X
+        rocblasCall_trsm<T>(handle, rocblas_side_left, rocblas_fill_upper, trans,
+                            rocblas_diagonal_non_unit, n, nrhs,
+                            oneInt, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count);
+
+        // solve L**T *X = B, or L**H *X = B overwriting B with X
+        rocblasCall_trsm<T>(handle, rocblas_side_left, rocblas_fill_lower, trans,
+                            rocblas_diagonal_unit, n, nrhs,
+                            oneInt, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count);
 
         // then apply row interchanges to the solution vectors
         rocsolver_laswp_template<T>(handle, nrhs, B, shiftB, ldb, strideB, 1, n, ipiv, 0, strideP, -1, batch_count);
     }
 
-    hipFree(oneInt);
-
     return rocblas_status_success;
 }
 
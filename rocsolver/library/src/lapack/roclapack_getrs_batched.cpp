@@ -2,7 +2,6 @@
  * Copyright 2019-2020 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 
-#define batched
 #include "roclapack_getrs.hpp"
 
 template <typename T, typename U>
@@ -24,6 +23,15 @@ rocblas_status rocsolver_getrs_batched_impl(rocblas_handle handle, const rocblas
     rocblas_stride strideA = 0;
     rocblas_stride strideB = 0;
 
+    // memory management
+    size_t size;
+    rocsolver_getrs_getMemorySize<T>(n,nrhs,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
     return rocsolver_getrs_template<T>(handle,trans,n,nrhs,
                                         A,0,
                                         lda,strideA,
@@ -76,5 +84,3 @@ rocsolver_zgetrs_batched(
 {
   return rocsolver_getrs_batched_impl<rocblas_double_complex>(handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, batch_count);
 }
-
-#undef batched
@@ -20,6 +20,15 @@ rocblas_status rocsolver_getrs_strided_batched_impl(rocblas_handle handle, const
     if (!A || !ipiv || !B)
         return rocblas_status_invalid_pointer;
 
+    // memory management
+    size_t size;
+    rocsolver_getrs_getMemorySize<T>(n,nrhs,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
     return rocsolver_getrs_template<T>(handle,trans,n,nrhs,
                                         A,0,
                                         lda,strideA,
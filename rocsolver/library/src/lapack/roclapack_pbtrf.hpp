@@ -0,0 +1,109 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#ifndef ROCLAPACK_PBTRF_HPP
+#define ROCLAPACK_PBTRF_HPP
+
+#include <hip/hip_runtime.h>
+#include "rocblas.hpp"
+#include "rocsolver.h"
+#include "ideal_sizes.hpp"
+#include "common_device.hpp"
+#include "rocsolver_handle.hpp"
+
+// Position in band storage of the entry (r,c), c <= r <= c+kd, of the factor seen as a lower triangular
+// matrix L: L(r,c) itself if uplo is lower, or U(c,r) if uplo is upper (A = U'*U = L*L' with L = U').
+__device__ inline size_t pb_loc(const bool upper, const rocblas_int kd, const rocblas_int ldab,
+                                const rocblas_int r, const rocblas_int c)
+{
+    return upper ? kd + c - r + size_t(r)*ldab : r - c + size_t(c)*ldab;
+}
+
+// Cholesky factorization of a band matrix with kd sub (or super) diagonals. One block of DIM threads
+// per matrix: the columns are factorized one after the other as in potf2, but the scaling and the
+// rank-1 update only touch the kd-by-kd window below the diagonal element, so the cost is O(n*kd^2).
+// As in LAPACK, the factorization stops at the first non-positive pivot.
+template <rocblas_int DIM, typename T, typename U>
+__global__ void pbtrf_kernel(const rocblas_fill uplo, const rocblas_int n, const rocblas_int kd,
+                             U AA, const rocblas_int shiftA, const rocblas_int ldab, const rocblas_stride strideA,
+                             rocblas_int *info)
+{
+    __shared__ rocblas_int sfail;
+
+    int id = hipBlockIdx_x;
+    int tid = hipThreadIdx_x;
+    const bool upper = (uplo == rocblas_fill_upper);
+
+    T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+
+    if (tid == 0)
+        sfail = 0;
+
+    for (rocblas_int j = 0; j < n; ++j) {
+        // compute the diagonal element and test for non-positive-definiteness
+        if (tid == 0) {
+            size_t loc = pb_loc(upper,kd,ldab,j,j);
+            T t = A[loc];
+            if (t <= 0)
+                sfail = j + 1;      //use fortran 1-based index
+            else
+                A[loc] = sqrt(t);
+        }
+        __syncthreads();
+        if (sfail)
+            break;
+
+        // scale the km entries of the column below the diagonal
+        rocblas_int km = min(kd, n - 1 - j);
+        T d = A[pb_loc(upper,kd,ldab,j,j)];
+        for (rocblas_int r = tid; r < km; r += DIM)
+            A[pb_loc(upper,kd,ldab,j+1+r,j)] /= d;
+        __syncthreads();
+
+        // update the lower triangle of the km-by-km window
+        for (rocblas_int k = tid; k < km*km; k += DIM) {
+            rocblas_int r = k % km, c = k / km;
+            if (r >= c)
+                A[pb_loc(upper,kd,ldab,j+1+r,j+1+c)] -= A[pb_loc(upper,kd,ldab,j+1+r,j)] * A[pb_loc(upper,kd,ldab,j+1+c,j)];
+        }
+        __syncthreads();
+    }
+
+    if (tid == 0)
+        info[id] = sfail;
+}
+
+
+template <typename T>
+void rocsolver_pbtrf_getMemorySize(const rocblas_int n, const rocblas_int kd, const rocblas_int batch_count, size_t *size)
+{
+    // the factorization works in place and only uses info
+    *size = 0;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_pbtrf_template(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                                        const rocblas_int kd, U A, const rocblas_int shiftA, const rocblas_int ldab,
+                                        const rocblas_stride strideA, rocblas_int *info, const rocblas_int batch_count)
+{
+    // quick return
+    if (batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // (info is also set when n = 0)
+    hipLaunchKernelGGL(pbtrf_kernel<PBTRF_BLOCKSIZE,T>,dim3(batch_count),dim3(PBTRF_BLOCKSIZE),0,stream,
+                       uplo,n,kd,A,shiftA,ldab,strideA,info);
+
+    return rocblas_status_success;
+}
+
+#endif /* ROCLAPACK_PBTRF_HPP */
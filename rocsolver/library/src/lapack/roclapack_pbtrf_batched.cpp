@@ -0,0 +1,61 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_pbtrf.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_pbtrf_batched_impl(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                                    const rocblas_int kd, U AB, const rocblas_int ldab, rocblas_int* info, const rocblas_int batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    //logging is missing ???
+
+    if (uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_not_implemented;
+    if (n < 0 || kd < 0 || ldab < kd + 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if (!AB || !info)
+        return rocblas_status_invalid_pointer;
+
+    rocblas_stride strideA = 0;
+
+    // memory management
+    size_t size;
+    rocsolver_pbtrf_getMemorySize<T>(n,kd,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_pbtrf_template<T>(handle,uplo,n,kd,
+                                    AB,0,    //the matrix is shifted 0 entries (will work on the entire matrix)
+                                    ldab,strideA,
+                                    info,batch_count);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spbtrf_batched(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 const rocblas_int kd, float *const AB[], const rocblas_int ldab, rocblas_int* info, const rocblas_int batch_count)
+{
+    return rocsolver_pbtrf_batched_impl<float>(handle, uplo, n, kd, AB, ldab, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpbtrf_batched(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 const rocblas_int kd, double *const AB[], const rocblas_int ldab, rocblas_int* info, const rocblas_int batch_count)
+{
+    return rocsolver_pbtrf_batched_impl<double>(handle, uplo, n, kd, AB, ldab, info, batch_count);
+}
+
+} //extern C
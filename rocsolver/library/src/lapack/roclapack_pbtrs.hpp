@@ -0,0 +1,85 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#ifndef ROCLAPACK_PBTRS_HPP
+#define ROCLAPACK_PBTRS_HPP
+
+#include <hip/hip_runtime.h>
+#include "rocblas.hpp"
+#include "rocsolver.h"
+#include "ideal_sizes.hpp"
+#include "common_device.hpp"
+#include "rocsolver_handle.hpp"
+#include "roclapack_pbtrf.hpp"
+
+// Solves L*L'*x = b with the band factor (see pb_loc). Each thread solves one right hand side of one
+// matrix: with narrow bands the substitutions only involve kd entries per row, and the parallelism
+// comes from the batch and the right hand sides.
+template <typename T, typename U>
+__global__ void pbtrs_kernel(const bool upper, const rocblas_int n, const rocblas_int kd, const rocblas_int nrhs,
+                             U AA, const rocblas_int shiftA, const rocblas_int ldab, const rocblas_stride strideA,
+                             U BB, const rocblas_int shiftB, const rocblas_int ldb, const rocblas_stride strideB,
+                             const rocblas_int batch_count)
+{
+    size_t t = size_t(hipBlockIdx_x) * hipBlockDim_x + hipThreadIdx_x;
+    if (t >= size_t(nrhs) * batch_count)
+        return;
+
+    rocblas_int id = t / nrhs;
+    T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+    T* b = load_ptr_batch<T>(BB,id,shiftB,strideB) + (t % nrhs)*ldb;
+
+    // solve L*y = b (forward substitution)
+    for (rocblas_int c = 0; c < n; ++c) {
+        T x = b[c] / A[pb_loc(upper,kd,ldab,c,c)];
+        b[c] = x;
+        for (rocblas_int r = c + 1; r <= min(n - 1, c + kd); ++r)
+            b[r] -= A[pb_loc(upper,kd,ldab,r,c)] * x;
+    }
+
+    // solve L'*x = y (backward substitution)
+    for (rocblas_int c = n - 1; c >= 0; --c) {
+        T x = b[c];
+        for (rocblas_int r = c + 1; r <= min(n - 1, c + kd); ++r)
+            x -= A[pb_loc(upper,kd,ldab,r,c)] * b[r];
+        b[c] = x / A[pb_loc(upper,kd,ldab,c,c)];
+    }
+}
+
+
+template <typename T>
+void rocsolver_pbtrs_getMemorySize(const rocblas_int n, const rocblas_int nrhs, const rocblas_int batch_count, size_t *size)
+{
+    // the solve works in place
+    *size = 0;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_pbtrs_template(rocblas_handle handle, const rocblas_fill uplo,
+                         const rocblas_int n, const rocblas_int kd, const rocblas_int nrhs,
+                         U A, const rocblas_int shiftA, const rocblas_int ldab, const rocblas_stride strideA,
+                         U B, const rocblas_int shiftB, const rocblas_int ldb, const rocblas_stride strideB,
+                         const rocblas_int batch_count)
+{
+    // quick return
+    if (n == 0 || nrhs == 0 || batch_count == 0) {
+      return rocblas_status_success;
+    }
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (size_t(nrhs) * batch_count - 1) / PBTRS_BLOCKSIZE + 1;
+    hipLaunchKernelGGL(pbtrs_kernel<T>,dim3(blocks),dim3(PBTRS_BLOCKSIZE),0,stream,
+                       uplo == rocblas_fill_upper,n,kd,nrhs,A,shiftA,ldab,strideA,B,shiftB,ldb,strideB,batch_count);
+
+    return rocblas_status_success;
+}
+
+#endif /* ROCLAPACK_PBTRS_HPP */
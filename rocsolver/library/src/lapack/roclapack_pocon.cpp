@@ -0,0 +1,62 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_pocon.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_pocon_impl(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                                        U A, const rocblas_int lda,
+                                        const S* anorm, S* rcond) {
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    
+    //logging is missing ???    
+
+    if (uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_not_implemented;
+    if (n < 0 || lda < n) 
+        return rocblas_status_invalid_size;
+    if (!A || !anorm || !rcond)
+        return rocblas_status_invalid_pointer;
+
+    rocblas_stride strideA = 0;
+    rocblas_int batch_count = 1;
+
+    // memory management
+    size_t size;
+    rocsolver_pocon_getMemorySize<T>(n,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_pocon_template<T>(handle,uplo,n,
+                                                A,0,    //The matrix is shifted 0 entries (will work on the entire matrix)
+                                                lda,strideA,
+                                                anorm,rcond,batch_count);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spocon(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 float *A, const rocblas_int lda, const float *anorm, float *rcond) 
+{
+    return rocsolver_pocon_impl<float>(handle, uplo, n, A, lda, anorm, rcond);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpocon(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 double *A, const rocblas_int lda, const double *anorm, double *rcond) 
+{
+    return rocsolver_pocon_impl<double>(handle, uplo, n, A, lda, anorm, rcond);
+}
+
+} //extern C
@@ -0,0 +1,30 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#ifndef ROCLAPACK_POCON_HPP
+#define ROCLAPACK_POCON_HPP
+
+#include "roclapack_gecon.hpp"
+
+template <typename T>
+void rocsolver_pocon_getMemorySize(const rocblas_int n, const rocblas_int batch_count, size_t *size)
+{
+    // same estimator as gecon
+    rocsolver_gecon_getMemorySize<T>(n,batch_count,size);
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_pocon_template(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                                        U A, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                                        const S* anorm, S* rcond, const rocblas_int batch_count)
+{
+    return rocsolver_con_template<false,T>(handle,uplo,n,A,shiftA,lda,strideA,anorm,rcond,batch_count);
+}
+
+#endif /* ROCLAPACK_POCON_HPP */
@@ -0,0 +1,61 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_pocon.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_pocon_batched_impl(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                                        U A, const rocblas_int lda,
+                                        const S* anorm, S* rcond, const rocblas_int batch_count) {
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    
+    //logging is missing ???    
+
+    if (uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_not_implemented;
+    if (n < 0 || lda < n || batch_count < 0) 
+        return rocblas_status_invalid_size;
+    if (!A || !anorm || !rcond)
+        return rocblas_status_invalid_pointer;
+
+    rocblas_stride strideA = 0;
+
+    // memory management
+    size_t size;
+    rocsolver_pocon_getMemorySize<T>(n,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_pocon_template<T>(handle,uplo,n,
+                                                A,0,    //The matrix is shifted 0 entries (will work on the entire matrix)
+                                                lda,strideA,
+                                                anorm,rcond,batch_count);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spocon_batched(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 float *const A[], const rocblas_int lda, const float *anorm, float *rcond, const rocblas_int batch_count) 
+{
+    return rocsolver_pocon_batched_impl<float>(handle, uplo, n, A, lda, anorm, rcond, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpocon_batched(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 double *const A[], const rocblas_int lda, const double *anorm, double *rcond, const rocblas_int batch_count) 
+{
+    return rocsolver_pocon_batched_impl<double>(handle, uplo, n, A, lda, anorm, rcond, batch_count);
+}
+
+} //extern C
@@ -0,0 +1,92 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#ifndef ROCLAPACK_POSV_HPP
+#define ROCLAPACK_POSV_HPP
+
+#include <hip/hip_runtime.h>
+#include "rocblas.hpp"
+#include "rocsolver.h"
+#include "common_device.hpp"
+#include "rocsolver_handle.hpp"
+#include "roclapack_potrf.hpp"
+#include "roclapack_potrs.hpp"
+#include "roclapack_gesv.hpp"
+
+
+template <typename T>
+void rocsolver_posv_getMemorySize(const rocblas_int n, const rocblas_int nrhs, const rocblas_int ldb,
+                                  const rocblas_int batch_count, size_t *size)
+{
+    // potrf and potrs run one after the other and share the workspace
+    size_t s;
+    rocsolver_potrf_getMemorySize<T>(n,batch_count,size);
+    rocsolver_potrs_getMemorySize<T>(n,nrhs,batch_count,&s);
+    *size = std::max(*size,s);
+
+    // masked pointers to B + scratch matrix for the matrices that are not positive definite
+    // + pointers to A
+    if (n > 0 && nrhs > 0) {
+        *size += 2 * rocsolver_workspace_size<T*>(batch_count);
+        *size += rocsolver_workspace_size<T>(size_t(ldb)*nrhs);
+    }
+}
+
+// Factorizes A with potrf and solves the systems with potrs, without synchronizing with the host.
+// The right hand sides of the matrices that are not positive definite (info != 0) are left untouched.
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_posv_template(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int nrhs,
+                                       U A, const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                                       U B, const rocblas_int shiftB, const rocblas_int ldb, const rocblas_stride strideB,
+                                       rocblas_int* info, const rocblas_int batch_count)
+{
+    // quick return
+    if (batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+
+    if (n == 0) {
+        //info=0 (nothing to factorize)
+        hipLaunchKernelGGL(reset_info,dim3(blocksReset),dim3(BLOCKSIZE),0,stream,info,batch_count,0);
+        return rocblas_status_success;
+    }
+
+    // masked pointers to B and scratch matrix (reserved before the workspace of potrf and potrs)
+    rocsolver_workspace_frame frame(handle);
+    T** Barr = nullptr;
+    T* scratch = nullptr;
+    if (nrhs > 0) {
+        Barr = frame.alloc<T*>(batch_count);
+        scratch = frame.alloc<T>(size_t(ldb)*nrhs);
+        if (!Barr || !scratch)
+            return rocblas_status_memory_error;
+    }
+
+    // factorize A
+    rocblas_status status = rocsolver_potrf_template<BATCHED,STRIDED,T>(handle,uplo,n,A,shiftA,lda,strideA,info,batch_count);
+    if (status != rocblas_status_success || nrhs == 0)
+        return status;
+
+    // solve the systems with positive definite matrices
+    T *const* Aarr = gesv_pointer_array<T>(handle,frame,A,strideA,batch_count);
+    if (!Aarr)
+        return rocblas_status_memory_error;
+    hipLaunchKernelGGL(mask_pointers<T>,dim3(blocksReset),dim3(BLOCKSIZE),0,stream,
+                       B,shiftB,strideB,info,scratch,Barr,batch_count);
+
+    return rocsolver_potrs_template<T>(handle,uplo,n,nrhs,
+                                       Aarr,shiftA,lda,strideA,
+                                       cast2constPointer<T>(Barr),0,ldb,strideB,
+                                       batch_count);
+}
+
+#endif /* ROCLAPACK_POSV_HPP */
@@ -0,0 +1,65 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_posv.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_posv_batched_impl(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                                        const rocblas_int nrhs, U A, const rocblas_int lda, U B, const rocblas_int ldb,
+                                        rocblas_int* info, const rocblas_int batch_count) {
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    
+    //logging is missing ???    
+
+    if (uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_not_implemented;
+    if (n < 0 || nrhs < 0 || lda < n || ldb < n || batch_count < 0) 
+        return rocblas_status_invalid_size;
+    if (!A || !B || !info)
+        return rocblas_status_invalid_pointer;
+
+    rocblas_stride strideA = 0;
+    rocblas_stride strideB = 0;
+
+    // memory management
+    size_t size;
+    rocsolver_posv_getMemorySize<T>(n,nrhs,ldb,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_posv_template<true,false,T>(handle,uplo,n,nrhs,
+                                      A,0,    //The matrix is shifted 0 entries (will work on the entire matrix)
+                                      lda,strideA,
+                                      B,0,ldb,strideB,
+                                      info,batch_count);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_sposv_batched(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 const rocblas_int nrhs, float *const A[], const rocblas_int lda, float *const B[], const rocblas_int ldb,
+                 rocblas_int* info, const rocblas_int batch_count) 
+{
+    return rocsolver_posv_batched_impl<float>(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dposv_batched(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 const rocblas_int nrhs, double *const A[], const rocblas_int lda, double *const B[], const rocblas_int ldb,
+                 rocblas_int* info, const rocblas_int batch_count) 
+{
+    return rocsolver_posv_batched_impl<double>(handle, uplo, n, nrhs, A, lda, B, ldb, info, batch_count);
+}
+
+} //extern C
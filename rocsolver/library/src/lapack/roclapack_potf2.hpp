@@ -13,7 +13,9 @@
 #include <hip/hip_runtime.h>
 #include "rocblas.hpp"
 #include "rocsolver.h"
+#include "ideal_sizes.hpp"
 #include "common_device.hpp"
+#include "rocsolver_handle.hpp"
 
 template <typename T, typename U> 
 __global__ void sqrtDiagOnward(U A, const rocblas_int shiftA, const rocblas_int strideA, const size_t loc, 
@@ -37,6 +39,108 @@ __global__ void sqrtDiagOnward(U A, const rocblas_int shiftA, const rocblas_int
     }
 }
 
+// Cholesky factorization of a small matrix (n <= DIM) entirely in shared memory. One block of DIM
+// threads per matrix: the triangle is loaded once, column j is computed in a left-looking fashion
+// (thread i computes the entry of row i, or of column i if uplo is upper), and the factor and info
+// are written back at the end. As in LAPACK, the factorization stops at the first non-positive pivot
+// and the remaining columns are not modified. The dynamic shared memory must hold n*n entries of type T.
+template <rocblas_int DIM, typename T, typename U>
+__global__ void potf2_small(const rocblas_fill uplo, const rocblas_int n, U AA, const rocblas_int shiftA,
+                            const rocblas_int lda, const rocblas_stride strideA, rocblas_int* info)
+{
+    __shared__ rocblas_int sfail;
+    extern __shared__ double lmem[];
+    T* sA = reinterpret_cast<T*>(lmem);
+
+    int id = hipBlockIdx_x;
+    int tid = hipThreadIdx_x;
+    const bool lower = (uplo == rocblas_fill_lower);
+
+    T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+
+    // load the triangle (leading dimension n in shared memory)
+    for (rocblas_int k = tid; k < n*n; k += DIM) {
+        rocblas_int i = k % n, j = k / n;
+        if (lower ? i >= j : i <= j)
+            sA[k] = A[i + j*lda];
+    }
+    if (tid == 0)
+        sfail = 0;
+    __syncthreads();
+
+    rocblas_int nc = n;     // number of computed columns
+    for (rocblas_int j = 0; j < n; ++j) {
+        // compute the diagonal element and test for non-positive-definiteness
+        if (tid == j) {
+            T t = sA[j + j*n];
+            for (rocblas_int k = 0; k < j; ++k) {
+                T a = lower ? sA[j + k*n] : sA[k + j*n];
+                t -= a * a;
+            }
+            if (t <= 0) {
+                sA[j + j*n] = t;
+                sfail = j + 1;      //use fortran 1-based index
+            }
+            else
+                sA[j + j*n] = sqrt(t);
+        }
+        __syncthreads();
+        if (sfail) {
+            nc = j + 1;
+            break;
+        }
+
+        // compute the rest of the j-th column of L (or row of U)
+        if (tid > j && tid < n) {
+            T d = sA[j + j*n];
+            if (lower) {
+                T t = sA[tid + j*n];
+                for (rocblas_int k = 0; k < j; ++k)
+                    t -= sA[tid + k*n] * sA[j + k*n];
+                sA[tid + j*n] = t / d;
+            }
+            else {
+                T t = sA[j + tid*n];
+                for (rocblas_int k = 0; k < j; ++k)
+                    t -= sA[k + j*n] * sA[k + tid*n];
+                sA[j + tid*n] = t / d;
+            }
+        }
+        __syncthreads();
+    }
+
+    // write back the computed part of the factor
+    for (rocblas_int k = tid; k < n*n; k += DIM) {
+        rocblas_int i = k % n, j = k / n;
+        if (lower ? (i >= j && j < nc) : (i <= j && i < nc))
+            A[i + j*lda] = sA[k];
+    }
+    if (tid == 0)
+        info[id] = sfail;
+}
+
+// true if the matrix can be factorized with the single-kernel path
+template <typename T>
+inline bool potf2_use_small(const rocblas_int n)
+{
+    return n <= POTF2_SMALL_SIZE && sizeof(T)*n*n <= POTF2_SMALL_LDS;
+}
+
+
+template <typename T>
+void rocsolver_potf2_getMemorySize(const rocblas_int n, const rocblas_int batch_count, size_t *size)
+{
+    // quick return (the single-kernel path needs no workspace either)
+    if (n == 0 || potf2_use_small<T>(n)) {
+        *size = 0;
+        return;
+    }
+
+    // work (for reduction in rocblas_dot) + pivotGPU
+    *size = rocsolver_workspace_size<T>(size_t((n-1)/ROCBLAS_DOT_NB + 2) * batch_count)
+            + rocsolver_workspace_size<T>(batch_count);
+}
+
 template <typename T, typename U>
 rocblas_status rocsolver_potf2_template(rocblas_handle handle,
                                         const rocblas_fill uplo, const rocblas_int n, U A,
@@ -47,27 +151,33 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
     // quick return
     if (n == 0 || batch_count == 0) 
         return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // small matrices are factorized in shared memory with a single kernel
+    if (potf2_use_small<T>(n)) {
+        hipLaunchKernelGGL((potf2_small<POTF2_SMALL_SIZE,T>), dim3(batch_count), dim3(POTF2_SMALL_SIZE),
+                  sizeof(T)*n*n, stream, uplo, n, A, shiftA, lda, strideA, info);
+        return rocblas_status_success;
+    }
     
     //constants for rocblas functions calls
-    T h_one = 1;
-    T h_minone = -1;
-    T *d_one, *d_minone;
-    hipMalloc(&d_one, sizeof(T));
-    hipMemcpy(d_one, &h_one, sizeof(T), hipMemcpyHostToDevice);
-    hipMalloc(&d_minone, sizeof(T));
-    hipMemcpy(d_minone, &h_minone, sizeof(T), hipMemcpyHostToDevice);
-
-    // (TODO) THIS SHOULD BE DONE WITH THE HANDLE MEMORY ALLOCATOR
+    T* constants = rocsolver_constants<T>(handle);
+    if (!constants)
+        return rocblas_status_memory_error;
+    T* d_one = constants + 2;     //constant 1 in device
+    T* d_minone = constants;      //constant -1 in device
+
     // workspace on GPU (for reduction in rocblas_dot)
-    size_t sizeW = sizeof(T) * ((n-1)/ROCBLAS_DOT_NB + 2) * batch_count;
-    T* work;
-    hipMalloc(&work, sizeW);
+    size_t sizeW = ((n-1)/ROCBLAS_DOT_NB + 2) * batch_count;
+    rocsolver_workspace_frame frame(handle);
+    T* work = frame.alloc<T>(sizeW);
     //diagonal info in device (device memory workspace to avoid synchronization with CPU)
-    T *pivotGPU; 
-    hipMalloc(&pivotGPU, sizeof(T)*batch_count);
+    T *pivotGPU = frame.alloc<T>(batch_count);
+    if (!work || !pivotGPU)
+        return rocblas_status_memory_error;
 
-    hipStream_t stream;
-    rocblas_get_stream(handle, &stream);
     rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
     dim3 gridReset(blocksReset, 1, 1);
     dim3 threads(BLOCKSIZE, 1, 1);
@@ -117,11 +227,6 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
         }
     }
 
-    hipFree(pivotGPU);
-    hipFree(d_minone);
-    hipFree(d_one);
-    hipFree(work);
-
     return rocblas_status_success;
 }
 
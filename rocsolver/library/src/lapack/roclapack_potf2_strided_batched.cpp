@@ -19,6 +19,15 @@ rocblas_status rocsolver_potf2_strided_batched_impl(rocblas_handle handle, const
     if (n < 0 || lda < n || batch_count < 0)
         return rocblas_status_invalid_size;
 
+    // memory management
+    size_t size;
+    rocsolver_potf2_getMemorySize<T>(n,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
     return rocsolver_potf2_template<T>(handle,uplo,n,
                                     A,0,    //the matrix is shifted 0 entries (will work on the entire matrix)
                                     lda,strideA,
@@ -21,7 +21,16 @@ rocblas_status rocsolver_potrf_impl(rocblas_handle handle, const rocblas_fill up
     rocblas_stride strideA = 0;
     rocblas_int batch_count = 1;
 
-    return rocsolver_potrf_template<T>(handle,uplo,n,
+    // memory management
+    size_t size;
+    rocsolver_potrf_getMemorySize<T>(n,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_potrf_template<false,false,T>(handle,uplo,n,
                                     A,0,    //the matrix is shifted 0 entries (will work on the entire matrix)
                                     lda,strideA,
                                     info,batch_count);
@@ -14,19 +14,272 @@
 #include "rocblas.hpp"
 #include "rocsolver.h"
 #include "common_device.hpp"
+#include "rocsolver_handle.hpp"
 #include "ideal_sizes.hpp"
 #include "roclapack_potf2.hpp"
 
+// idx maps the entries of iinfo to those of info when the batch was compacted (early exit); 
+// if it is null the mapping is the identity
 template<typename U>
-__global__ void chk_positive(rocblas_int *iinfo, rocblas_int *info, int j) 
+__global__ void chk_positive(rocblas_int *iinfo, rocblas_int *info, int j, const rocblas_int *idx, const rocblas_int batch_count) 
 {
-    int id = hipBlockIdx_x;
+    int id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
 
-    if (info[id] == 0 && iinfo[id] > 0)
-            info[id] = iinfo[id] + j;   
+    if (id < batch_count) {
+        rocblas_int b = idx ? idx[id] : id;
+        if (info[b] == 0 && iinfo[id] > 0)
+            info[b] = iinfo[id] + j;   
+    }
+}
+
+// blocked algorithms of potrf
+typedef enum {
+    potrf_right_looking,    // the trailing matrix is updated after each block column is factorized
+    potrf_left_looking,     // each block column is updated with the previous ones just before it is factorized
+    potrf_recursive         // the matrix is split in halves, so that most of the work is done by large syrk calls
+} potrf_algorithm;
+
+// algorithm used to factorize n-by-n matrices. Large matrices are factorized recursively; at mid sizes
+// the left-looking variant is used for batches, as it writes every block column of the matrices only once
+// (instead of updating the whole trailing matrices after every block)
+inline potrf_algorithm potrf_select_algorithm(const rocblas_int n, const rocblas_int batch_count)
+{
+    if (n >= POTRF_RECURSIVE_MINSIZE)
+        return potrf_recursive;
+    if (batch_count >= POTRF_LEFTLOOKING_MINBATCH)
+        return potrf_left_looking;
+    return potrf_right_looking;
+}
+
+// workspace of the compacted batch used by early exit (pointers, positions and count)
+template <typename T>
+size_t potrf_early_exit_size(const rocblas_int batch_count)
+{
+    if (batch_count < 2)
+        return 0;
+    return rocsolver_workspace_size<T*>(batch_count) + rocsolver_workspace_size<rocblas_int>(batch_count)
+           + rocsolver_workspace_size<rocblas_int>(1);
+}
+
+template <typename T>
+void rocsolver_potrf_getMemorySize(const rocblas_int n, const rocblas_int batch_count, size_t *size)
+{
+    // if the matrix is small, the unblocked variant is used
+    if (n < POTRF_POTF2_SWITCHSIZE) {
+        rocsolver_potf2_getMemorySize<T>(n,batch_count,size);
+        return;
+    }
+
+    // max(potf2 (on the diagonal blocks), trsm)
+    rocsolver_potf2_getMemorySize<T>(POTRF_POTF2_SWITCHSIZE,batch_count,size);
+    *size = std::max(*size,rocblasCall_trsm_memsize<T>(batch_count));
+
+    // + iinfo and compacted batch (of every level of the recursion for the recursive variant)
+    size_t s = rocsolver_workspace_size<rocblas_int>(batch_count) + potrf_early_exit_size<T>(batch_count);
+    if (potrf_select_algorithm(n,batch_count) == potrf_recursive) {
+        for (rocblas_int nn = n; nn > POTRF_POTF2_SWITCHSIZE; nn -= nn / 2)
+            *size += s;
+    }
+    else
+        *size += s;
+}
+
+// Block column j (of jb columns) of the blocked algorithms: the diagonal block is factorized and
+// the rest of the block row (upper) or column (lower) of the factor is computed. For the left-looking
+// variant they are first updated with the previous blocks, for the right-looking variant the trailing
+// matrix is updated at the end. iinfo is used for the diagonal block; idx as in chk_positive.
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_potrf_block(rocblas_handle handle, const rocblas_fill uplo, const bool left,
+                                     const rocblas_int n, const rocblas_int j, const rocblas_int jb, U A,
+                                     const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA,
+                                     rocblas_int *iinfo, rocblas_int *info, const rocblas_int *idx,
+                                     const rocblas_int batch_count, T* d_one, T* d_minone)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+
+    if (uplo == rocblas_fill_upper) { // Compute the Cholesky factorization A = U'*U.
+        // (left-looking) update diagonal block with the previous rows of U
+        if (left && j > 0)
+            rocblasCall_syrk<T>(handle, uplo, rocblas_operation_transpose, jb, j, d_minone,
+                            A, shiftA + idx2D(0,j,lda), lda, strideA, d_one,
+                            A, shiftA + idx2D(j,j,lda), lda, strideA, batch_count);
+
+        // Factor diagonal and subdiagonal blocks 
+        rocsolver_potf2_template<T>(handle, uplo, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, iinfo, batch_count);
+        
+        // test for non-positive-definiteness.
+        hipLaunchKernelGGL(chk_positive<U>,dim3(blocksReset),dim3(BLOCKSIZE),0,stream,iinfo,info,j,idx,batch_count);
+        
+        if (j + jb < n) {
+            // (left-looking) update block row with the previous rows of U
+            if (left && j > 0)
+                rocblasCall_gemm<BATCHED,STRIDED,T>(handle, rocblas_operation_transpose, rocblas_operation_none,
+                                jb, n - j - jb, j, d_minone,
+                                A, shiftA + idx2D(0,j,lda), lda, strideA,
+                                A, shiftA + idx2D(0,j+jb,lda), lda, strideA, d_one,
+                                A, shiftA + idx2D(j,j+jb,lda), lda, strideA, batch_count);
+
+            // compute block row of U
+            rocblasCall_trsm<T>(handle, rocblas_side_left, uplo, rocblas_operation_transpose,
+                                rocblas_diagonal_non_unit, jb, (n - j - jb), d_one,
+                                A, shiftA + idx2D(j, j, lda), lda, strideA, 
+                                A, shiftA + idx2D(j, j + jb, lda), lda, strideA, batch_count);
+
+            // (right-looking) update trailing submatrix
+            if (!left)
+                rocblasCall_syrk<T>(handle, uplo, rocblas_operation_transpose, n-j-jb, jb, d_minone,
+                                A, shiftA + idx2D(j,j+jb,lda), lda, strideA, d_one,
+                                A, shiftA + idx2D(j+jb,j+jb,lda), lda, strideA, batch_count);
+        }
+
+    } else { // Compute the Cholesky factorization A = L'*L.
+        // (left-looking) update diagonal block with the previous columns of L
+        if (left && j > 0)
+            rocblasCall_syrk<T>(handle, uplo, rocblas_operation_none, jb, j, d_minone,
+                            A, shiftA + idx2D(j,0,lda), lda, strideA, d_one,
+                            A, shiftA + idx2D(j,j,lda), lda, strideA, batch_count);
+
+        // Factor diagonal and subdiagonal blocks 
+        rocsolver_potf2_template<T>(handle, uplo, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, iinfo, batch_count);
+        
+        // test for non-positive-definiteness.
+        hipLaunchKernelGGL(chk_positive<U>,dim3(blocksReset),dim3(BLOCKSIZE),0,stream,iinfo,info,j,idx,batch_count);
+        
+        if (j + jb < n) {
+            // (left-looking) update block column with the previous columns of L
+            if (left && j > 0)
+                rocblasCall_gemm<BATCHED,STRIDED,T>(handle, rocblas_operation_none, rocblas_operation_transpose,
+                                n - j - jb, jb, j, d_minone,
+                                A, shiftA + idx2D(j+jb,0,lda), lda, strideA,
+                                A, shiftA + idx2D(j,0,lda), lda, strideA, d_one,
+                                A, shiftA + idx2D(j+jb,j,lda), lda, strideA, batch_count);
+
+            // compute block column of L
+            rocblasCall_trsm<T>(handle, rocblas_side_right, uplo, rocblas_operation_transpose,
+                                rocblas_diagonal_non_unit, (n - j - jb), jb, d_one,
+                                A, shiftA + idx2D(j, j, lda), lda, strideA, 
+                                A, shiftA + idx2D(j + jb, j, lda), lda, strideA, batch_count);
+
+            // (right-looking) update trailing submatrix
+            if (!left)
+                rocblasCall_syrk<T>(handle, uplo, rocblas_operation_none, n-j-jb, jb, d_minone,
+                                A, shiftA + idx2D(j+jb,j,lda), lda, strideA, d_one,
+                                A, shiftA + idx2D(j+jb,j+jb,lda), lda, strideA, batch_count);
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_potrf_recursive(rocblas_handle handle, const rocblas_fill uplo, const bool early,
+                                        const rocblas_int n, U A, const rocblas_int shiftA,
+                                        const rocblas_int lda, const rocblas_stride strideA,
+                                        rocblas_int *info, const rocblas_int batch_count);
+
+// Trailing half of the recursive factorization: the n2-by-n2 trailing matrix at A(n1,n1) is
+// updated with trsm and syrk, and then factorized. iinfo receives the info of the trailing matrix.
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_potrf_recursive_trailing(rocblas_handle handle, const rocblas_fill uplo, const bool early,
+                                        const rocblas_int n1, const rocblas_int n2, U A, const rocblas_int shiftA,
+                                        const rocblas_int lda, const rocblas_stride strideA,
+                                        rocblas_int *iinfo, const rocblas_int batch_count)
+{
+    //constants for rocblas functions calls
+    T* constants = rocsolver_constants<T>(handle);
+    if (!constants)
+        return rocblas_status_memory_error;
+    T* d_one = constants + 2;     //constant 1 in device
+    T* d_minone = constants;      //constant -1 in device
+
+    if (uplo == rocblas_fill_upper) {
+        rocblasCall_trsm<T>(handle, rocblas_side_left, uplo, rocblas_operation_transpose,
+                            rocblas_diagonal_non_unit, n1, n2, d_one,
+                            A, shiftA, lda, strideA,
+                            A, shiftA + idx2D(0, n1, lda), lda, strideA, batch_count);
+
+        rocblasCall_syrk<T>(handle, uplo, rocblas_operation_transpose, n2, n1, d_minone,
+                            A, shiftA + idx2D(0, n1, lda), lda, strideA, d_one,
+                            A, shiftA + idx2D(n1, n1, lda), lda, strideA, batch_count);
+    }
+    else {
+        rocblasCall_trsm<T>(handle, rocblas_side_right, uplo, rocblas_operation_transpose,
+                            rocblas_diagonal_non_unit, n2, n1, d_one,
+                            A, shiftA, lda, strideA,
+                            A, shiftA + idx2D(n1, 0, lda), lda, strideA, batch_count);
+
+        rocblasCall_syrk<T>(handle, uplo, rocblas_operation_none, n2, n1, d_minone,
+                            A, shiftA + idx2D(n1, 0, lda), lda, strideA, d_one,
+                            A, shiftA + idx2D(n1, n1, lda), lda, strideA, batch_count);
+    }
+
+    return rocsolver_potrf_recursive<BATCHED,STRIDED,T>(handle, uplo, early, n2, A, shiftA + idx2D(n1, n1, lda), 
+                                                        lda, strideA, iinfo, batch_count);
+}
+
+// Recursive Cholesky factorization: the leading half is factorized, the trailing half is
+// updated with trsm and syrk, and then factorized in turn. info is set as returned by potf2.
+// With early exit, the trailing half is only processed for the matrices whose leading half is positive definite
+// (the batch is only compacted for halves of at least EARLY_EXIT_INTERVAL blocks, as this synchronizes the stream).
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_potrf_recursive(rocblas_handle handle, const rocblas_fill uplo, const bool early,
+                                        const rocblas_int n, U A, const rocblas_int shiftA,
+                                        const rocblas_int lda, const rocblas_stride strideA,
+                                        rocblas_int *info, const rocblas_int batch_count)
+{
+    // base case
+    if (n <= POTRF_POTF2_SWITCHSIZE)
+        return rocsolver_potf2_template<T>(handle, uplo, n, A, shiftA, lda, strideA, info, batch_count);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+    rocblas_int n1 = n / 2;
+    rocblas_int n2 = n - n1;
+    rocblas_status status;
+
+    // factorize leading half
+    status = rocsolver_potrf_recursive<BATCHED,STRIDED,T>(handle, uplo, early, n1, A, shiftA, lda, strideA, info, batch_count);
+    if (status != rocblas_status_success)
+        return status;
+
+    //info of the trailing half (and compacted batch for early exit)
+    rocsolver_workspace_frame frame(handle);
+    rocblas_int *iinfo = frame.alloc<rocblas_int>(batch_count);
+    if (!iinfo)
+        return rocblas_status_memory_error;
+
+    // update and factorize trailing half
+    rocblas_int *idx = nullptr;
+    rocblas_int active = batch_count;
+    if (early && batch_count > 1 && n >= EARLY_EXIT_INTERVAL*POTRF_POTF2_SWITCHSIZE) {
+        T** Aarr = frame.alloc<T*>(batch_count);
+        idx = frame.alloc<rocblas_int>(batch_count);
+        rocblas_int *count = frame.alloc<rocblas_int>(1);
+        if (!Aarr || !idx || !count)
+            return rocblas_status_memory_error;
+
+        active = rocsolver_compact_batch<T>(stream, A, strideA, info, Aarr, idx, count, batch_count);
+        if (active == 0)
+            return rocblas_status_success;
+        status = rocsolver_potrf_recursive_trailing<true,false,T>(handle, uplo, early, n1, n2, cast2constPointer<T>(Aarr), shiftA,
+                                                                  lda, strideA, iinfo, active);
+    }
+    else
+        status = rocsolver_potrf_recursive_trailing<BATCHED,STRIDED,T>(handle, uplo, early, n1, n2, A, shiftA,
+                                                                       lda, strideA, iinfo, batch_count);
+    if (status != rocblas_status_success)
+        return status;
+
+    // test for non-positive-definiteness.
+    rocblas_int blocksReset = (active - 1) / BLOCKSIZE + 1;
+    hipLaunchKernelGGL(chk_positive<U>,dim3(blocksReset),dim3(BLOCKSIZE),0,stream,iinfo,info,n1,idx,active);
+
+    return rocblas_status_success;
 }
 
-template <typename T, typename U>
+template <bool BATCHED, bool STRIDED, typename T, typename U>
 rocblas_status rocsolver_potrf_template(rocblas_handle handle,
                                         const rocblas_fill uplo, const rocblas_int n, U A,
                                         const rocblas_int shiftA,
@@ -41,98 +294,67 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
     if (n < POTRF_POTF2_SWITCHSIZE) 
         return rocsolver_potf2_template<T>(handle, uplo, n, A, shiftA, lda, strideA, info, batch_count);
 
-    // **** THIS SYNCHRONIZATION WILL BE REQUIRED UNTIL
-    //      TRSM_BATCH FUNCTIONALITY IS ENABLED. ****
-    #ifdef batched
-        T* AA[batch_count];
-        hipMemcpy(AA, A, batch_count*sizeof(T*), hipMemcpyDeviceToHost);
-    #else
-        T* AA = A;
-    #endif
+    // with early exit, the matrices of the batch that are not positive definite are dropped
+    // every EARLY_EXIT_INTERVAL block columns (in between, the matrices that fail are still updated)
+    bool early = rocsolver_early_exit(handle) && batch_count > 1;
+
+    potrf_algorithm algo = potrf_select_algorithm(n, batch_count);
+    if (algo == potrf_recursive)
+        return rocsolver_potrf_recursive<BATCHED,STRIDED,T>(handle, uplo, early, n, A, shiftA, lda, strideA, info, batch_count);
+    bool left = (algo == potrf_left_looking);
 
     //constants for rocblas functions calls
-    T h_one = 1;
-    T h_minone = -1;
-    T *d_one, *d_minone;
-    hipMalloc(&d_one, sizeof(T));
-    hipMemcpy(d_one, &h_one, sizeof(T), hipMemcpyHostToDevice);
-    hipMalloc(&d_minone, sizeof(T));
-    hipMemcpy(d_minone, &h_minone, sizeof(T), hipMemcpyHostToDevice);
-
-    // (TODO) THIS SHOULD BE DONE WITH THE HANDLE MEMORY ALLOCATOR
+    T* constants = rocsolver_constants<T>(handle);
+    if (!constants)
+        return rocblas_status_memory_error;
+    T* d_one = constants + 2;     //constant 1 in device
+    T* d_minone = constants;      //constant -1 in device
+
     //info in device (device memory workspace to avoid synchronization with CPU)
-    rocblas_int *iinfo; 
-    hipMalloc(&iinfo, sizeof(rocblas_int)*batch_count);
+    rocsolver_workspace_frame frame(handle);
+    rocblas_int *iinfo = frame.alloc<rocblas_int>(batch_count);
+    if (!iinfo)
+        return rocblas_status_memory_error;
+
+    //compacted batch for early exit
+    T** Aarr = nullptr;
+    rocblas_int *idx = nullptr;
+    rocblas_int *count = nullptr;
+    if (early) {
+        Aarr = frame.alloc<T*>(batch_count);
+        idx = frame.alloc<rocblas_int>(batch_count);
+        count = frame.alloc<rocblas_int>(1);
+        if (!Aarr || !idx || !count)
+            return rocblas_status_memory_error;
+    }
 
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
     rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
-    dim3 gridReset(blocksReset, 1, 1);
-    dim3 threads(BLOCKSIZE, 1, 1);
-    T* M;
-    rocblas_int jb;
+    rocblas_int jb, active;
+    rocblas_status status;
 
     //info=0 (starting with a positive definite matrix)
-    hipLaunchKernelGGL(reset_info,gridReset,threads,0,stream,info,batch_count,0);
-
-    // **** TRSM_BATCH IS EXECUTED IN A FOR-LOOP UNTIL 
-    //      FUNCITONALITY IS ENABLED. ****
-
-    if (uplo == rocblas_fill_upper) { // Compute the Cholesky factorization A = U'*U.
-        for (rocblas_int j = 0; j < n; j += POTRF_POTF2_SWITCHSIZE) {
-            // Factor diagonal and subdiagonal blocks 
-            jb = min(n - j, POTRF_POTF2_SWITCHSIZE);  //number of columns in the block
-            hipLaunchKernelGGL(reset_info,gridReset,threads,0,stream,iinfo,batch_count,0);
-            rocsolver_potf2_template<T>(handle, uplo, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, iinfo, batch_count);
-            
-            // test for non-positive-definiteness.
-            hipLaunchKernelGGL(chk_positive<U>,gridReset,threads,0,stream,iinfo,info,j);
-            
-            if (j + jb < n) {
-                // update trailing submatrix
-                for (int b=0;b<batch_count;++b) {
-                    M = load_ptr_batch<T>(AA,b,shiftA,strideA);
-                    rocblas_trsm(handle, rocblas_side_left, uplo, rocblas_operation_transpose,
-                             rocblas_diagonal_non_unit, jb, (n - j - jb), d_one,
-                             (M + idx2D(j, j, lda)), lda, (M + idx2D(j, j + jb, lda)), lda);
-                }
+    hipLaunchKernelGGL(reset_info,dim3(blocksReset),dim3(BLOCKSIZE),0,stream,info,batch_count,0);
 
-                rocblasCall_syrk<T>(handle, uplo, rocblas_operation_transpose, n-j-jb, jb, d_minone,
-                                A, shiftA + idx2D(j,j+jb,lda), lda, strideA, d_one,
-                                A, shiftA + idx2D(j+jb,j+jb,lda), lda, strideA, batch_count);
-            }
-        }
+    for (rocblas_int j = 0; j < n; j += POTRF_POTF2_SWITCHSIZE) {
+        jb = min(n - j, POTRF_POTF2_SWITCHSIZE);  //number of columns in the block
 
-    } else { // Compute the Cholesky factorization A = L'*L.
-        for (rocblas_int j = 0; j < n; j += POTRF_POTF2_SWITCHSIZE) {
-            // Factor diagonal and subdiagonal blocks 
-            jb = min(n - j, POTRF_POTF2_SWITCHSIZE);  //number of columns in the block
-            hipLaunchKernelGGL(reset_info,gridReset,threads,0,stream,iinfo,batch_count,0);
-            rocsolver_potf2_template<T>(handle, uplo, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, iinfo, batch_count);
-            
-            // test for non-positive-definiteness.
-            hipLaunchKernelGGL(chk_positive<U>,gridReset,threads,0,stream,iinfo,info,j);
-            
-            if (j + jb < n) {
-                // update trailing submatrix
-                for (int b=0;b<batch_count;++b) {
-                    M = load_ptr_batch<T>(AA,b,shiftA,strideA);
-                    rocblas_trsm(handle, rocblas_side_right, uplo, rocblas_operation_transpose,
-                             rocblas_diagonal_non_unit, (n - j - jb), jb, d_one,
-                             (M + idx2D(j, j, lda)), lda, (M + idx2D(j + jb, j, lda)), lda);
-                }
-
-                rocblasCall_syrk<T>(handle, uplo, rocblas_operation_none, n-j-jb, jb, d_minone,
-                                A, shiftA + idx2D(j+jb,j,lda), lda, strideA, d_one,
-                                A, shiftA + idx2D(j+jb,j+jb,lda), lda, strideA, batch_count);
-            }
+        if (early && j > 0) {
+            if ((j / POTRF_POTF2_SWITCHSIZE - 1) % EARLY_EXIT_INTERVAL == 0)
+                active = rocsolver_compact_batch<T>(stream, A, strideA, info, Aarr, idx, count, batch_count);
+            if (active == 0)
+                break;
+            status = rocsolver_potrf_block<true,false,T>(handle, uplo, left, n, j, jb, cast2constPointer<T>(Aarr), shiftA, lda, strideA,
+                                                         iinfo, info, idx, active, d_one, d_minone);
         }
+        else
+            status = rocsolver_potrf_block<BATCHED,STRIDED,T>(handle, uplo, left, n, j, jb, A, shiftA, lda, strideA,
+                                                              iinfo, info, nullptr, batch_count, d_one, d_minone);
+        if (status != rocblas_status_success)
+            return status;
     }
 
-    hipFree(iinfo);
-    hipFree(d_minone);
-    hipFree(d_one);
-
     return rocblas_status_success;
 }
 
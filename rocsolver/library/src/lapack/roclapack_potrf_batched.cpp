@@ -2,7 +2,6 @@
  * Copyright 2019-2020 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 
-#define batched
 #include "roclapack_potrf.hpp"
 
 template <typename T, typename U>
@@ -22,7 +21,16 @@ rocblas_status rocsolver_potrf_batched_impl(rocblas_handle handle, const rocblas
 
     rocblas_stride strideA = 0;
 
-    return rocsolver_potrf_template<T>(handle,uplo,n,
+    // memory management
+    size_t size;
+    rocsolver_potrf_getMemorySize<T>(n,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_potrf_template<true,false,T>(handle,uplo,n,
                                     A,0,    //the matrix is shifted 0 entries (will work on the entire matrix)
                                     lda,strideA,
                                     info,batch_count);
@@ -48,5 +56,3 @@ rocsolver_dpotrf_batched(rocblas_handle handle, const rocblas_fill uplo, const r
                  double *const A[], const rocblas_int lda, rocblas_int* info, const rocblas_int batch_count) {
   return rocsolver_potrf_batched_impl<double>(handle, uplo, n, A, lda, info, batch_count);
 }
-
-#undef batched
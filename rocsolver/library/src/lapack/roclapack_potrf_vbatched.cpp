@@ -0,0 +1,62 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_vbatched.hpp"
+
+template <typename T>
+rocblas_status rocsolver_potrf_vbatched_impl(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int *n,
+                                             T *const A[], const rocblas_int *lda, rocblas_int* info,
+                                             const rocblas_int batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    //logging is missing ???
+
+    if (batch_count < 0)
+        return rocblas_status_invalid_size;
+    if (!n || !A || !lda || !info)
+        return rocblas_status_invalid_pointer;
+
+    // group the matrices by size
+    std::vector<rocsolver_vbatch_group> groups;
+    std::vector<rocblas_int> order;
+    rocblas_status status = rocsolver_vbatch_groups(handle,n,nullptr,lda,batch_count,groups,order);
+    if (status != rocblas_status_success)
+        return status;
+
+    // memory management
+    size_t size;
+    rocsolver_potrf_vbatched_getMemorySize<T>(groups,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_potrf_vbatched_template<T>(handle,uplo,groups,order,A,lda,info,batch_count);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrf_vbatched(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int *n,
+                 float *const A[], const rocblas_int *lda, rocblas_int* info, const rocblas_int batch_count)
+{
+    return rocsolver_potrf_vbatched_impl<float>(handle, uplo, n, A, lda, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrf_vbatched(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int *n,
+                 double *const A[], const rocblas_int *lda, rocblas_int* info, const rocblas_int batch_count)
+{
+    return rocsolver_potrf_vbatched_impl<double>(handle, uplo, n, A, lda, info, batch_count);
+}
+
+} //extern C
@@ -0,0 +1,63 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_potrs.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_potrs_impl(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, const rocblas_int nrhs,
+                                        U A, const rocblas_int lda, U B, const rocblas_int ldb) {
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    
+    //logging is missing ???    
+
+    if (uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_not_implemented;
+    if (n < 0 || nrhs < 0 || lda < n || ldb < n) 
+        return rocblas_status_invalid_size;
+    if (!A || !B)
+        return rocblas_status_invalid_pointer;
+
+    rocblas_stride strideA = 0;
+    rocblas_stride strideB = 0;
+    rocblas_int batch_count = 1;
+
+    // memory management
+    size_t size;
+    rocsolver_potrs_getMemorySize<T>(n,nrhs,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_potrs_template<T>(handle,uplo,n,nrhs,
+                                       A,0,    //The matrix is shifted 0 entries (will work on the entire matrix)
+                                       lda,strideA,
+                                       B,0,ldb,strideB,
+                                       batch_count);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spotrs(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 const rocblas_int nrhs, float *A, const rocblas_int lda, float *B, const rocblas_int ldb) 
+{
+    return rocsolver_potrs_impl<float>(handle, uplo, n, nrhs, A, lda, B, ldb);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpotrs(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 const rocblas_int nrhs, double *A, const rocblas_int lda, double *B, const rocblas_int ldb) 
+{
+    return rocsolver_potrs_impl<double>(handle, uplo, n, nrhs, A, lda, B, ldb);
+}
+
+} //extern C
@@ -0,0 +1,76 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#ifndef ROCLAPACK_POTRS_HPP
+#define ROCLAPACK_POTRS_HPP
+
+#include "rocblas.hpp"
+#include "common_device.hpp"
+#include "rocsolver_handle.hpp"
+
+template <typename T>
+void rocsolver_potrs_getMemorySize(const rocblas_int n, const rocblas_int nrhs, const rocblas_int batch_count, size_t *size)
+{
+    // quick return
+    if (n == 0 || nrhs == 0) {
+        *size = 0;
+        return;
+    }
+
+    // trsm
+    *size = rocblasCall_trsm_memsize<T>(batch_count);
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_potrs_template(rocblas_handle handle, const rocblas_fill uplo,
+                         const rocblas_int n, const rocblas_int nrhs, U A, const rocblas_int shiftA,
+                         const rocblas_int lda, const rocblas_stride strideA, U B,
+                         const rocblas_int shiftB, const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count) 
+{
+    // quick return
+    if (n == 0 || nrhs == 0 || batch_count == 0) {
+      return rocblas_status_success;
+    }
+
+    //constants to use when calling rocablas functions
+    T* constants = rocsolver_constants<T>(handle);
+    if (!constants)
+        return rocblas_status_memory_error;
+    T* oneInt = constants + 2;    //constant 1 in device
+
+    if (uplo == rocblas_fill_upper) {
+
+        // solve U**T *X = B, overwriting B with X
+        rocblasCall_trsm<T>(handle, rocblas_side_left, rocblas_fill_upper,
+                            rocblas_operation_transpose, rocblas_diagonal_non_unit, n, nrhs,
+                            oneInt, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count);
+
+        // solve U*X = B, overwriting B with X
+        rocblasCall_trsm<T>(handle, rocblas_side_left, rocblas_fill_upper,
+                            rocblas_operation_none, rocblas_diagonal_non_unit, n, nrhs,
+                            oneInt, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count);
+
+    } else {
+
+        // solve L*X = B, overwriting B with X
+        rocblasCall_trsm<T>(handle, rocblas_side_left, rocblas_fill_lower,
+                            rocblas_operation_none, rocblas_diagonal_non_unit, n, nrhs,
+                            oneInt, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count);
+
+        // solve L**T *X = B, overwriting B with X
+        rocblasCall_trsm<T>(handle, rocblas_side_left, rocblas_fill_lower,
+                            rocblas_operation_transpose, rocblas_diagonal_non_unit, n, nrhs,
+                            oneInt, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count);
+    }
+
+    return rocblas_status_success;
+}
+
+
+#endif /* ROCLAPACK_POTRS_HPP */
@@ -0,0 +1,167 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#ifndef ROCLAPACK_PPTRF_HPP
+#define ROCLAPACK_PPTRF_HPP
+
+#include <hip/hip_runtime.h>
+#include "rocblas.hpp"
+#include "rocsolver.h"
+#include "ideal_sizes.hpp"
+#include "common_device.hpp"
+#include "rocsolver_handle.hpp"
+
+// Position in packed storage of the entry (r,c), r >= c, of the factor seen as a lower triangular
+// matrix L: L(r,c) itself if uplo is lower, or U(c,r) if uplo is upper (A = U'*U = L*L' with L = U').
+// With this mapping the same kernels factorize and solve with both storage formats.
+__device__ inline size_t pp_loc(const bool upper, const rocblas_int n, const rocblas_int r, const rocblas_int c)
+{
+    return upper ? c + size_t(r)*(r+1)/2 : r + size_t(2*n-c-1)*c/2;
+}
+
+// L(j,j) = sqrt(L(j,j)). As in LAPACK, the factorization of a matrix stops at the first non-positive
+// pivot: info is set and all the following kernels skip the matrix.
+template <typename T, typename U>
+__global__ void pptrf_diag(const bool upper, const rocblas_int n, const rocblas_int j,
+                           U AA, const rocblas_int shiftA, const rocblas_stride strideA, rocblas_int *info)
+{
+    int id = hipBlockIdx_x;
+    if (info[id])
+        return;
+
+    T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+    size_t loc = pp_loc(upper,n,j,j);
+    T t = A[loc];
+
+    if (t <= 0)
+        info[id] = j + 1;   //use fortran 1-based index
+    else
+        A[loc] = sqrt(t);
+}
+
+// L(r,j) = L(r,j) / L(j,j) for r > j
+template <typename T, typename U>
+__global__ void pptrf_scale(const bool upper, const rocblas_int n, const rocblas_int j,
+                            U AA, const rocblas_int shiftA, const rocblas_stride strideA, const rocblas_int *info)
+{
+    int id = hipBlockIdx_z;
+    rocblas_int r = j + 1 + hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (r < n && !info[id]) {
+        T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+        A[pp_loc(upper,n,r,j)] /= A[pp_loc(upper,n,j,j)];
+    }
+}
+
+// L(r,k) = L(r,k) - L(r,j)*L(k,j) for the columns k0 <= k < k0 + gridDim.y of the panel, r >= k
+template <typename T, typename U>
+__global__ void pptrf_update(const bool upper, const rocblas_int n, const rocblas_int j, const rocblas_int k0,
+                             U AA, const rocblas_int shiftA, const rocblas_stride strideA, const rocblas_int *info)
+{
+    int id = hipBlockIdx_z;
+    rocblas_int k = k0 + hipBlockIdx_y;
+    rocblas_int r = k0 + hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (r < n && r >= k && !info[id]) {
+        T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+        A[pp_loc(upper,n,r,k)] -= A[pp_loc(upper,n,r,j)] * A[pp_loc(upper,n,k,j)];
+    }
+}
+
+// Trailing update with the jb columns of the panel starting at column j:
+// L(r,k) = L(r,k) - sum_p L(r,p)*L(k,p) for k >= j+jb, r >= k and j <= p < j+jb.
+// Each thread computes one entry of the trailing triangle reading the panel directly from packed storage.
+template <typename T, typename U>
+__global__ void pptrf_syrk(const bool upper, const rocblas_int n, const rocblas_int j, const rocblas_int jb,
+                           U AA, const rocblas_int shiftA, const rocblas_stride strideA, const rocblas_int *info)
+{
+    int id = hipBlockIdx_z;
+    rocblas_int k = j + jb + hipBlockIdx_y;
+    rocblas_int r = j + jb + hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (r < n && r >= k && !info[id]) {
+        T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+        T t = 0;
+        for (rocblas_int p = j; p < j + jb; ++p)
+            t += A[pp_loc(upper,n,r,p)] * A[pp_loc(upper,n,k,p)];
+        A[pp_loc(upper,n,r,k)] -= t;
+    }
+}
+
+
+template <typename T>
+void rocsolver_pptrf_getMemorySize(const rocblas_int n, const rocblas_int batch_count, size_t *size)
+{
+    // the factorization works in place and only uses info
+    *size = 0;
+}
+
+// Unblocked right-looking factorization of the jb columns of the panel starting at column j.
+// Only the columns of the panel are updated.
+template <typename T, typename U>
+void rocsolver_pptf2(hipStream_t stream, const bool upper, const rocblas_int n, const rocblas_int j, const rocblas_int jb,
+                     U A, const rocblas_int shiftA, const rocblas_stride strideA, rocblas_int *info, const rocblas_int batch_count)
+{
+    rocblas_int blocks;
+
+    for (rocblas_int k = j; k < j + jb; ++k) {
+        hipLaunchKernelGGL(pptrf_diag<T>,dim3(batch_count),dim3(1),0,stream,
+                           upper,n,k,A,shiftA,strideA,info);
+
+        if (k < n - 1) {
+            blocks = (n - k - 2) / BLOCKSIZE + 1;
+            hipLaunchKernelGGL(pptrf_scale<T>,dim3(blocks,1,batch_count),dim3(BLOCKSIZE),0,stream,
+                               upper,n,k,A,shiftA,strideA,info);
+        }
+
+        if (k < j + jb - 1) {
+            blocks = (n - k - 2) / BLOCKSIZE + 1;
+            hipLaunchKernelGGL(pptrf_update<T>,dim3(blocks,j+jb-k-1,batch_count),dim3(BLOCKSIZE),0,stream,
+                               upper,n,k,k+1,A,shiftA,strideA,info);
+        }
+    }
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_pptrf_template(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                                        U A, const rocblas_int shiftA, const rocblas_stride strideA,
+                                        rocblas_int *info, const rocblas_int batch_count)
+{
+    // quick return
+    if (batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+    rocblas_int blocksReset = (batch_count - 1) / BLOCKSIZE + 1;
+
+    //info=0 (starting with a positive definite matrix)
+    hipLaunchKernelGGL(reset_info,dim3(blocksReset),dim3(BLOCKSIZE),0,stream,info,batch_count,0);
+
+    const bool upper = (uplo == rocblas_fill_upper);
+    rocblas_int jb, blocks;
+
+    // the panel of jb columns is factorized with the unblocked algorithm and then
+    // the trailing triangle is updated at once
+    for (rocblas_int j = 0; j < n; j += PPTRF_BLOCKSIZE) {
+        jb = min(n - j, PPTRF_BLOCKSIZE);
+
+        rocsolver_pptf2<T>(stream,upper,n,j,jb,A,shiftA,strideA,info,batch_count);
+
+        if (j + jb < n) {
+            blocks = (n - j - jb - 1) / BLOCKSIZE + 1;
+            hipLaunchKernelGGL(pptrf_syrk<T>,dim3(blocks,n-j-jb,batch_count),dim3(BLOCKSIZE),0,stream,
+                               upper,n,j,jb,A,shiftA,strideA,info);
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+#endif /* ROCLAPACK_PPTRF_HPP */
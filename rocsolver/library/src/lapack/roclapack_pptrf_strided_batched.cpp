@@ -0,0 +1,59 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_pptrf.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_pptrf_strided_batched_impl(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                                    U AP, const rocblas_stride strideA, rocblas_int* info, const rocblas_int batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    //logging is missing ???
+
+    if (uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_not_implemented;
+    if (n < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if (!AP || !info)
+        return rocblas_status_invalid_pointer;
+
+    // memory management
+    size_t size;
+    rocsolver_pptrf_getMemorySize<T>(n,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_pptrf_template<T>(handle,uplo,n,
+                                    AP,0,    //the matrix is shifted 0 entries (will work on the entire matrix)
+                                    strideA,
+                                    info,batch_count);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spptrf_strided_batched(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 float *AP, const rocblas_stride strideA, rocblas_int* info, const rocblas_int batch_count)
+{
+    return rocsolver_pptrf_strided_batched_impl<float>(handle, uplo, n, AP, strideA, info, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpptrf_strided_batched(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                 double *AP, const rocblas_stride strideA, rocblas_int* info, const rocblas_int batch_count)
+{
+    return rocsolver_pptrf_strided_batched_impl<double>(handle, uplo, n, AP, strideA, info, batch_count);
+}
+
+} //extern C
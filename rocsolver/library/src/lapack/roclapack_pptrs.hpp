@@ -0,0 +1,85 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#ifndef ROCLAPACK_PPTRS_HPP
+#define ROCLAPACK_PPTRS_HPP
+
+#include <hip/hip_runtime.h>
+#include "rocblas.hpp"
+#include "rocsolver.h"
+#include "ideal_sizes.hpp"
+#include "common_device.hpp"
+#include "rocsolver_handle.hpp"
+#include "roclapack_pptrf.hpp"
+
+// Solves L*L'*x = b for one column of B with the packed factor (see pp_loc). One block of DIM threads
+// per right hand side and matrix: the substitutions run column by column, thread 0 computes the
+// new entry of x and all the threads update the remaining entries of b.
+template <rocblas_int DIM, typename T, typename U>
+__global__ void pptrs_kernel(const bool upper, const rocblas_int n,
+                             U AA, const rocblas_int shiftA, const rocblas_stride strideA,
+                             U BB, const rocblas_int shiftB, const rocblas_int ldb, const rocblas_stride strideB)
+{
+    int id = hipBlockIdx_z;
+    int tid = hipThreadIdx_x;
+
+    T* A = load_ptr_batch<T>(AA,id,shiftA,strideA);
+    T* b = load_ptr_batch<T>(BB,id,shiftB,strideB) + size_t(hipBlockIdx_x)*ldb;
+
+    // solve L*y = b (forward substitution)
+    for (rocblas_int c = 0; c < n; ++c) {
+        if (tid == 0)
+            b[c] /= A[pp_loc(upper,n,c,c)];
+        __syncthreads();
+        for (rocblas_int r = c + 1 + tid; r < n; r += DIM)
+            b[r] -= A[pp_loc(upper,n,r,c)] * b[c];
+        __syncthreads();
+    }
+
+    // solve L'*x = y (backward substitution)
+    for (rocblas_int c = n - 1; c >= 0; --c) {
+        if (tid == 0)
+            b[c] /= A[pp_loc(upper,n,c,c)];
+        __syncthreads();
+        for (rocblas_int r = tid; r < c; r += DIM)
+            b[r] -= A[pp_loc(upper,n,c,r)] * b[c];
+        __syncthreads();
+    }
+}
+
+
+template <typename T>
+void rocsolver_pptrs_getMemorySize(const rocblas_int n, const rocblas_int nrhs, const rocblas_int batch_count, size_t *size)
+{
+    // the solve works in place
+    *size = 0;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_pptrs_template(rocblas_handle handle, const rocblas_fill uplo,
+                         const rocblas_int n, const rocblas_int nrhs, U A, const rocblas_int shiftA,
+                         const rocblas_stride strideA, U B, const rocblas_int shiftB,
+                         const rocblas_int ldb, const rocblas_stride strideB, const rocblas_int batch_count)
+{
+    // quick return
+    if (n == 0 || nrhs == 0 || batch_count == 0) {
+      return rocblas_status_success;
+    }
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // A = U'*U is solved as L*L' with L = U' (the kernel reads U by rows)
+    hipLaunchKernelGGL(pptrs_kernel<PPTRS_BLOCKSIZE,T>,dim3(nrhs,1,batch_count),dim3(PPTRS_BLOCKSIZE),0,stream,
+                       uplo == rocblas_fill_upper,n,A,shiftA,strideA,B,shiftB,ldb,strideB);
+
+    return rocblas_status_success;
+}
+
+#endif /* ROCLAPACK_PPTRS_HPP */
@@ -0,0 +1,65 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_pptrs.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_pptrs_batched_impl(rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,
+                                    const rocblas_int nrhs, U AP, U B, const rocblas_int ldb, const rocblas_int batch_count)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    //logging is missing ???
+
+    if (uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_not_implemented;
+    if (n < 0 || nrhs < 0 || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if (!AP || !B)
+        return rocblas_status_invalid_pointer;
+
+    rocblas_stride strideA = 0;
+    rocblas_stride strideB = 0;
+
+    // memory management
+    size_t size;
+    rocsolver_pptrs_getMemorySize<T>(n,nrhs,batch_count,&size);
+    if (rocsolver_workspace_query(handle,size))
+        return rocblas_status_success;
+    rocblas_status status = rocsolver_workspace_reserve(handle,size);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_pptrs_template<T>(handle,uplo,n,nrhs,
+                                       AP,0,    //The matrix is shifted 0 entries (will work on the entire matrix)
+                                       strideA,
+                                       B,0,ldb,strideB,
+                                       batch_count);
+}
+
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_spptrs_batched(rocblas_handle handle, const rocblas_fill uplo,
+                 const rocblas_int n, const rocblas_int nrhs, float *const AP[],
+                 float *const B[], const rocblas_int ldb, const rocblas_int batch_count)
+{
+    return rocsolver_pptrs_batched_impl<float>(handle, uplo, n, nrhs, AP, B, ldb, batch_count);
+}
+
+ROCSOLVER_EXPORT rocblas_status rocsolver_dpptrs_batched(rocblas_handle handle, const rocblas_fill uplo,
+                 const rocblas_int n, const rocblas_int nrhs, double *const AP[],
+                 double *const B[], const rocblas_int ldb, const rocblas_int batch_count)
+{
+    return rocsolver_pptrs_batched_impl<double>(handle, uplo, n, nrhs, AP, B, ldb, batch_count);
+}
+
+} //extern C
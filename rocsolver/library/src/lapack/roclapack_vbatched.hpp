@@ -0,0 +1,439 @@
+/************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#ifndef ROCLAPACK_VBATCHED_HPP
+#define ROCLAPACK_VBATCHED_HPP
+
+#include <hip/hip_runtime.h>
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
+#include "rocblas.hpp"
+#include "rocsolver.h"
+#include "ideal_sizes.hpp"
+#include "common_device.hpp"
+#include "rocsolver_handle.hpp"
+#include "roclapack_getrf.hpp"
+#include "roclapack_potrf.hpp"
+#include "roclapack_geqrf.hpp"
+
+// Matrices of a variable-size (vbatched) batch that have the same size. They are factorized
+// together by the batched template, which selects the algorithm for that size, so no matrix is padded.
+// order[first : first+count-1] are their positions in the batch. lda is the leading dimension shared by
+// most of them; the last staged matrices of the group have another one and are copied to the workspace
+// (with leading dimension lda) while the group is factorized.
+struct rocsolver_vbatch_group
+{
+    rocblas_int m, n, lda;
+    rocblas_int first, count;
+    rocblas_int staged;
+};
+
+// Copies the sizes of a vbatched batch to the host (this synchronizes the stream) and groups the
+// matrices by size; order receives the positions of the matrices in the batch, group after group.
+// If n is null the matrices are square (n = m).
+// Returns rocblas_status_invalid_size if a size is negative or a leading dimension is smaller than m.
+inline rocblas_status rocsolver_vbatch_groups(rocblas_handle handle, const rocblas_int *m, const rocblas_int *n,
+                                              const rocblas_int *lda, const rocblas_int batch_count,
+                                              std::vector<rocsolver_vbatch_group>& groups, std::vector<rocblas_int>& order)
+{
+    groups.clear();
+    order.clear();
+    if (batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    std::vector<rocblas_int> hm(batch_count), hn(batch_count), hlda(batch_count);
+    hipMemcpyAsync(hm.data(), m, sizeof(rocblas_int)*batch_count, hipMemcpyDeviceToHost, stream);
+    if (n)
+        hipMemcpyAsync(hn.data(), n, sizeof(rocblas_int)*batch_count, hipMemcpyDeviceToHost, stream);
+    hipMemcpyAsync(hlda.data(), lda, sizeof(rocblas_int)*batch_count, hipMemcpyDeviceToHost, stream);
+    hipStreamSynchronize(stream);
+    if (!n)
+        hn = hm;
+
+    std::map<std::pair<rocblas_int,rocblas_int>, std::vector<rocblas_int>> sizes;
+    for (rocblas_int b = 0; b < batch_count; ++b) {
+        if (hm[b] < 0 || hn[b] < 0 || hlda[b] < hm[b])
+            return rocblas_status_invalid_size;
+        sizes[std::make_pair(hm[b],hn[b])].push_back(b);
+    }
+
+    order.reserve(batch_count);
+    for (auto& s : sizes) {
+        // the most frequent leading dimension is used by the group
+        std::map<rocblas_int,rocblas_int> ldas;
+        for (rocblas_int b : s.second)
+            ldas[hlda[b]]++;
+        auto common = std::max_element(ldas.begin(), ldas.end(),
+                                       [](const std::pair<const rocblas_int,rocblas_int>& x,
+                                          const std::pair<const rocblas_int,rocblas_int>& y) { return x.second < y.second; });
+
+        rocsolver_vbatch_group g;
+        g.m = s.first.first;
+        g.n = s.first.second;
+        g.lda = common->first;
+        g.first = order.size();
+        g.count = s.second.size();
+        g.staged = g.count - common->second;
+        for (rocblas_int b : s.second) {
+            if (hlda[b] == g.lda)
+                order.push_back(b);
+        }
+        for (rocblas_int b : s.second) {
+            if (hlda[b] != g.lda)
+                order.push_back(b);
+        }
+        groups.push_back(g);
+    }
+
+    return rocblas_status_success;
+}
+
+// out[k] = A[order[k]]
+template <typename T>
+__global__ void vbatch_gather(T *const A[], const rocblas_int *order, T** out, const rocblas_int batch_count)
+{
+    int k = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (k < batch_count)
+        out[k] = A[order[k]];
+}
+
+// out[order[k]][i] = in[k*stride + i], for the n entries of the vectors of a group (pivots, scalars of the
+// Householder reflectors)
+template <typename T>
+__global__ void vbatch_scatter(const rocblas_int n, const T* in, const rocblas_stride stride,
+                               T *const out[], const rocblas_int *order)
+{
+    int k = hipBlockIdx_y;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (i < n)
+        out[order[k]][i] = in[k*stride + i];
+}
+
+// info[order[k]] = iinfo[k]
+template <typename T>
+__global__ void vbatch_scatter_info(const T *iinfo, T *info, const rocblas_int *order, const rocblas_int count)
+{
+    int k = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if (k < count)
+        info[order[k]] = iinfo[k];
+}
+
+// Copies the m-by-n matrices A[order[k]] (with leading dimension lda[order[k]]) to W + k*ldw*n (with
+// leading dimension ldw) and sets Aarr[k] to the copy, or copies them back if back is true
+template <typename T>
+__global__ void vbatch_stage(const rocblas_int m, const rocblas_int n, T *const A[], const rocblas_int *lda,
+                             const rocblas_int *order, T *W, const rocblas_int ldw, T** Aarr, const bool back)
+{
+    int k = hipBlockIdx_y;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int b = order[k];
+    T *a = A[b];
+    T *w = W + k*size_t(ldw)*n;
+
+    if (i < m) {
+        for (rocblas_int j = 0; j < n; ++j) {
+            if (back)
+                a[i + j*lda[b]] = w[i + j*ldw];
+            else
+                w[i + j*ldw] = a[i + j*lda[b]];
+        }
+    }
+
+    if (!back && i == 0)
+        Aarr[k] = w;
+}
+
+// Copies order to the device and gathers the pointers to the matrices of the batch, group after group.
+// dorder and Aarr have batch_count entries.
+template <typename T>
+rocblas_status rocsolver_vbatch_setup(rocblas_handle handle, T *const A[], const std::vector<rocblas_int>& order,
+                                      rocblas_int *dorder, T** Aarr)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int batch_count = order.size();
+    rocblas_int blocks = (batch_count - 1) / BLOCKSIZE + 1;
+
+    // order goes through the pinned buffer of the handle so that the stream is not synchronized after
+    // the copy (the buffer is free: rocsolver_vbatch_groups synchronized the stream)
+    rocblas_int *horder = static_cast<rocblas_int*>(rocsolver_host_buffer(handle, sizeof(rocblas_int)*batch_count));
+    if (!horder)
+        return rocblas_status_memory_error;
+    std::copy(order.begin(), order.end(), horder);
+    hipMemcpyAsync(dorder, horder, sizeof(rocblas_int)*batch_count, hipMemcpyHostToDevice, stream);
+    hipLaunchKernelGGL(vbatch_gather<T>,dim3(blocks),dim3(BLOCKSIZE),0,stream,A,dorder,Aarr,batch_count);
+
+    return rocblas_status_success;
+}
+
+// Copies the staged matrices of a group to W (which has room for g.lda*g.n*g.staged entries) and points
+// Aarr to the copies, or copies them back to the batch if back is true
+template <typename T>
+void rocsolver_vbatch_stage(hipStream_t stream, const rocsolver_vbatch_group& g, T *const A[], const rocblas_int *lda,
+                            const rocblas_int *dorder, T *W, T** Aarr, const bool back)
+{
+    if (g.staged == 0 || g.m == 0 || g.n == 0)
+        return;
+    rocblas_int k = g.first + g.count - g.staged;
+    rocblas_int blocks = (g.m - 1) / BLOCKSIZE + 1;
+    hipLaunchKernelGGL(vbatch_stage<T>,dim3(blocks,g.staged),dim3(BLOCKSIZE),0,stream,
+                       g.m,g.n,A,lda,dorder + k,W,g.lda,Aarr + k,back);
+}
+
+// copies the n entries of the vectors of a group (stored with the given stride) to the vectors of the batch
+template <typename T>
+void rocsolver_vbatch_scatter(hipStream_t stream, const rocblas_int n, const T* in, const rocblas_stride stride,
+                              T *const out[], const rocblas_int *order, const rocblas_int count)
+{
+    if (n == 0)
+        return;
+    rocblas_int blocks = (n - 1) / BLOCKSIZE + 1;
+    hipLaunchKernelGGL(vbatch_scatter<T>,dim3(blocks,count),dim3(BLOCKSIZE),0,stream,n,in,stride,out,order);
+}
+
+// Calls fn(h, g) for every group g, where h is the handle whose stream (and workspace) is used for the group.
+// A batch with S distinct sizes costs S calls of the batched template. The groups are independent, so if
+// there are several of them and the handle has a side stream, each group is given to the stream with
+// less work queued so far (estimated as count*m*n*min(m,n)), and both streams run concurrently; the main
+// stream waits for the side stream before returning. Without a side stream (e.g. with a user workspace)
+// the groups run one after the other.
+template <typename F>
+rocblas_status rocsolver_vbatch_run(rocblas_handle handle, const std::vector<rocsolver_vbatch_group>& groups, F fn)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    const rocsolver_side_stream* side = (groups.size() > 1) ? rocsolver_get_side_stream(handle) : nullptr;
+    if (side) {
+        // the side stream needs the positions and pointers set up on the main stream
+        hipEventRecord(side->ready, stream);
+        hipStreamWaitEvent(side->stream, side->ready, 0);
+    }
+
+    rocblas_status status = rocblas_status_success;
+    double work = 0, swork = 0;
+    for (auto& g : groups) {
+        double w = double(g.count) * g.m * g.n * std::min(g.m,g.n);
+        bool useside = side && swork < work;
+        if (useside)
+            swork += w;
+        else
+            work += w;
+        status = fn(useside ? side->handle : handle, g);
+        if (status != rocblas_status_success)
+            break;
+    }
+
+    if (side) {
+        hipEventRecord(side->done, side->stream);
+        hipStreamWaitEvent(stream, side->done, 0);
+    }
+    return status;
+}
+
+
+template <typename T>
+void rocsolver_getrf_vbatched_getMemorySize(const std::vector<rocsolver_vbatch_group>& groups, const rocblas_int batch_count,
+                                            size_t *size)
+{
+    // positions and pointers of the grouped matrices
+    *size = rocsolver_workspace_size<rocblas_int>(batch_count) + rocsolver_workspace_size<T*>(batch_count);
+
+    // + max over the groups of (getrf + pivots, info and staged matrices of the group)
+    size_t s = 0, sg;
+    for (auto& g : groups) {
+        rocsolver_getrf_getMemorySize<T>(g.m,g.n,g.count,&sg);
+        sg += rocsolver_workspace_size<rocblas_int>(size_t(std::max(std::min(g.m,g.n),1))*g.count);
+        sg += rocsolver_workspace_size<rocblas_int>(g.count);
+        sg += rocsolver_workspace_size<T>(size_t(g.lda)*g.n*g.staged);
+        s = std::max(s,sg);
+    }
+    *size += s;
+}
+
+template <typename T>
+void rocsolver_potrf_vbatched_getMemorySize(const std::vector<rocsolver_vbatch_group>& groups, const rocblas_int batch_count,
+                                            size_t *size)
+{
+    // positions and pointers of the grouped matrices
+    *size = rocsolver_workspace_size<rocblas_int>(batch_count) + rocsolver_workspace_size<T*>(batch_count);
+
+    // + max over the groups of (potrf + info and staged matrices of the group)
+    size_t s = 0, sg;
+    for (auto& g : groups) {
+        rocsolver_potrf_getMemorySize<T>(g.n,g.count,&sg);
+        sg += rocsolver_workspace_size<rocblas_int>(g.count);
+        sg += rocsolver_workspace_size<T>(size_t(g.lda)*g.n*g.staged);
+        s = std::max(s,sg);
+    }
+    *size += s;
+}
+
+template <typename T>
+void rocsolver_geqrf_vbatched_getMemorySize(const std::vector<rocsolver_vbatch_group>& groups, const rocblas_int batch_count,
+                                            size_t *size)
+{
+    // positions and pointers of the grouped matrices
+    *size = rocsolver_workspace_size<rocblas_int>(batch_count) + rocsolver_workspace_size<T*>(batch_count);
+
+    // + max over the groups of (geqrf + scalars of the reflectors and staged matrices of the group)
+    size_t s = 0, sg;
+    for (auto& g : groups) {
+        rocsolver_geqrf_getMemorySize<T>(g.m,g.n,g.count,&sg);
+        sg += rocsolver_workspace_size<T>(size_t(std::max(std::min(g.m,g.n),1))*g.count);
+        sg += rocsolver_workspace_size<T>(size_t(g.lda)*g.n*g.staged);
+        s = std::max(s,sg);
+    }
+    *size += s;
+}
+
+template <typename T>
+rocblas_status rocsolver_getrf_vbatched_template(rocblas_handle handle, const std::vector<rocsolver_vbatch_group>& groups,
+                                                 const std::vector<rocblas_int>& order, T *const A[],
+                                                 const rocblas_int *lda, rocblas_int *const ipiv[], rocblas_int *info, const rocblas_int batch_count)
+{
+    // quick return
+    if (batch_count == 0)
+        return rocblas_status_success;
+
+    rocsolver_workspace_frame frame(handle);
+    rocblas_int *dorder = frame.alloc<rocblas_int>(batch_count);
+    T** Aarr = frame.alloc<T*>(batch_count);
+    if (!dorder || !Aarr)
+        return rocblas_status_memory_error;
+    rocblas_status status = rocsolver_vbatch_setup<T>(handle, A, order, dorder, Aarr);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_vbatch_run(handle, groups, [&](rocblas_handle h, const rocsolver_vbatch_group& g) {
+        hipStream_t gstream;
+        rocblas_get_stream(h, &gstream);
+
+        // pivots, info and staged matrices of the group
+        rocsolver_workspace_frame gframe(h);
+        rocblas_int mn = std::min(g.m,g.n);
+        rocblas_int *gipiv = gframe.alloc<rocblas_int>(size_t(std::max(mn,1))*g.count);
+        rocblas_int *ginfo = gframe.alloc<rocblas_int>(g.count);
+        T *W = gframe.alloc<T>(size_t(g.lda)*g.n*g.staged);
+        if (!gipiv || !ginfo || (g.staged && !W))
+            return rocblas_status_memory_error;
+        rocsolver_vbatch_stage<T>(gstream, g, A, lda, dorder, W, Aarr, false);
+
+        //info=0 (for the empty matrices)
+        rocblas_int blocksReset = (g.count - 1) / BLOCKSIZE + 1;
+        hipLaunchKernelGGL(reset_info,dim3(blocksReset),dim3(BLOCKSIZE),0,gstream,ginfo,g.count,0);
+
+        rocblas_status gstatus = rocsolver_getrf_template<true,false,true,T>(h,g.m,g.n,
+                                                            cast2constPointer<T>(Aarr + g.first),0,g.lda,0,
+                                                            gipiv,0,mn,ginfo,g.count);
+        if (gstatus != rocblas_status_success)
+            return gstatus;
+
+        rocsolver_vbatch_stage<T>(gstream, g, A, lda, dorder, W, Aarr, true);
+        rocsolver_vbatch_scatter<rocblas_int>(gstream,mn,gipiv,mn,ipiv,dorder + g.first,g.count);
+        hipLaunchKernelGGL(vbatch_scatter_info<rocblas_int>,dim3(blocksReset),dim3(BLOCKSIZE),0,gstream,ginfo,info,dorder + g.first,g.count);
+        return rocblas_status_success;
+    });
+}
+
+template <typename T>
+rocblas_status rocsolver_potrf_vbatched_template(rocblas_handle handle, const rocblas_fill uplo,
+                                                 const std::vector<rocsolver_vbatch_group>& groups,
+                                                 const std::vector<rocblas_int>& order, T *const A[],
+                                                 const rocblas_int *lda, rocblas_int *info, const rocblas_int batch_count)
+{
+    // quick return
+    if (batch_count == 0)
+        return rocblas_status_success;
+
+    rocsolver_workspace_frame frame(handle);
+    rocblas_int *dorder = frame.alloc<rocblas_int>(batch_count);
+    T** Aarr = frame.alloc<T*>(batch_count);
+    if (!dorder || !Aarr)
+        return rocblas_status_memory_error;
+    rocblas_status status = rocsolver_vbatch_setup<T>(handle, A, order, dorder, Aarr);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_vbatch_run(handle, groups, [&](rocblas_handle h, const rocsolver_vbatch_group& g) {
+        hipStream_t gstream;
+        rocblas_get_stream(h, &gstream);
+
+        // info and staged matrices of the group
+        rocsolver_workspace_frame gframe(h);
+        rocblas_int *ginfo = gframe.alloc<rocblas_int>(g.count);
+        T *W = gframe.alloc<T>(size_t(g.lda)*g.n*g.staged);
+        if (!ginfo || (g.staged && !W))
+            return rocblas_status_memory_error;
+        rocsolver_vbatch_stage<T>(gstream, g, A, lda, dorder, W, Aarr, false);
+
+        //info=0 (for the empty matrices)
+        rocblas_int blocksReset = (g.count - 1) / BLOCKSIZE + 1;
+        hipLaunchKernelGGL(reset_info,dim3(blocksReset),dim3(BLOCKSIZE),0,gstream,ginfo,g.count,0);
+
+        rocblas_status gstatus = rocsolver_potrf_template<true,false,T>(h,uplo,g.n,
+                                                            cast2constPointer<T>(Aarr + g.first),0,g.lda,0,
+                                                            ginfo,g.count);
+        if (gstatus != rocblas_status_success)
+            return gstatus;
+
+        rocsolver_vbatch_stage<T>(gstream, g, A, lda, dorder, W, Aarr, true);
+        hipLaunchKernelGGL(vbatch_scatter_info<rocblas_int>,dim3(blocksReset),dim3(BLOCKSIZE),0,gstream,ginfo,info,dorder + g.first,g.count);
+        return rocblas_status_success;
+    });
+}
+
+template <typename T>
+rocblas_status rocsolver_geqrf_vbatched_template(rocblas_handle handle, const std::vector<rocsolver_vbatch_group>& groups,
+                                                 const std::vector<rocblas_int>& order, T *const A[],
+                                                 const rocblas_int *lda, T *const ipiv[], const rocblas_int batch_count)
+{
+    // quick return
+    if (batch_count == 0)
+        return rocblas_status_success;
+
+    rocsolver_workspace_frame frame(handle);
+    rocblas_int *dorder = frame.alloc<rocblas_int>(batch_count);
+    T** Aarr = frame.alloc<T*>(batch_count);
+    if (!dorder || !Aarr)
+        return rocblas_status_memory_error;
+    rocblas_status status = rocsolver_vbatch_setup<T>(handle, A, order, dorder, Aarr);
+    if (status != rocblas_status_success)
+        return status;
+
+    return rocsolver_vbatch_run(handle, groups, [&](rocblas_handle h, const rocsolver_vbatch_group& g) {
+        hipStream_t gstream;
+        rocblas_get_stream(h, &gstream);
+
+        // scalars of the reflectors and staged matrices of the group
+        rocsolver_workspace_frame gframe(h);
+        rocblas_int mn = std::min(g.m,g.n);
+        T *gipiv = gframe.alloc<T>(size_t(std::max(mn,1))*g.count);
+        T *W = gframe.alloc<T>(size_t(g.lda)*g.n*g.staged);
+        if (!gipiv || (g.staged && !W))
+            return rocblas_status_memory_error;
+        rocsolver_vbatch_stage<T>(gstream, g, A, lda, dorder, W, Aarr, false);
+
+        rocblas_status gstatus = rocsolver_geqrf_template<true,false,T>(h,g.m,g.n,
+                                                            cast2constPointer<T>(Aarr + g.first),0,g.lda,0,
+                                                            gipiv,mn,g.count);
+        if (gstatus != rocblas_status_success)
+            return gstatus;
+
+        rocsolver_vbatch_stage<T>(gstream, g, A, lda, dorder, W, Aarr, true);
+        rocsolver_vbatch_scatter<T>(gstream,mn,gipiv,mn,ipiv,dorder + g.first,g.count);
+        return rocblas_status_success;
+    });
+}
+
+#endif /* ROCLAPACK_VBATCHED_HPP */
@@ -0,0 +1,618 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocsolver.h"
+#include "rocsolver_handle.hpp"
+#include <hip/hip_runtime.h>
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// a contiguous piece of device memory of the workspace
+struct workspace_chunk
+{
+    char*  ptr;
+    size_t size;
+    size_t used;
+};
+
+// rocsolver state attached to a rocblas handle with rocsolver_attach_handle (and removed with
+// rocsolver_detach_handle)
+struct rocsolver_handle_state
+{
+    // stream on which the last work using the state was enqueued, and the event recorded after it.
+    // When the stream of the handle changes, the new stream waits for that event before the
+    // workspace and the constants are used again (see get_state)
+    hipStream_t stream = nullptr;
+    hipEvent_t idle = nullptr;
+
+    // the workspace is a list of chunks used as a stack. When a request does not fit
+    // in the current chunk a new one is appended (so that pointers already handed out
+    // are never moved). Once no frame is alive the chunks are merged into a single one.
+    std::vector<workspace_chunk> chunks;
+    size_t current = 0;
+    rocblas_int depth = 0;
+
+    // true if the memory was provided with rocsolver_set_workspace
+    bool user = false;
+
+    // workspace query mode
+    bool query = false;
+    size_t query_size = 0;
+
+    // area of WORKSPACE_CONSTANTS_SIZE bytes with the table of device constants, and whether
+    // each of its slots was written. It is the head of the memory provided by the user, or
+    // allocated by the library (and then kept when the workspace grows, as the constants are
+    // written only once)
+    char* constants_area = nullptr;
+    bool own_constants = false;
+    bool constants[rocsolver_constants_count] = {};
+
+    // pinned host memory used to copy data computed on the host to the device asynchronously
+    void* host_buffer = nullptr;
+    size_t host_size = 0;
+
+    // algorithm used by getrf to factorize the panels
+    rocblas_panel panel = rocblas_panel_auto;
+
+    // look-ahead in getrf and the side stream it uses
+    bool lookahead = false;
+    bool has_side = false;
+    rocsolver_side_stream side;
+
+    // early exit of the factorizations for the matrices of a batch that fail
+    bool early_exit = false;
+};
+
+static std::mutex registry_mutex;
+static std::unordered_map<rocblas_handle, rocsolver_handle_state> registry;
+
+static void free_constants(rocsolver_handle_state* state)
+{
+    if (state->own_constants)
+        hipFree(state->constants_area);
+    state->constants_area = nullptr;
+    state->own_constants = false;
+    std::fill(state->constants, state->constants + rocsolver_constants_count, false);
+}
+
+static void free_chunks(rocsolver_handle_state* state)
+{
+    // hipFree waits for the device, so memory still in use by
+    // kernels in flight is not released under their feet
+    if (!state->user) {
+        for (auto& c : state->chunks)
+            hipFree(c.ptr);
+    }
+    state->chunks.clear();
+    state->current = 0;
+    state->user = false;
+}
+
+// frees the device memory, the pinned memory and the side stream of a state; the settings are
+// kept (the memory provided by the user is not freed)
+static void release_memory(rocsolver_handle_state* state)
+{
+    free_chunks(state);
+    free_constants(state);
+    if (state->host_buffer)
+        hipHostFree(state->host_buffer);
+    state->host_buffer = nullptr;
+    state->host_size = 0;
+
+    // the side handle has its own rocsolver state
+    if (state->has_side) {
+        hipStreamSynchronize(state->side.stream);
+        rocsolver_detach_handle(state->side.handle);
+        rocblas_destroy_handle(state->side.handle);
+        hipEventDestroy(state->side.ready);
+        hipEventDestroy(state->side.done);
+        hipStreamDestroy(state->side.stream);
+        state->has_side = false;
+    }
+}
+
+// frees everything of a state removed from the registry
+static void release_state(rocsolver_handle_state* state)
+{
+    release_memory(state);
+    if (state->idle)
+        hipEventDestroy(state->idle);
+    state->idle = nullptr;
+}
+
+// state of the handle, or nullptr if the handle is not attached
+static rocsolver_handle_state* find_state(rocblas_handle handle)
+{
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    auto it = registry.find(handle);
+    return it == registry.end() ? nullptr : &it->second;
+}
+
+// state of an attached handle, bound to the current stream of the handle
+static rocsolver_handle_state* get_state(rocblas_handle handle)
+{
+    rocsolver_handle_state* state = find_state(handle);
+    if (!state)
+        return nullptr;
+
+    // the stream was changed with rocblas_set_stream: the work enqueued on the previous stream
+    // may still use the workspace, so the new stream waits for it (the host is not blocked)
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+    if (state->stream != stream && state->depth == 0) {
+        hipStreamWaitEvent(stream, state->idle, 0);
+        state->stream = stream;
+    }
+
+    return state;
+}
+
+bool rocsolver_workspace_query(rocblas_handle handle, const size_t size)
+{
+    rocsolver_handle_state* state = get_state(handle);
+    if (!state || !state->query)
+        return false;
+
+    state->query_size = std::max(state->query_size, size);
+    return true;
+}
+
+rocblas_status rocsolver_workspace_reserve(rocblas_handle handle, const size_t size)
+{
+    rocsolver_handle_state* state = get_state(handle);
+    if (!state)
+        return rocblas_status_invalid_handle;
+
+    // the memory provided by the user cannot grow (and must have room for the constants)
+    if (state->user)
+        return state->constants_area && state->chunks[0].size >= size ? rocblas_status_success
+                                                                        : rocblas_status_memory_error;
+
+    // only the outermost call sizes the workspace
+    if (state->depth > 0 || size == 0)
+        return rocblas_status_success;
+
+    if (state->chunks.size() == 1 && state->chunks[0].size >= size)
+        return rocblas_status_success;
+
+    free_chunks(state);
+    workspace_chunk c = {nullptr, size, 0};
+    if (hipMalloc(&c.ptr, size) != hipSuccess)
+        return rocblas_status_memory_error;
+    state->chunks.push_back(c);
+
+    return rocblas_status_success;
+}
+
+// the values of a set of constants, passed by value to the kernel that writes them
+struct constants_slot
+{
+    char bytes[WORKSPACE_CONSTANTS_SLOT];
+};
+
+__global__ void write_constants(char* dst, const constants_slot values, const size_t bytes)
+{
+    size_t i = hipThreadIdx_x;
+    if (i < bytes)
+        dst[i] = values.bytes[i];
+}
+
+void* rocsolver_device_constants(rocblas_handle handle, const rocsolver_constants_id id,
+                                 const void* values, const size_t bytes)
+{
+    rocsolver_handle_state* state = get_state(handle);
+    if (bytes > WORKSPACE_CONSTANTS_SLOT)
+        return nullptr;
+
+    // first request: the table is allocated once
+    if (!state->constants_area) {
+        if (state->user || hipMalloc(&state->constants_area, WORKSPACE_CONSTANTS_SIZE) != hipSuccess) {
+            state->constants_area = nullptr;
+            return nullptr;
+        }
+        state->own_constants = true;
+    }
+
+    char* ptr = state->constants_area + id * WORKSPACE_CONSTANTS_SLOT;
+    if (state->constants[id])
+        return ptr;
+
+    // the copy is done by a kernel on the stream of the handle (instead of a synchronous
+    // hipMemcpy), so it is ordered with the calls that use the constants
+    constants_slot slot;
+    std::copy(static_cast<const char*>(values), static_cast<const char*>(values) + bytes, slot.bytes);
+    hipLaunchKernelGGL(write_constants, dim3(1), dim3(WORKSPACE_CONSTANTS_SLOT), 0, state->stream,
+                       ptr, slot, bytes);
+    hipEventRecord(state->idle, state->stream);
+
+    state->constants[id] = true;
+    return ptr;
+}
+
+void* rocsolver_host_buffer(rocblas_handle handle, const size_t bytes)
+{
+    rocsolver_handle_state* state = get_state(handle);
+    if (state->host_size >= bytes)
+        return state->host_buffer;
+
+    // the previous buffer is no longer in use (see rocsolver_host_buffer in the header)
+    if (state->host_buffer)
+        hipHostFree(state->host_buffer);
+    state->host_buffer = nullptr;
+    state->host_size = 0;
+    if (hipHostMalloc(&state->host_buffer, bytes) != hipSuccess) {
+        state->host_buffer = nullptr;
+        return nullptr;
+    }
+    state->host_size = bytes;
+
+    return state->host_buffer;
+}
+
+rocblas_panel rocsolver_getrf_panel(rocblas_handle handle)
+{
+    return get_state(handle)->panel;
+}
+
+bool rocsolver_getrf_lookahead(rocblas_handle handle)
+{
+    return get_state(handle)->lookahead;
+}
+
+bool rocsolver_early_exit(rocblas_handle handle)
+{
+    return get_state(handle)->early_exit;
+}
+
+const rocsolver_side_stream* rocsolver_get_side_stream(rocblas_handle handle)
+{
+    rocsolver_handle_state* state = get_state(handle);
+    if (state->has_side)
+        return &state->side;
+    if (state->user)
+        return nullptr;
+
+    rocsolver_side_stream& side = state->side;
+    rocblas_pointer_mode mode;
+    rocblas_get_pointer_mode(handle, &mode);
+    if (rocblas_create_handle(&side.handle) != rocblas_status_success)
+        return nullptr;
+    if (hipStreamCreateWithFlags(&side.stream, hipStreamNonBlocking) != hipSuccess) {
+        rocblas_destroy_handle(side.handle);
+        return nullptr;
+    }
+    if (hipEventCreateWithFlags(&side.ready, hipEventDisableTiming) != hipSuccess) {
+        hipStreamDestroy(side.stream);
+        rocblas_destroy_handle(side.handle);
+        return nullptr;
+    }
+    if (hipEventCreateWithFlags(&side.done, hipEventDisableTiming) != hipSuccess) {
+        hipEventDestroy(side.ready);
+        hipStreamDestroy(side.stream);
+        rocblas_destroy_handle(side.handle);
+        return nullptr;
+    }
+    rocblas_set_stream(side.handle, side.stream);
+    if (rocsolver_attach_handle(side.handle) != rocblas_status_success) {
+        hipEventDestroy(side.done);
+        hipEventDestroy(side.ready);
+        hipStreamDestroy(side.stream);
+        rocblas_destroy_handle(side.handle);
+        return nullptr;
+    }
+    rocblas_set_pointer_mode(side.handle, mode);
+
+    state->has_side = true;
+    return &state->side;
+}
+
+rocsolver_workspace_frame::rocsolver_workspace_frame(rocblas_handle handle)
+    : state(get_state(handle))
+{
+    mark_chunk = state->current;
+    mark_used = state->chunks.empty() ? 0 : state->chunks[state->current].used;
+    state->depth++;
+}
+
+rocsolver_workspace_frame::~rocsolver_workspace_frame()
+{
+    auto& chunks = state->chunks;
+
+    // give back everything taken since the frame was created
+    for (size_t i = mark_chunk + 1; i < chunks.size(); ++i)
+        chunks[i].used = 0;
+    if (mark_chunk < chunks.size())
+        chunks[mark_chunk].used = mark_used;
+    state->current = mark_chunk;
+
+    if (--state->depth > 0)
+        return;
+
+    // when the outermost frame is released, merge the chunks so that
+    // the next call finds a single buffer of the high-water-mark size
+    if (chunks.size() > 1 && !state->user) {
+        size_t total = 0;
+        for (auto& c : chunks)
+            total += c.size;
+        free_chunks(state);
+
+        workspace_chunk c = {nullptr, total, 0};
+        if (hipMalloc(&c.ptr, total) == hipSuccess)
+            chunks.push_back(c);
+    }
+
+    // marks the end of the work that uses the workspace (see get_state)
+    hipEventRecord(state->idle, state->stream);
+}
+
+void* rocsolver_workspace_frame::push(const size_t bytes)
+{
+    auto& chunks = state->chunks;
+
+    // look for room in the current chunk or in the (empty) chunks after it
+    while (state->current < chunks.size()) {
+        workspace_chunk& c = chunks[state->current];
+        if (c.size - c.used >= bytes) {
+            void* ptr = c.ptr + c.used;
+            c.used += bytes;
+            return ptr;
+        }
+        if (state->current + 1 == chunks.size())
+            break;
+        state->current++;
+    }
+
+    // memory provided by the user is never replaced
+    if (state->user)
+        return nullptr;
+
+    // grow the workspace geometrically
+    size_t total = 0;
+    for (auto& c : chunks)
+        total += c.size;
+
+    workspace_chunk c = {nullptr, std::max(bytes, total), bytes};
+    if (c.size == 0)
+        c.size = WORKSPACE_ALIGNMENT;
+    if (hipMalloc(&c.ptr, c.size) != hipSuccess)
+        return nullptr;
+
+    chunks.push_back(c);
+    state->current = chunks.size() - 1;
+    return c.ptr;
+}
+
+
+/*******************************************************************************
+ *! \brief   creates the rocsolver state of the given handle.
+ ******************************************************************************/
+
+extern "C" rocblas_status rocsolver_attach_handle(rocblas_handle handle)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    rocsolver_handle_state fresh;
+    rocblas_get_stream(handle, &fresh.stream);
+    if(hipEventCreateWithFlags(&fresh.idle, hipEventDisableTiming) != hipSuccess)
+        return rocblas_status_memory_error;
+
+    // a state found at the same address belongs to a handle destroyed without
+    // rocsolver_detach_handle; it is replaced
+    rocsolver_handle_state stale;
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex);
+        auto it = registry.find(handle);
+        if(it != registry.end()) {
+            if(it->second.depth > 0) {
+                hipEventDestroy(fresh.idle);
+                return rocblas_status_internal_error;
+            }
+            stale = std::move(it->second);
+            it->second = std::move(fresh);
+        }
+        else
+            registry.emplace(handle, std::move(fresh));
+    }
+
+    release_state(&stale);
+
+    return rocblas_status_success;
+}
+
+
+/*******************************************************************************
+ *! \brief   removes the rocsolver state of the given handle and frees its memory.
+ ******************************************************************************/
+
+extern "C" rocblas_status rocsolver_detach_handle(rocblas_handle handle)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    rocsolver_handle_state state;
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex);
+        auto it = registry.find(handle);
+        if(it == registry.end())
+            return rocblas_status_success;
+
+        if(it->second.depth > 0)
+            return rocblas_status_internal_error;
+
+        state = std::move(it->second);
+        registry.erase(it);
+    }
+
+    release_state(&state);
+
+    return rocblas_status_success;
+}
+
+
+/*******************************************************************************
+ *! \brief   releases the device memory that rocsolver holds for the given handle.
+ ******************************************************************************/
+
+extern "C" rocblas_status rocsolver_release_workspace(rocblas_handle handle)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    rocsolver_handle_state* state = get_state(handle);
+    if(!state)
+        return rocblas_status_invalid_handle;
+    if(state->depth > 0)
+        return rocblas_status_internal_error;
+
+    release_memory(state);
+
+    return rocblas_status_success;
+}
+
+
+/*******************************************************************************
+ *! \brief   sets the handle in workspace query mode.
+ ******************************************************************************/
+
+extern "C" rocblas_status rocsolver_start_workspace_query(rocblas_handle handle)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    rocsolver_handle_state* state = get_state(handle);
+    if(!state)
+        return rocblas_status_invalid_handle;
+    state->query = true;
+    state->query_size = 0;
+
+    return rocblas_status_success;
+}
+
+
+/*******************************************************************************
+ *! \brief   leaves workspace query mode and returns the size (in bytes) needed by
+     the functions called since rocsolver_start_workspace_query.
+ ******************************************************************************/
+
+extern "C" rocblas_status rocsolver_stop_workspace_query(rocblas_handle handle, size_t* size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!size)
+        return rocblas_status_invalid_pointer;
+
+    rocsolver_handle_state* state = get_state(handle);
+    if(!state)
+        return rocblas_status_invalid_handle;
+    if(!state->query)
+        return rocblas_status_internal_error;
+
+    *size = state->query_size + WORKSPACE_CONSTANTS_SIZE;
+    state->query = false;
+    state->query_size = 0;
+
+    return rocblas_status_success;
+}
+
+
+/*******************************************************************************
+ *! \brief   makes the handle use the given device memory as workspace.
+ ******************************************************************************/
+
+extern "C" rocblas_status rocsolver_set_workspace(rocblas_handle handle, void* ptr, size_t size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!ptr && size)
+        return rocblas_status_invalid_pointer;
+    if(ptr && !size)
+        return rocblas_status_invalid_size;
+
+    rocsolver_handle_state* state = get_state(handle);
+    if(!state)
+        return rocblas_status_invalid_handle;
+    if(state->depth > 0)
+        return rocblas_status_internal_error;
+
+    // the constants already written are lost with the memory that holds them
+    free_chunks(state);
+    free_constants(state);
+    if(ptr) {
+        // the head of the memory holds the constants; a smaller size leaves no room for
+        // them and the functions return rocblas_status_memory_error
+        char* head = static_cast<char*>(ptr);
+        if(size >= WORKSPACE_CONSTANTS_SIZE) {
+            state->constants_area = head;
+            head += WORKSPACE_CONSTANTS_SIZE;
+            size -= WORKSPACE_CONSTANTS_SIZE;
+        }
+        else
+            size = 0;
+        workspace_chunk c = {head, size, 0};
+        state->chunks.push_back(c);
+        state->user = true;
+    }
+
+    return rocblas_status_success;
+}
+
+
+/*******************************************************************************
+ *! \brief   selects the algorithm used by getrf to factorize the panels.
+ ******************************************************************************/
+
+extern "C" rocblas_status rocsolver_set_getrf_panel(rocblas_handle handle, const rocblas_panel panel)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(panel != rocblas_panel_auto && panel != rocblas_panel_unblocked && panel != rocblas_panel_recursive
+       && panel != rocblas_panel_tournament)
+        return rocblas_status_not_implemented;
+
+    rocsolver_handle_state* state = get_state(handle);
+    if(!state)
+        return rocblas_status_invalid_handle;
+    state->panel = panel;
+
+    return rocblas_status_success;
+}
+
+
+/*******************************************************************************
+ *! \brief   enables or disables the look-ahead in getrf.
+ ******************************************************************************/
+
+extern "C" rocblas_status rocsolver_set_getrf_lookahead(rocblas_handle handle, const rocblas_int lookahead)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    rocsolver_handle_state* state = get_state(handle);
+    if(!state)
+        return rocblas_status_invalid_handle;
+    state->lookahead = (lookahead != 0);
+
+    return rocblas_status_success;
+}
+
+
+/*******************************************************************************
+ *! \brief   enables or disables the early exit of failed batch entries.
+ ******************************************************************************/
+
+extern "C" rocblas_status rocsolver_set_early_exit(rocblas_handle handle, const rocblas_int early_exit)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    rocsolver_handle_state* state = get_state(handle);
+    if(!state)
+        return rocblas_status_invalid_handle;
+    state->early_exit = (early_exit != 0);
+
+    return rocblas_status_success;
+}